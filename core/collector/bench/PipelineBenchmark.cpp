@@ -0,0 +1,872 @@
+// =============================================================================
+// collector/bench/PipelineBenchmark.cpp - 파이프라인 처리량 벤치마크
+// 🔥 합성 디바이스 부하로 실제 PipelineManager → DataProcessingService →
+//    RedisDataWriter 경로를 구동하고 msgs/s, points/s, 지연 백분위,
+//    포인트당 할당 횟수를 보고한다.
+//
+// 외부 의존성은 모두 로컬 대체물로 바꾼다:
+//   - Redis:  127.0.0.1 임의 포트의 RESP 스텁 (모든 명령에 최소 응답,
+//             SET/SETEX/HSET로 남는 키 공간 크기를 추정)
+//   - Influx: 127.0.0.1 임의 포트의 HTTP 스텁 (/health 200, 그 외 204)
+//   - SQLite: 임시 디렉토리의 DB 파일
+//
+// 사용법: make bench BENCH_ARGS="--devices 200 --points 50 --samples 100"
+// =============================================================================
+
+#include "Alarm/AlarmTypes.h"
+#include "Common/Structs.h"
+#include "Database/Entities/AlarmRuleEntity.h"
+#include "Database/Repositories/AlarmRuleRepository.h"
+#include "Database/RepositoryFactory.h"
+#include "Logging/LogManager.h"
+#include "Pipeline/DataProcessingService.h"
+#include "Pipeline/PipelineManager.h"
+#include "Pipeline/PipelineMetrics.h"
+#include "Utils/ConfigManager.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace PulseOne;
+namespace fs = std::filesystem;
+
+// =============================================================================
+// 할당 카운터 (전역 operator new 대체)
+// =============================================================================
+
+namespace {
+std::atomic<uint64_t> g_allocations{0};
+std::atomic<uint64_t> g_allocated_bytes{0};
+} // namespace
+
+void *operator new(std::size_t size) {
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  if (void *p = std::malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+void *operator new[](std::size_t size) { return operator new(size); }
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  try {
+    return operator new(size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept {
+  return operator new(size, tag);
+}
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+// =============================================================================
+// 설정
+// =============================================================================
+
+struct BenchOptions {
+  size_t devices = 100;
+  size_t points = 50;
+  size_t samples = 100; // 디바이스당 측정 메시지 수
+  size_t warmup = 10;   // 디바이스당 워밍업 메시지 수
+  double change_rate = 0.2;
+  double alarm_density = 0.05;
+  size_t threads = 4;
+  size_t producers = 2;
+  uint32_t seed = 42;
+  int timeout_sec = 300;
+  std::string redis_layout = "legacy"; // REDIS_STORAGE_LAYOUT
+  size_t redis_pool = 4;               // REDIS_POOL_SIZE
+  std::string redis_binary;            // REDIS_BINARY_FAMILIES
+  bool redis_async = false;            // REDIS_ASYNC_ENABLED
+  bool json = false;
+  bool verbose = false;
+};
+
+void PrintUsage() {
+  std::cout
+      << "Usage: pulseone-bench [options]\n"
+         "  --devices N        synthetic devices (default 100)\n"
+         "  --points M         points per device (default 50)\n"
+         "  --samples K        measured messages per device (default 100)\n"
+         "  --warmup W         warm-up messages per device (default 10)\n"
+         "  --change-rate R    probability a point changes per sample (0.2)\n"
+         "  --alarm-density D  fraction of numeric points with a rule (0.05)\n"
+         "  --threads T        processing threads (default 4)\n"
+         "  --producers P      generator threads (default 2)\n"
+         "  --seed S           RNG seed (default 42)\n"
+         "  --timeout SEC      drain timeout (default 300)\n"
+         "  --redis-layout L   legacy | hash | both (default legacy)\n"
+         "  --redis-pool N     Redis connections per client (default 4)\n"
+         "  --redis-binary F   MessagePack key families, comma separated\n"
+         "                     (device,latest,light,full,hash | all; default none)\n"
+         "  --redis-async      send writer pipelines via the async client\n"
+         "  --json             print one JSON result line\n"
+         "  --verbose          keep collector logging at INFO\n";
+}
+
+bool ParseOptions(int argc, char **argv, BenchOptions &opt) {
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    auto next = [&](const char *name) -> const char * {
+      if (i + 1 >= argc) {
+        std::cerr << "missing value for " << name << "\n";
+        return nullptr;
+      }
+      return argv[++i];
+    };
+    const char *v = nullptr;
+    if (arg == "--help" || arg == "-h") {
+      PrintUsage();
+      return false;
+    } else if (arg == "--json") {
+      opt.json = true;
+    } else if (arg == "--verbose") {
+      opt.verbose = true;
+    } else if (arg == "--devices" && (v = next("--devices"))) {
+      opt.devices = std::max<size_t>(std::stoul(v), 1);
+    } else if (arg == "--points" && (v = next("--points"))) {
+      opt.points = std::max<size_t>(std::stoul(v), 1);
+    } else if (arg == "--samples" && (v = next("--samples"))) {
+      opt.samples = std::max<size_t>(std::stoul(v), 1);
+    } else if (arg == "--warmup" && (v = next("--warmup"))) {
+      opt.warmup = std::stoul(v);
+    } else if (arg == "--change-rate" && (v = next("--change-rate"))) {
+      opt.change_rate = std::clamp(std::stod(v), 0.0, 1.0);
+    } else if (arg == "--alarm-density" && (v = next("--alarm-density"))) {
+      opt.alarm_density = std::clamp(std::stod(v), 0.0, 1.0);
+    } else if (arg == "--threads" && (v = next("--threads"))) {
+      opt.threads = std::max<size_t>(std::stoul(v), 1);
+    } else if (arg == "--producers" && (v = next("--producers"))) {
+      opt.producers = std::max<size_t>(std::stoul(v), 1);
+    } else if (arg == "--seed" && (v = next("--seed"))) {
+      opt.seed = static_cast<uint32_t>(std::stoul(v));
+    } else if (arg == "--timeout" && (v = next("--timeout"))) {
+      opt.timeout_sec = std::max(std::stoi(v), 1);
+    } else if (arg == "--redis-async") {
+      opt.redis_async = true;
+    } else if (arg == "--redis-binary" && (v = next("--redis-binary"))) {
+      opt.redis_binary = v;
+    } else if (arg == "--redis-pool" && (v = next("--redis-pool"))) {
+      opt.redis_pool = std::max<size_t>(std::stoul(v), 1);
+    } else if (arg == "--redis-layout" && (v = next("--redis-layout"))) {
+      opt.redis_layout = v;
+      if (opt.redis_layout != "legacy" && opt.redis_layout != "hash" &&
+          opt.redis_layout != "both") {
+        std::cerr << "invalid --redis-layout: " << v << "\n";
+        return false;
+      }
+    } else {
+      std::cerr << "unknown option: " << arg << "\n";
+      PrintUsage();
+      return false;
+    }
+  }
+  return true;
+}
+
+// =============================================================================
+// 로컬 소켓 스텁
+// =============================================================================
+
+/**
+ * @brief 127.0.0.1 임의 포트에서 연결마다 스레드 하나로 응답하는 TCP 서버
+ */
+class LoopbackServer {
+public:
+  virtual ~LoopbackServer() { Stop(); }
+
+  bool Start() {
+    listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_fd_ < 0)
+      return false;
+    int yes = 1;
+    ::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    if (::bind(listen_fd_, reinterpret_cast<sockaddr *>(&addr),
+               sizeof(addr)) < 0 ||
+        ::listen(listen_fd_, 64) < 0) {
+      ::close(listen_fd_);
+      listen_fd_ = -1;
+      return false;
+    }
+    socklen_t len = sizeof(addr);
+    ::getsockname(listen_fd_, reinterpret_cast<sockaddr *>(&addr), &len);
+    port_ = ntohs(addr.sin_port);
+
+    running_ = true;
+    accept_thread_ = std::thread([this]() { AcceptLoop(); });
+    return true;
+  }
+
+  void Stop() {
+    if (!running_.exchange(false))
+      return;
+    ::shutdown(listen_fd_, SHUT_RDWR);
+    ::close(listen_fd_);
+    if (accept_thread_.joinable())
+      accept_thread_.join();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int fd : client_fds_)
+      ::shutdown(fd, SHUT_RDWR);
+    for (auto &t : client_threads_)
+      if (t.joinable())
+        t.join();
+    client_threads_.clear();
+  }
+
+  int Port() const { return port_; }
+  uint64_t Requests() const { return requests_.load(); }
+  uint64_t BytesIn() const { return bytes_in_.load(); }
+
+protected:
+  // 연결 하나를 처리, false를 반환하면 연결 종료
+  virtual bool Serve(int fd, std::string &buffer) = 0;
+
+  static bool WriteAll(int fd, const std::string &data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+      ssize_t n = ::send(fd, data.data() + sent, data.size() - sent,
+                         MSG_NOSIGNAL);
+      if (n <= 0)
+        return false;
+      sent += static_cast<size_t>(n);
+    }
+    return true;
+  }
+
+  std::atomic<uint64_t> requests_{0};
+  std::atomic<uint64_t> bytes_in_{0};
+
+private:
+  void AcceptLoop() {
+    while (running_) {
+      int fd = ::accept(listen_fd_, nullptr, nullptr);
+      if (fd < 0)
+        continue;
+      std::lock_guard<std::mutex> lock(mutex_);
+      client_fds_.push_back(fd);
+      client_threads_.emplace_back([this, fd]() {
+        std::string buffer;
+        char chunk[64 * 1024];
+        while (running_) {
+          ssize_t n = ::recv(fd, chunk, sizeof(chunk), 0);
+          if (n <= 0)
+            break;
+          bytes_in_.fetch_add(static_cast<uint64_t>(n));
+          buffer.append(chunk, static_cast<size_t>(n));
+          if (!Serve(fd, buffer))
+            break;
+        }
+        ::close(fd);
+      });
+    }
+  }
+
+  int listen_fd_ = -1;
+  int port_ = 0;
+  std::atomic<bool> running_{false};
+  std::thread accept_thread_;
+  std::mutex mutex_;
+  std::vector<int> client_fds_;
+  std::vector<std::thread> client_threads_;
+};
+
+/**
+ * @brief 스텁에 남은 키 공간 크기
+ * @details estimated_bytes는 실제 Redis 7 기본 설정을 흉내 낸 근사치:
+ *          최상위 키마다 ~72B (dictEntry + robj + sds 헤더 + expires 항목),
+ *          listpack 해시(필드 128개 이하) 필드마다 ~4B, 그보다 크면 ~56B.
+ */
+struct KeyspaceFootprint {
+  uint64_t keys = 0;
+  uint64_t hash_fields = 0;
+  uint64_t payload_bytes = 0; // 키 + 필드 + 값 바이트
+  uint64_t estimated_bytes = 0;
+};
+
+/**
+ * @brief RESP 스텁: 명령 이름에 맞는 최소 응답 (값 조회는 모두 nil/빈 배열)
+ */
+class RespStubServer : public LoopbackServer {
+public:
+  ~RespStubServer() override { Stop(); }
+
+  KeyspaceFootprint Footprint() const {
+    static constexpr uint64_t kKeyOverhead = 72;
+    static constexpr uint64_t kListpackFieldOverhead = 4;
+    static constexpr uint64_t kHashtableFieldOverhead = 56;
+    static constexpr size_t kListpackMaxEntries = 128;
+
+    std::lock_guard<std::mutex> lock(keyspace_mutex_);
+    KeyspaceFootprint fp;
+    for (const auto &[key, entry] : keyspace_) {
+      fp.keys++;
+      uint64_t bytes = key.size() + entry.value_bytes;
+      for (const auto &[field, size] : entry.fields)
+        bytes += field.size() + size;
+      const uint64_t field_overhead = entry.fields.size() > kListpackMaxEntries
+                                          ? kHashtableFieldOverhead
+                                          : kListpackFieldOverhead;
+      fp.hash_fields += entry.fields.size();
+      fp.payload_bytes += bytes;
+      fp.estimated_bytes +=
+          bytes + kKeyOverhead + field_overhead * entry.fields.size();
+    }
+    return fp;
+  }
+
+protected:
+  bool Serve(int fd, std::string &buffer) override {
+    std::string out;
+    size_t pos = 0;
+    std::vector<std::string> args;
+    while (ParseCommand(buffer, pos, args)) {
+      requests_.fetch_add(1, std::memory_order_relaxed);
+      Track(args);
+      out += Reply(args);
+    }
+    buffer.erase(0, pos);
+    return out.empty() || WriteAll(fd, out);
+  }
+
+private:
+  // 완전한 명령 하나를 파싱하면 pos를 전진시키고 true
+  static bool ParseCommand(const std::string &buf, size_t &pos,
+                           std::vector<std::string> &args) {
+    args.clear();
+    size_t p = pos;
+    if (p >= buf.size())
+      return false;
+
+    if (buf[p] != '*') { // 인라인 명령 (PING\r\n)
+      size_t eol = buf.find("\r\n", p);
+      if (eol == std::string::npos)
+        return false;
+      std::istringstream in(buf.substr(p, eol - p));
+      for (std::string word; in >> word;)
+        args.push_back(word);
+      pos = eol + 2;
+      return true;
+    }
+
+    size_t eol = buf.find("\r\n", p);
+    if (eol == std::string::npos)
+      return false;
+    const long count = std::strtol(buf.c_str() + p + 1, nullptr, 10);
+    p = eol + 2;
+    for (long i = 0; i < count; ++i) {
+      if (p >= buf.size() || buf[p] != '$')
+        return false;
+      eol = buf.find("\r\n", p);
+      if (eol == std::string::npos)
+        return false;
+      const long len = std::strtol(buf.c_str() + p + 1, nullptr, 10);
+      p = eol + 2;
+      if (len < 0 || p + static_cast<size_t>(len) + 2 > buf.size())
+        return false;
+      args.emplace_back(buf, p, static_cast<size_t>(len));
+      p += static_cast<size_t>(len) + 2;
+    }
+    pos = p;
+    return true;
+  }
+
+  struct KeyEntry {
+    size_t value_bytes = 0;                         // 문자열 값
+    std::unordered_map<std::string, size_t> fields; // 해시 필드 → 값 크기
+  };
+
+  // 값을 남기는 명령만 반영 (크기만 기록)
+  void Track(const std::vector<std::string> &args) {
+    if (args.size() < 2)
+      return;
+    std::string cmd = args[0];
+    std::transform(cmd.begin(), cmd.end(), cmd.begin(), ::toupper);
+
+    std::lock_guard<std::mutex> lock(keyspace_mutex_);
+    if (cmd == "SET" && args.size() >= 3) {
+      keyspace_[args[1]] = KeyEntry{args[2].size(), {}};
+    } else if (cmd == "SETEX" && args.size() >= 4) {
+      keyspace_[args[1]] = KeyEntry{args[3].size(), {}};
+    } else if (cmd == "HSET" || cmd == "HMSET") {
+      auto &entry = keyspace_[args[1]];
+      for (size_t i = 2; i + 1 < args.size(); i += 2)
+        entry.fields[args[i]] = args[i + 1].size();
+    } else if (cmd == "DEL") {
+      for (size_t i = 1; i < args.size(); ++i)
+        keyspace_.erase(args[i]);
+    }
+  }
+
+  static std::string Reply(const std::vector<std::string> &args) {
+    if (args.empty())
+      return "-ERR empty command\r\n";
+    std::string cmd = args[0];
+    std::transform(cmd.begin(), cmd.end(), cmd.begin(), ::toupper);
+
+    if (cmd == "PING")
+      return "+PONG\r\n";
+    if (cmd == "GET" || cmd == "HGET" || cmd == "LPOP" || cmd == "RPOP")
+      return "$-1\r\n";
+    if (cmd == "HGETALL" || cmd == "KEYS" || cmd == "SMEMBERS" ||
+        cmd == "LRANGE" || cmd == "MGET" || cmd == "HMGET" ||
+        cmd == "ZRANGE" || cmd == "SCAN" || cmd == "EXEC")
+      return cmd == "SCAN" ? "*2\r\n$1\r\n0\r\n*0\r\n" : "*0\r\n";
+    if (cmd == "HSET" || cmd == "HDEL" || cmd == "DEL" || cmd == "EXISTS" ||
+        cmd == "PUBLISH" || cmd == "EXPIRE" || cmd == "LPUSH" ||
+        cmd == "RPUSH" || cmd == "SADD" || cmd == "SREM" || cmd == "INCR" ||
+        cmd == "INCRBY" || cmd == "ZADD" || cmd == "LLEN" || cmd == "TTL" ||
+        cmd == "HLEN" || cmd == "HEXISTS" || cmd == "DBSIZE")
+      return ":1\r\n";
+    return "+OK\r\n";
+  }
+
+  mutable std::mutex keyspace_mutex_;
+  std::unordered_map<std::string, KeyEntry> keyspace_;
+};
+
+/**
+ * @brief InfluxDB HTTP 스텁: /health는 200, 쓰기는 204
+ */
+class InfluxStubServer : public LoopbackServer {
+public:
+  ~InfluxStubServer() override { Stop(); }
+
+protected:
+  bool Serve(int fd, std::string &buffer) override {
+    while (true) {
+      size_t header_end = buffer.find("\r\n\r\n");
+      if (header_end == std::string::npos)
+        return true;
+      const std::string header = buffer.substr(0, header_end);
+      std::string lower = header;
+      std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+
+      size_t content_length = 0;
+      size_t cl = lower.find("content-length:");
+      if (cl != std::string::npos)
+        content_length = std::strtoul(lower.c_str() + cl + 15, nullptr, 10);
+
+      if (lower.find("expect: 100-continue") != std::string::npos &&
+          buffer.size() < header_end + 4 + content_length && !continued_) {
+        continued_ = true;
+        if (!WriteAll(fd, "HTTP/1.1 100 Continue\r\n\r\n"))
+          return false;
+      }
+      if (buffer.size() < header_end + 4 + content_length)
+        return true;
+
+      continued_ = false;
+      requests_.fetch_add(1, std::memory_order_relaxed);
+      buffer.erase(0, header_end + 4 + content_length);
+
+      const bool health = header.compare(0, 11, "GET /health") == 0 ||
+                          header.compare(0, 9, "GET /ping") == 0;
+      const std::string response =
+          health ? "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n"
+                   "Content-Length: 17\r\n\r\n{\"status\":\"pass\"}"
+                 : "HTTP/1.1 204 No Content\r\nContent-Length: 0\r\n\r\n";
+      if (!WriteAll(fd, response))
+        return false;
+    }
+  }
+
+private:
+  // 연결마다 스레드 하나이므로 연결별 상태로 쓸 수 있다
+  thread_local static bool continued_;
+};
+
+thread_local bool InfluxStubServer::continued_ = false;
+
+// =============================================================================
+// 합성 디바이스
+// =============================================================================
+
+enum class SynthType : uint8_t { FLOAT64, FLOAT32, INT32, UINT16, BOOL, TEXT };
+
+struct SynthPoint {
+  int point_id = 0;
+  SynthType type = SynthType::FLOAT64;
+  double value = 0.0;
+  bool has_rule = false;
+};
+
+struct SynthDevice {
+  std::string device_id;
+  std::vector<SynthPoint> points;
+  std::mt19937 rng;
+};
+
+SynthType PickType(std::mt19937 &rng) {
+  // 실제 현장 비율에 가깝게: 아날로그 위주, 디지털/정수 일부, 문자열 소수
+  const int r = static_cast<int>(rng() % 100);
+  if (r < 40)
+    return SynthType::FLOAT64;
+  if (r < 55)
+    return SynthType::FLOAT32;
+  if (r < 70)
+    return SynthType::INT32;
+  if (r < 80)
+    return SynthType::UINT16;
+  if (r < 95)
+    return SynthType::BOOL;
+  return SynthType::TEXT;
+}
+
+std::vector<SynthDevice> BuildDevices(const BenchOptions &opt) {
+  std::vector<SynthDevice> devices(opt.devices);
+  std::mt19937 layout_rng(opt.seed);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+  for (size_t d = 0; d < opt.devices; ++d) {
+    auto &device = devices[d];
+    device.device_id = std::to_string(d + 1);
+    device.rng.seed(opt.seed + static_cast<uint32_t>(d) * 7919u);
+    device.points.resize(opt.points);
+    for (size_t p = 0; p < opt.points; ++p) {
+      auto &point = device.points[p];
+      point.point_id = static_cast<int>(d * opt.points + p + 1);
+      point.type = PickType(layout_rng);
+      point.value = unit(layout_rng) * 100.0;
+      point.has_rule = point.type != SynthType::TEXT &&
+                       point.type != SynthType::BOOL &&
+                       unit(layout_rng) < opt.alarm_density;
+    }
+  }
+  return devices;
+}
+
+Structs::DataValue ToDataValue(const SynthPoint &point) {
+  switch (point.type) {
+  case SynthType::FLOAT64:
+    return point.value;
+  case SynthType::FLOAT32:
+    return static_cast<float>(point.value);
+  case SynthType::INT32:
+    return static_cast<int32_t>(point.value);
+  case SynthType::UINT16:
+    return static_cast<uint16_t>(point.value);
+  case SynthType::BOOL:
+    return point.value >= 50.0;
+  case SynthType::TEXT:
+    return std::string("state-") + std::to_string(static_cast<int>(point.value) % 8);
+  }
+  return point.value;
+}
+
+Structs::DeviceDataMessage NextMessage(SynthDevice &device, double change_rate,
+                                       int tenant_id) {
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  std::normal_distribution<double> step(0.0, 5.0);
+
+  Structs::DeviceDataMessage message;
+  message.device_id = device.device_id;
+  message.protocol = "bench";
+  message.tenant_id = tenant_id;
+  message.device_status = Enums::DeviceStatus::ONLINE;
+  message.timestamp = std::chrono::system_clock::now();
+  message.points.reserve(device.points.size());
+
+  for (auto &point : device.points) {
+    const bool changed = unit(device.rng) < change_rate;
+    if (changed)
+      point.value = std::clamp(point.value + step(device.rng), 0.0, 100.0);
+
+    Structs::TimestampedValue tv;
+    tv.point_id = point.point_id;
+    tv.value = ToDataValue(point);
+    tv.timestamp = message.timestamp;
+    tv.quality = Enums::DataQuality::GOOD;
+    tv.value_changed = changed;
+    tv.source = "bench";
+    message.points.push_back(std::move(tv));
+  }
+  return message;
+}
+
+size_t SeedAlarmRules(const std::vector<SynthDevice> &devices, int tenant_id) {
+  auto repo = Database::RepositoryFactory::getInstance().getAlarmRuleRepository();
+  if (!repo)
+    return 0;
+
+  std::vector<Database::Entities::AlarmRuleEntity> rules;
+  for (const auto &device : devices) {
+    for (const auto &point : device.points) {
+      if (!point.has_rule)
+        continue;
+      Database::Entities::AlarmRuleEntity rule;
+      rule.setTenantId(tenant_id);
+      rule.setName("bench-high-" + std::to_string(point.point_id));
+      rule.setTargetType(Alarm::TargetType::DATA_POINT);
+      rule.setTargetId(point.point_id);
+      rule.setAlarmType(Alarm::AlarmType::ANALOG);
+      rule.setHighLimit(90.0);
+      rule.setDeadband(1.0);
+      rule.setSeverity(Alarm::AlarmSeverity::MEDIUM);
+      rule.setEnabled(true);
+      rules.push_back(std::move(rule));
+    }
+  }
+  return rules.empty() ? 0 : static_cast<size_t>(repo->saveBulk(rules));
+}
+
+// =============================================================================
+// 부하 실행
+// =============================================================================
+
+void Produce(std::vector<SynthDevice> &devices, const BenchOptions &opt,
+             size_t rounds, int tenant_id) {
+  auto &pipeline = Pipeline::PipelineManager::getInstance();
+  std::vector<std::thread> producers;
+
+  for (size_t t = 0; t < opt.producers; ++t) {
+    producers.emplace_back([&, t]() {
+      for (size_t round = 0; round < rounds; ++round) {
+        for (size_t d = t; d < devices.size(); d += opt.producers) {
+          auto message = NextMessage(devices[d], opt.change_rate, tenant_id);
+          // 실제 워커처럼 혼잡하면 잠시 물러난다 (드롭 없이 전량 측정)
+          while (!pipeline.PushMessage(std::move(message))) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+          }
+        }
+      }
+    });
+  }
+  for (auto &p : producers)
+    p.join();
+}
+
+bool WaitForDrain(const Pipeline::DataProcessingService &service,
+                  uint64_t target, int timeout_sec) {
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(timeout_sec);
+  while (std::chrono::steady_clock::now() < deadline) {
+    auto stats = service.GetStatistics();
+    if (stats.total_messages_processed.load() +
+            stats.processing_errors.load() >=
+        target)
+      return true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+  return false;
+}
+
+std::string MakeTempDir() {
+  std::string pattern =
+      (fs::temp_directory_path() / "pulseone-bench-XXXXXX").string();
+  std::vector<char> buf(pattern.begin(), pattern.end());
+  buf.push_back('\0');
+  return ::mkdtemp(buf.data()) ? std::string(buf.data()) : std::string();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  BenchOptions opt;
+  if (!ParseOptions(argc, argv, opt))
+    return 1;
+
+  const std::string work_dir = MakeTempDir();
+  if (work_dir.empty()) {
+    std::cerr << "failed to create temp directory\n";
+    return 1;
+  }
+
+  RespStubServer redis_stub;
+  InfluxStubServer influx_stub;
+  if (!redis_stub.Start() || !influx_stub.Start()) {
+    std::cerr << "failed to start loopback stubs\n";
+    return 1;
+  }
+
+  const int tenant_id = 1;
+  ::setenv("PULSEONE_CONFIG_DIR", work_dir.c_str(), 1);
+  const std::string influx_url =
+      "http://127.0.0.1:" + std::to_string(influx_stub.Port());
+  ::setenv("INFLUX_URL", influx_url.c_str(), 1);
+
+  auto &config = ConfigManager::getInstance();
+  config.initialize();
+  config.set("DATABASE_TYPE", "SQLITE");
+  config.set("SQLITE_PATH", work_dir + "/bench.db");
+  config.set("REDIS_PRIMARY_ENABLED", "true");
+  config.set("REDIS_PRIMARY_HOST", "127.0.0.1");
+  config.set("REDIS_PRIMARY_PORT", std::to_string(redis_stub.Port()));
+  config.set("PIPELINE_SPILL_ENABLED", "false");
+  config.set("REDIS_STORAGE_LAYOUT", opt.redis_layout);
+  config.set("REDIS_POOL_SIZE", std::to_string(opt.redis_pool));
+  config.set("REDIS_BINARY_FAMILIES", opt.redis_binary);
+  config.set("REDIS_ASYNC_ENABLED", opt.redis_async ? "true" : "false");
+  config.set("TENANT_ID", std::to_string(tenant_id));
+
+  if (!opt.verbose) {
+    LogManager::getInstance().setLogLevel(LogLevel::WARN);
+    LogManager::getInstance().setConsoleOutput(false);
+  }
+
+  if (!Database::RepositoryFactory::getInstance().initialize()) {
+    std::cerr << "RepositoryFactory initialization failed\n";
+    return 1;
+  }
+
+  auto devices = BuildDevices(opt);
+  const size_t rules = SeedAlarmRules(devices, tenant_id);
+
+  auto &pipeline = Pipeline::PipelineManager::getInstance();
+  pipeline.initialize();
+
+  Pipeline::DataProcessingService service;
+  service.SetThreadCount(opt.threads);
+  if (!service.Start()) {
+    std::cerr << "DataProcessingService failed to start\n";
+    return 1;
+  }
+
+  // 워밍업: 커넥션, 포인트 인덱스, 알람 규칙 캐시를 채운다
+  if (opt.warmup > 0) {
+    Produce(devices, opt, opt.warmup, tenant_id);
+    WaitForDrain(service, opt.devices * opt.warmup, opt.timeout_sec);
+  }
+
+  const uint64_t base_processed =
+      service.GetStatistics().total_messages_processed.load() +
+      service.GetStatistics().processing_errors.load();
+  auto &metrics = Pipeline::PipelineMetrics::getInstance();
+  metrics.Reset();
+  const uint64_t redis_base = redis_stub.Requests();
+  const uint64_t redis_bytes_base = redis_stub.BytesIn();
+  const uint64_t influx_base = influx_stub.Requests();
+  const uint64_t alloc_base = g_allocations.load();
+  const uint64_t alloc_bytes_base = g_allocated_bytes.load();
+
+  const auto started = std::chrono::steady_clock::now();
+  Produce(devices, opt, opt.samples, tenant_id);
+  const uint64_t measured_messages = opt.devices * opt.samples;
+  const bool drained =
+      WaitForDrain(service, base_processed + measured_messages, opt.timeout_sec);
+  const auto finished = std::chrono::steady_clock::now();
+
+  const uint64_t allocations = g_allocations.load() - alloc_base;
+  const uint64_t allocated_bytes = g_allocated_bytes.load() - alloc_bytes_base;
+  const auto stats = service.GetStatistics();
+  const uint64_t processed = stats.total_messages_processed.load() +
+                             stats.processing_errors.load() - base_processed;
+
+  service.Stop();
+  pipeline.Shutdown();
+  const uint64_t redis_bytes = redis_stub.BytesIn() - redis_bytes_base;
+  const KeyspaceFootprint footprint = redis_stub.Footprint();
+  redis_stub.Stop();
+  influx_stub.Stop();
+
+  const double seconds =
+      std::chrono::duration<double>(finished - started).count();
+  const uint64_t points = processed * opt.points;
+  const auto e2e =
+      metrics.Get(Pipeline::PipelineMetrics::END_TO_END, "bench").TakeSnapshot();
+  const double msgs_per_sec = seconds > 0 ? processed / seconds : 0.0;
+  const double points_per_sec = seconds > 0 ? points / seconds : 0.0;
+  const double allocs_per_point =
+      points > 0 ? static_cast<double>(allocations) / points : 0.0;
+
+  if (opt.json) {
+    nlohmann::json result;
+    result["devices"] = opt.devices;
+    result["points_per_device"] = opt.points;
+    result["samples"] = opt.samples;
+    result["change_rate"] = opt.change_rate;
+    result["alarm_rules"] = rules;
+    result["threads"] = opt.threads;
+    result["seed"] = opt.seed;
+    result["drained"] = drained;
+    result["messages"] = processed;
+    result["seconds"] = seconds;
+    result["msgs_per_sec"] = msgs_per_sec;
+    result["points_per_sec"] = points_per_sec;
+    result["allocs_per_point"] = allocs_per_point;
+    result["alloc_bytes_per_point"] =
+        points > 0 ? static_cast<double>(allocated_bytes) / points : 0.0;
+    result["redis_layout"] = opt.redis_layout;
+    result["redis_pool"] = opt.redis_pool;
+    result["redis_binary"] = opt.redis_binary;
+    result["redis_async"] = opt.redis_async;
+    result["redis_commands"] = redis_stub.Requests() - redis_base;
+    result["redis_bytes_in"] = redis_bytes;
+    result["redis_keys"] = footprint.keys;
+    result["redis_hash_fields"] = footprint.hash_fields;
+    result["redis_payload_bytes"] = footprint.payload_bytes;
+    result["redis_estimated_bytes"] = footprint.estimated_bytes;
+    result["influx_requests"] = influx_stub.Requests() - influx_base;
+    result["processing_errors"] = stats.processing_errors.load();
+    result["latency"] = metrics.ToJson();
+    std::cout << result.dump() << std::endl;
+  } else {
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "=== PulseOne pipeline benchmark ===\n"
+              << "devices=" << opt.devices << " points=" << opt.points
+              << " samples=" << opt.samples
+              << " change_rate=" << opt.change_rate
+              << " alarm_rules=" << rules << " threads=" << opt.threads
+              << " seed=" << opt.seed << "\n"
+              << "messages:        " << processed << (drained ? "" : " (TIMEOUT)")
+              << " in " << seconds << " s\n"
+              << "throughput:      " << msgs_per_sec << " msgs/s, "
+              << points_per_sec << " points/s\n"
+              << "end-to-end (ms): p50=" << e2e.p50_us / 1000.0
+              << " p90=" << e2e.p90_us / 1000.0
+              << " p99=" << e2e.p99_us / 1000.0
+              << " p999=" << e2e.p999_us / 1000.0
+              << " max=" << e2e.max_us / 1000.0 << "\n"
+              << "allocations:     " << allocs_per_point << " per point ("
+              << (points > 0 ? static_cast<double>(allocated_bytes) / points
+                             : 0.0)
+              << " bytes)\n"
+              << "redis commands:  " << redis_stub.Requests() - redis_base
+              << ", influx requests: " << influx_stub.Requests() - influx_base
+              << "\n"
+              << "redis layout:    " << opt.redis_layout
+              << ", pool=" << opt.redis_pool << ", binary="
+              << (opt.redis_binary.empty() ? "none" : opt.redis_binary)
+              << ", async=" << (opt.redis_async ? "on" : "off") << ", "
+              << redis_bytes / 1024.0 << " KiB sent\n"
+              << "redis keyspace:  " << footprint.keys << " keys, "
+              << footprint.hash_fields << " hash fields, "
+              << footprint.payload_bytes / 1024.0 << " KiB payload, ~"
+              << footprint.estimated_bytes / 1024.0 << " KiB estimated\n";
+  }
+
+  std::error_code ec;
+  fs::remove_all(work_dir, ec);
+  return drained ? 0 : 2;
+}
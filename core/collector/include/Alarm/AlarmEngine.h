@@ -71,6 +71,12 @@ public:
   std::vector<AlarmEvent> evaluateForMessage(const DeviceDataMessage &message);
   std::vector<AlarmEvent> evaluateForPoint(int tenant_id,
                                            const TimestampedValue &tv);
+  /**
+   * @brief 배치 평가 - 상태 갱신/규칙 조회 잠금을 배치당 한 번만 잡음
+   * @return messages와 같은 순서의 메시지별 이벤트 목록
+   */
+  std::vector<std::vector<AlarmEvent>>
+  evaluateForMessages(const std::vector<const DeviceDataMessage *> &messages);
 
   // 개별 규칙 평가
   AlarmEvaluation evaluateRule(const AlarmRuleEntity &rule,
@@ -132,6 +138,10 @@ private:
   // =======================================================================
   // 헬퍼 메서드들
   // =======================================================================
+  // 이미 조회된 규칙으로 포인트 하나를 평가 (evaluateForPoint/배치 공용)
+  std::vector<AlarmEvent>
+  evaluateRulesForPoint(int tenant_id, const TimestampedValue &tv,
+                        const std::vector<AlarmRuleEntity> &rules);
   std::string generateMessage(const AlarmRuleEntity &rule,
                               const AlarmEvaluation &eval,
                               const DataValue &value);
@@ -148,7 +158,7 @@ private:
 
   // 유틸리티
   int getDeviceIdForPoint(int point_id);
-  std::string getPointName(int point_id);
+  std::string getPointName(int point_id, bool is_virtual);
   std::string getPointLocation(int point_id);
   AlarmType convertToAlarmType(const AlarmRuleEntity::AlarmType &entity_type);
   TriggerCondition determineTriggerCondition(const AlarmRuleEntity &rule,
@@ -186,11 +196,6 @@ private:
 
   std::unordered_map<int, std::vector<AlarmRuleEntity>> tenant_rules_;
   std::unordered_map<std::string, std::vector<int>> point_rule_index_;
-  std::unordered_map<int, bool> alarm_states_;
-  std::unordered_map<int, double> last_values_;
-  std::unordered_map<int, bool> last_digital_states_;
-  std::unordered_map<int, std::chrono::system_clock::time_point>
-      last_check_times_;
   std::unordered_map<int, int64_t> rule_occurrence_map_;
   std::unordered_map<int, int> point_device_cache_;
   std::unordered_map<int, std::string> point_name_cache_;
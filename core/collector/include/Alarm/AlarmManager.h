@@ -65,6 +65,14 @@ public:
      */
     std::vector<AlarmEvent> evaluateForMessage(const DeviceDataMessage& msg);
     
+    /**
+     * @brief 배치 알람 평가 (파이프라인 AlarmStage용)
+     * @param messages 평가할 메시지들
+     * @return messages와 같은 순서의 메시지별 강화된 알람 이벤트
+     */
+    std::vector<std::vector<AlarmEvent>> evaluateForMessages(
+        const std::vector<const DeviceDataMessage*>& messages);
+    
     // =======================================================================
     // 🎯 알람 규칙 관리
     // =======================================================================
@@ -19,6 +19,9 @@ public:
   void loadRules(int tenant_id = 0);
   std::vector<Database::Entities::AlarmRuleEntity>
   getRulesForPoint(int tenant_id, int point_id) const;
+  // 배치용: 한 번의 잠금으로 여러 포인트의 규칙 조회 (point_ids와 같은 순서)
+  std::vector<std::vector<Database::Entities::AlarmRuleEntity>>
+  getRulesForPoints(int tenant_id, const std::vector<int> &point_ids) const;
   std::vector<Database::Entities::AlarmRuleEntity>
   getAllRules(int tenant_id = 0) const;
   bool isTenantLoaded(int tenant_id) const;
@@ -1,11 +1,14 @@
 #ifndef ALARM_STATE_CACHE_H
 #define ALARM_STATE_CACHE_H
 
+#include <array>
 #include <unordered_map>
 #include <shared_mutex>
 #include <chrono>
 #include <optional>
+#include <vector>
 #include "Common/Structs.h"
+#include "Pipeline/PointIndexRegistry.h"
 
 namespace PulseOne {
 namespace Alarm {
@@ -24,14 +27,24 @@ public:
     };
 
     void updatePointState(int point_id, const PulseOne::Structs::DataValue& value);
+    // 배치용: 여러 포인트 상태 갱신 (순서대로 적용)
+    void updatePointStates(const std::vector<const PulseOne::Structs::TimestampedValue*>& values);
     PointState getPointState(int point_id) const;
 
     void setAlarmStatus(int rule_id, bool active, int64_t occurrence_id = 0);
     AlarmStatus getAlarmStatus(int rule_id) const;
 
 private:
+    // 포인트 상태: 밀집 인덱스 배열 + 인덱스 기반 스트라이프 락
+    static constexpr size_t POINT_LOCK_STRIPES = 64;
+    std::shared_mutex& pointLock(uint32_t index) const {
+        return point_locks_[index % POINT_LOCK_STRIPES];
+    }
+
+    mutable std::array<std::shared_mutex, POINT_LOCK_STRIPES> point_locks_;
+    Pipeline::PointStateArray<PointState> point_states_;
+
     mutable std::shared_mutex state_mutex_;
-    std::unordered_map<int, PointState> point_states_;
     std::unordered_map<int, AlarmStatus> alarm_statuses_;
 };
 
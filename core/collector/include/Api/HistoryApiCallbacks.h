@@ -0,0 +1,49 @@
+// =============================================================================
+// collector/include/Api/HistoryApiCallbacks.h
+// 내장 엣지 시계열 저장소 이력 조회 REST API 콜백 설정
+// =============================================================================
+
+#ifndef API_HISTORY_CALLBACKS_H
+#define API_HISTORY_CALLBACKS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+
+namespace PulseOne {
+namespace Network {
+    class RestApiServer;
+}
+}
+
+namespace PulseOne {
+namespace Api {
+
+/**
+ * @brief 포인트 이력 조회 REST API 콜백 설정 클래스
+ */
+class HistoryApiCallbacks {
+public:
+    /**
+     * @brief RestApiServer에 이력 조회 콜백을 등록
+     * @param server RestApiServer 인스턴스
+     */
+    static void Setup(Network::RestApiServer* server);
+
+private:
+    HistoryApiCallbacks() = delete;
+
+    /**
+     * @brief 포인트 이력 조회
+     * @param step_ms 0이면 원시 샘플(최대 limit개), 아니면 구간 집계
+     * @return 샘플/버킷 목록 JSON (저장소 비활성 시 "error" 포함)
+     */
+    static nlohmann::json QueryPointHistory(int point_id, int64_t from_ms,
+                                            int64_t to_ms, int64_t step_ms,
+                                            size_t limit);
+};
+
+} // namespace Api
+} // namespace PulseOne
+
+#endif // API_HISTORY_CALLBACKS_H
@@ -0,0 +1,45 @@
+// =============================================================================
+// collector/include/Api/SystemApiCallbacks.h
+// 시스템 통계 / Prometheus 메트릭 REST API 콜백 설정
+// =============================================================================
+
+#ifndef API_SYSTEM_CALLBACKS_H
+#define API_SYSTEM_CALLBACKS_H
+
+#include <nlohmann/json.hpp>
+#include <string>
+
+namespace PulseOne {
+namespace Network {
+    class RestApiServer;
+}
+}
+
+namespace PulseOne {
+namespace Api {
+
+/**
+ * @brief 시스템 통계 관련 REST API 콜백 설정 클래스
+ * @details /api/system/stats (JSON) 와 /metrics (Prometheus 텍스트)
+ */
+class SystemApiCallbacks {
+public:
+    /**
+     * @brief RestApiServer에 시스템 통계 관련 콜백들을 등록
+     * @param server RestApiServer 인스턴스
+     */
+    static void Setup(Network::RestApiServer* server);
+
+private:
+    SystemApiCallbacks() = delete;
+
+    /**
+     * @brief 파이프라인 큐 상태 + 지연 분포(p50/p99/p999)
+     */
+    static nlohmann::json GetSystemStats();
+};
+
+} // namespace Api
+} // namespace PulseOne
+
+#endif // API_SYSTEM_CALLBACKS_H
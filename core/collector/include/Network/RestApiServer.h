@@ -56,6 +56,11 @@ public:
   using ReloadConfigCallback = std::function<bool()>;
   using ReinitializeCallback = std::function<bool()>;
   using SystemStatsCallback = std::function<nlohmann::json()>;
+  using MetricsCallback = std::function<std::string()>; // Prometheus 텍스트
+  // 포인트 이력 조회 (step_ms == 0이면 원시 샘플, 아니면 구간 집계)
+  using HistoryQueryCallback = std::function<nlohmann::json(
+      int point_id, int64_t from_ms, int64_t to_ms, int64_t step_ms,
+      size_t limit)>;
   using DeviceControlCallback = std::function<bool(const std::string &)>;
   using DeviceListCallback = std::function<nlohmann::json()>;
   using DeviceStatusCallback =
@@ -120,6 +125,8 @@ public:
   void SetDeviceListCallback(DeviceListCallback callback);
   void SetDeviceStatusCallback(DeviceStatusCallback callback);
   void SetSystemStatsCallback(SystemStatsCallback callback);
+  void SetMetricsCallback(MetricsCallback callback);
+  void SetHistoryQueryCallback(HistoryQueryCallback callback);
   void SetDiagnosticsCallback(DiagnosticsCallback callback);
   void SetWorkerStatusCallback(WorkerStatusCallback callback);
 
@@ -170,6 +177,9 @@ private:
                               httplib::Response &res);
   void HandleGetSystemStats(const httplib::Request &req,
                             httplib::Response &res);
+  void HandleGetMetrics(const httplib::Request &req, httplib::Response &res);
+  void HandleGetPointHistory(const httplib::Request &req,
+                             httplib::Response &res);
   void HandlePostDiagnostics(const httplib::Request &req,
                              httplib::Response &res);
 
@@ -331,6 +341,8 @@ private:
   DeviceListCallback device_list_callback_;
   DeviceStatusCallback device_status_callback_;
   SystemStatsCallback system_stats_callback_;
+  MetricsCallback metrics_callback_;
+  HistoryQueryCallback history_query_callback_;
   DiagnosticsCallback diagnostics_callback_;
   WorkerStatusCallback worker_status_callback_;
 
@@ -0,0 +1,103 @@
+// =============================================================================
+// collector/include/Pipeline/CurrentValueDirtySet.h - 현재값 변경 집합
+// 🔥 마지막 RDB 동기화 이후 바뀐 포인트와 그 최신값을 메모리에 보관.
+//    주기 동기화는 Redis 전체 스캔 대신 바뀐 행만 저장
+// =============================================================================
+
+#ifndef PULSEONE_PIPELINE_CURRENT_VALUE_DIRTY_SET_H
+#define PULSEONE_PIPELINE_CURRENT_VALUE_DIRTY_SET_H
+
+#include "Common/Structs.h"
+#include "Pipeline/PointIndexRegistry.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace PulseOne {
+namespace Pipeline {
+
+/**
+ * @brief 동기화 대기 중인 현재값 집합
+ * @details
+ * - 포인트별 최신값은 PointIndexRegistry 밀집 인덱스로 PointStateArray에
+ *   두고, 슬롯마다 짧은 스핀락으로 값 교체를 보호한다.
+ * - 슬롯이 깨끗→더러움으로 바뀔 때만 인덱스를 샤드 목록에 넣으므로 같은
+ *   포인트가 여러 번 갱신돼도 목록에는 한 번만 들어간다.
+ * - Drain()은 샤드 목록을 통째로 교체해 가져가므로 처리 스레드의 Mark()와
+ *   경합하는 구간은 목록 swap과 슬롯 하나 복사뿐이다.
+ */
+class CurrentValueDirtySet {
+public:
+  struct Entry {
+    int point_id = 0;
+    Structs::DataValue value;
+    Structs::Timestamp timestamp;
+    Structs::DataQuality quality = Structs::DataQuality::GOOD;
+  };
+
+  CurrentValueDirtySet() = default;
+
+  CurrentValueDirtySet(const CurrentValueDirtySet &) = delete;
+  CurrentValueDirtySet &operator=(const CurrentValueDirtySet &) = delete;
+
+  /**
+   * @brief 최신값 기록 + 변경 표시 (처리 스레드)
+   */
+  void Mark(const Structs::TimestampedValue &point);
+
+  /**
+   * @brief 변경된 포인트의 최신값을 모두 꺼내고 깨끗한 상태로 되돌림
+   * @return out에 추가된 항목 수
+   */
+  size_t Drain(std::vector<Entry> &out);
+
+  /**
+   * @brief 저장에 실패한 항목을 다시 변경 상태로 (그 사이 더 새 값이
+   * 들어온 포인트는 새 값을 유지)
+   */
+  void Requeue(const std::vector<Entry> &entries);
+
+  /**
+   * @brief 동기화 대기 중인 포인트 수 (근사값)
+   */
+  size_t Pending() const { return pending_.load(std::memory_order_relaxed); }
+
+private:
+  static constexpr size_t SHARD_COUNT = 16;
+
+  struct Slot {
+    std::atomic<bool> busy{false};
+    bool dirty = false;
+    Entry entry;
+  };
+
+  class SlotLock {
+  public:
+    explicit SlotLock(Slot &slot) : slot_(slot) {
+      while (slot_.busy.exchange(true, std::memory_order_acquire)) {
+      }
+    }
+    ~SlotLock() { slot_.busy.store(false, std::memory_order_release); }
+
+  private:
+    Slot &slot_;
+  };
+
+  struct Shard {
+    std::mutex mutex;
+    std::vector<uint32_t> indices;
+  };
+
+  void Push(uint32_t index);
+
+  PointStateArray<Slot> slots_;
+  std::array<Shard, SHARD_COUNT> shards_;
+  std::atomic<size_t> pending_{0};
+};
+
+} // namespace Pipeline
+} // namespace PulseOne
+
+#endif // PULSEONE_PIPELINE_CURRENT_VALUE_DIRTY_SET_H
@@ -12,8 +12,13 @@
 #include "Common/Utils.h"
 #include "Database/Entities/CurrentValueEntity.h"
 #include "Logging/LogManager.h"
+#include "Pipeline/CurrentValueDirtySet.h"
 #include "Pipeline/IPersistenceQueue.h"
 #include "Pipeline/IPipelineStage.h"
+#include "Pipeline/PointBatch.h"
+#include "Pipeline/PointIndexRegistry.h"
+#include "Storage/InfluxWriter.h"
+#include "Storage/RollupEngine.h"
 #include "Utils/ThreadSafeQueue.h"
 #include "VirtualPoint/VirtualPointBatchWriter.h"
 #include <atomic>
@@ -51,8 +56,8 @@ using DataValue = PulseOne::Structs::DataValue;
 struct PersistenceTask {
   enum class Type { RDB_SAVE, INFLUX_SAVE, COMM_STATS_SAVE };
   Type type;
-  Structs::DeviceDataMessage message;
-  std::vector<Structs::TimestampedValue> points;
+  Structs::DeviceDataMessage message; // 헤더만 (points는 비어 있음)
+  PointBatch points; // 컬럼형: 포인트별 힙 할당 없이 운반
 };
 
 class DataProcessingService : public IPersistenceQueue {
@@ -130,8 +135,8 @@ public:
   void SetThreadCount(size_t thread_count);
   ServiceConfig GetConfig() const;
 
-  // 메인 처리
-  void ProcessBatch(const std::vector<Structs::DeviceDataMessage> &batch,
+  // 메인 처리 (배치의 메시지는 파이프라인 컨텍스트로 이동됨)
+  void ProcessBatch(std::vector<Structs::DeviceDataMessage> &&batch,
                     size_t thread_index);
 
   // 가상포인트 처리
@@ -228,12 +233,36 @@ public:
   void SetInfluxDbStorageInterval(int interval_ms) {
     influxdb_storage_interval_ms_.store(interval_ms);
   }
+  // 디바이스 친화 모드: device_id 해시로 처리 스레드 고정 (Start 전 설정)
+  // 같은 디바이스 메시지는 한 스레드에서 순서대로 처리되며, 포인트별 상태는
+  // 스레드 소유 슬라이스에 락 없이 보관된다.
+  void SetDeviceAffinityEnabled(bool enable) {
+    device_affinity_enabled_.store(enable);
+  }
+  bool IsDeviceAffinityEnabled() const {
+    return device_affinity_enabled_.load();
+  }
   // RDB 주기 저장 인터벌 설정 (기본 60초)
   void SetRdbSyncInterval(int interval_seconds) {
     rdb_sync_interval_s_.store(interval_seconds);
   }
-  // 종료 전 모든 Redis current_values → SQLite 즉시 동기화
+  // 마지막 동기화 이후 바뀐 current_values만 SQLite에 즉시 저장
+  // (주기 동기화 스레드와 종료 시 호출)
   void FlushCurrentValuesToSQLite();
+  // RDB 동기화 대기 중인 포인트 수
+  size_t GetPendingCurrentValueCount() const {
+    return current_value_dirty_.Pending();
+  }
+  // 비동기 InfluxDB 라이터 통계 (큐/재시도/스풀)
+  Storage::InfluxWriterStats GetInfluxWriterStats() const;
+  // 롤업(1분/15분/1시간) 엔진 통계
+  Storage::RollupStats GetRollupStats() const {
+    return rollup_engine_.GetStats();
+  }
+  // 포인트 메타데이터가 바뀌었을 때 캐시된 Influx 라인 접두사 재생성 요청
+  void InvalidateInfluxLinePrefixes() {
+    influx_prefix_generation_.fetch_add(1, std::memory_order_relaxed);
+  }
 
   // IPersistenceQueue Implementation
   void
@@ -243,10 +272,12 @@ public:
       const Structs::DeviceDataMessage &message,
       const std::vector<Structs::TimestampedValue> &points) override;
   void QueueCommStatsTask(const Structs::DeviceDataMessage &message) override;
+  void QueueBatch(
+      const std::vector<const Structs::DeviceDataMessage *> &messages) override;
 
   // Helper functions
-  std::string getPointName(int point_id) const;
-  std::string getUnit(int point_id) const;
+  std::string getPointName(int point_id, bool is_virtual) const;
+  std::string getUnit(int point_id, bool is_virtual) const;
 
   // Pipeline Helpers
   // InitializePipeline is declared above (line 60)
@@ -255,22 +286,35 @@ private:
   // 스레드 처리
   void ProcessingThreadLoop(size_t thread_index);
   void PersistenceThreadLoop();
-  std::vector<Structs::DeviceDataMessage> CollectBatchFromPipelineManager();
+  std::vector<Structs::DeviceDataMessage>
+  CollectBatchFromPipelineManager(size_t thread_index);
   void HandleError(const std::string &error_message,
                    const std::string &context = "");
 
   // 클라이언트들
   std::unique_ptr<Storage::RedisDataWriter> redis_data_writer_;
   std::shared_ptr<PulseOne::Client::InfluxClient> influx_client_;
+  // InfluxDB 쓰기는 전용 스레드에서 배치/재시도/스풀 (Persistence 스레드 비차단)
+  std::unique_ptr<Storage::InfluxWriter> influx_writer_;
   std::unique_ptr<VirtualPoint::VirtualPointBatchWriter> vp_batch_writer_;
 
   // Persistence Task Processing Helpers
-  void ProcessRDBTasks(const std::vector<PersistenceTask> &rdb_tasks);
+  // RDB는 저장 성공 여부를 반환 → WAL 체크포인트. Influx 태스크의 WAL
+  // 참조는 InfluxWriter가 전송/스풀을 마친 뒤 반환
+  bool ProcessRDBTasks(const std::vector<PersistenceTask> &rdb_tasks);
   void ProcessInfluxTasks(const std::vector<PersistenceTask> &influx_tasks);
   void
   ProcessCommStatsTasks(const std::vector<PersistenceTask> &comm_stats_tasks);
   // 주기 Redis→SQLite 동기화 스레드 루프
   void RdbSyncThreadLoop();
+  // 닫힌 롤업 윈도우 내보내기 + 티어별 보존 기간 정리 (Persistence 스레드)
+  // force(종료 시)면 열린 윈도우는 내보내지 않고 체크포인트
+  void ProcessRollups(bool force);
+  void SaveOpenRollups(const std::vector<Storage::RollupRow> &rows);
+  void RestoreOpenRollups(); // 시작 시 (처리 스레드 시작 전)
+  void WriteRollupsToInflux(const std::vector<Storage::RollupRow> &rows);
+  void WriteRollupsToSQLite(const std::vector<Storage::RollupRow> &rows);
+  void ApplyRetention(std::chrono::system_clock::time_point now);
 
   // Pipeline
   std::vector<std::unique_ptr<IPipelineStage>> pipeline_stages_;
@@ -290,6 +334,7 @@ private:
   std::atomic<bool> alarm_evaluation_enabled_{true};
   std::atomic<bool> virtual_point_calculation_enabled_{true};
   std::atomic<bool> external_notification_enabled_{false};
+  std::atomic<bool> device_affinity_enabled_{false};
 
   // 통계
   std::atomic<size_t> total_batches_processed_{0};
@@ -308,17 +353,50 @@ private:
   std::atomic<size_t> high_alarms_count_{0};
 
   mutable std::mutex processing_mutex_;
-  mutable std::mutex rdb_save_mutex_;
   // 🔒 SQLite 직렬화: ProcessRDBTasks와 FlushCurrentValuesToSQLite가
   // 동시에 executeBatch()  호출 시 SQLITE_BUSY 방지
   mutable std::mutex sqlite_write_mutex_;
-  std::unordered_map<int, std::chrono::steady_clock::time_point>
-      last_rdb_save_times_;
-  mutable std::mutex influxd_save_mutex_;
-  std::unordered_map<int, std::chrono::steady_clock::time_point>
-      last_influxd_save_times_;
+  // 포인트 인덱스별 마지막 RDB 저장 시각 (steady tick, 0 = 없음)
+  PointStateArray<std::atomic<int64_t>> rdb_last_save_ticks_;
+  // 영속화 작업 생성 (단건/배치 공용)
+  bool BuildRDBTask(const Structs::DeviceDataMessage &message,
+                    const std::vector<Structs::TimestampedValue> &points,
+                    PersistenceTask &task);
+  bool BuildInfluxTask(const Structs::DeviceDataMessage &message,
+                       const std::vector<Structs::TimestampedValue> &points,
+                       std::chrono::steady_clock::time_point now,
+                       PersistenceTask &task);
+  // WAL 재투입 메시지 → Influx 저장 태스크만 (스테이지/롤업/통계 없음)
+  void QueueWalRetries(const std::vector<Structs::DeviceDataMessage> &messages);
+  // 포인트 인덱스별 마지막 Influx 저장 시각 (steady tick, 0 = 없음)
+  PointStateArray<std::atomic<int64_t>> influx_last_save_ticks_;
+  // 포인트별 이스케이프 완료된 "device_telemetry,태그... p_<id>=" 접두사
+  // Persistence 스레드 전용 (락 없음). 메시지의 디바이스/프로토콜/테넌트/
+  // 사이트가 달라지거나 세대가 올라가면 다시 만든다.
+  struct InfluxLinePrefix {
+    uint64_t generation = 0;
+    bool is_virtual = false; // 같은 ID의 데이터/가상포인트가 슬롯을 공유
+    int tenant_id = 0;
+    int site_id = 0;
+    std::string device_id;
+    std::string protocol;
+    std::string text;
+  };
+  const std::string &GetInfluxLinePrefix(const Structs::DeviceDataMessage &msg,
+                                         int point_id, bool is_virtual);
+  PointStateArray<InfluxLinePrefix> influx_line_prefixes_;
+  std::atomic<uint64_t> influx_prefix_generation_{1};
+  std::string influx_prefix_scratch_; // 인덱스 등록 실패 시 임시 접두사
+  std::string influx_line_buffer_;    // 재사용 인코딩 버퍼
   std::atomic<int> influxdb_storage_interval_ms_{0};
-  // RDB 주기 동기화: Redis 전체 스캔 → SQLite saveBatch()
+  // 롤업: 처리 스레드가 Add, Persistence 스레드가 Collect
+  Storage::RollupEngine rollup_engine_;
+  std::vector<Storage::RollupRow> rollup_rows_; // 재사용 수집 버퍼
+  std::chrono::steady_clock::time_point next_rollup_flush_{};
+  std::chrono::steady_clock::time_point next_retention_sweep_{};
+  bool rollup_table_ready_ = false;
+  // RDB 주기 동기화: 변경 집합(처리 스레드가 Mark) → SQLite saveBatch()
+  CurrentValueDirtySet current_value_dirty_;
   std::atomic<int> rdb_sync_interval_s_{60}; // 기본 60초
   std::thread rdb_sync_thread_;
   std::chrono::steady_clock::time_point start_time_;
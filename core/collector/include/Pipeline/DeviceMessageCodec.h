@@ -0,0 +1,41 @@
+// =============================================================================
+// collector/include/Pipeline/DeviceMessageCodec.h - 메시지 바이너리 인코딩
+// 🔥 디스크 스필/WAL 레코드 공용 DeviceDataMessage 직렬화
+// =============================================================================
+
+#ifndef PULSEONE_PIPELINE_DEVICE_MESSAGE_CODEC_H
+#define PULSEONE_PIPELINE_DEVICE_MESSAGE_CODEC_H
+
+#include "Common/Structs.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace PulseOne {
+namespace Pipeline {
+namespace DeviceMessageCodec {
+
+/**
+ * @brief 레인 + 메시지를 out 끝에 덧붙임 (리틀 엔디언 고정 폭 + 길이 접두
+ *        문자열, 같은 아키텍처 재시작 간 호환)
+ */
+void Encode(const Structs::DeviceDataMessage &message, uint8_t lane,
+            std::string &out);
+
+/**
+ * @return 길이가 모자라거나 값 형식이 잘못되면 false
+ */
+bool Decode(const uint8_t *data, size_t size,
+            Structs::DeviceDataMessage &message, uint8_t &lane);
+
+/**
+ * @brief FNV-1a 체크섬. seed에 이전 결과를 넘기면 이어서 계산
+ */
+uint32_t Checksum(const uint8_t *data, size_t size,
+                  uint32_t seed = 2166136261u);
+
+} // namespace DeviceMessageCodec
+} // namespace Pipeline
+} // namespace PulseOne
+
+#endif // PULSEONE_PIPELINE_DEVICE_MESSAGE_CODEC_H
@@ -30,6 +30,19 @@ public:
                                 const std::vector<Structs::TimestampedValue>& points) = 0;
                                 
     virtual void QueueCommStatsTask(const Structs::DeviceDataMessage& message) = 0;
+
+    /**
+     * @brief Queue RDB, Influx and comm-stats tasks for a whole batch.
+     * Implementations should take the queue lock once for the batch; the default
+     * falls back to the per-message calls.
+     */
+    virtual void QueueBatch(const std::vector<const Structs::DeviceDataMessage*>& messages) {
+        for (const auto* message : messages) {
+            QueueRDBTask(*message, message->points);
+            QueueInfluxTask(*message, message->points);
+            QueueCommStatsTask(*message);
+        }
+    }
 };
 
 } // namespace PulseOne::Pipeline
@@ -4,7 +4,9 @@
 #define I_PIPELINE_STAGE_H
 
 #include "Pipeline/PipelineContext.h"
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace PulseOne::Pipeline {
 
@@ -21,6 +23,30 @@ public:
      */
     virtual bool Process(PipelineContext& context) = 0;
 
+    /**
+     * @brief Process a whole batch of contexts in one call.
+     * Contexts already halted by an earlier stage must be skipped. Stages that
+     * can amortize locks or I/O across messages override this; the default
+     * simply calls Process() per context. A failure must only halt (and mark
+     * failed) the context that caused it, never its batch-mates.
+     */
+    virtual void ProcessBatch(std::vector<PipelineContext>& batch) {
+        for (auto& context : batch) {
+            if (context.halted) {
+                continue;
+            }
+            try {
+                if (!Process(context)) {
+                    context.halted = true;
+                }
+            } catch (const std::exception& e) {
+                context.error_message = GetName() + ": " + e.what();
+                context.halted = true;
+                context.failed = true;
+            }
+        }
+    }
+
     /**
      * @brief Get the name of the stage for logging/debugging.
      */
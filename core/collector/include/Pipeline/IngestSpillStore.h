@@ -0,0 +1,131 @@
+// =============================================================================
+// collector/include/Pipeline/IngestSpillStore.h - 수집 큐 오버플로우 디스크 스필
+// 🔥 큐가 가득 찼을 때 드롭 대신 mmap 세그먼트 파일에 순서대로 보관
+// =============================================================================
+
+#ifndef PULSEONE_PIPELINE_INGEST_SPILL_STORE_H
+#define PULSEONE_PIPELINE_INGEST_SPILL_STORE_H
+
+#include "Common/Structs.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace PulseOne {
+namespace Pipeline {
+
+/**
+ * @brief 스필 저장소 통계 스냅샷
+ */
+struct IngestSpillStats {
+  bool enabled = false;
+  uint64_t spilled = 0;   // 디스크에 기록된 메시지 수
+  uint64_t replayed = 0;  // 큐로 되돌린 메시지 수
+  uint64_t rejected = 0;  // 용량 한도 초과로 기록 실패
+  uint64_t recovered = 0; // 시작 시 이전 세그먼트에서 복구된 메시지 수
+  uint64_t corrupt = 0;   // 체크섬 불일치로 버린 레코드 수
+  size_t pending = 0;     // 아직 재생되지 않은 메시지 수
+  size_t segments = 0;
+  uint64_t bytes_on_disk = 0;
+  uint64_t max_bytes = 0;
+};
+
+/**
+ * @brief 세그먼트 단위 mmap 디스크 링 (FIFO)
+ * @details
+ * - 고정 크기 세그먼트 파일(spill_<seq>.seg)을 순서대로 채우고,
+ *   가장 오래된 세그먼트부터 읽어 다 읽으면 삭제한다.
+ * - 레코드: [길이 u32][체크섬 u32][레인 u8 + 메시지 바이너리]
+ * - 세그먼트 헤더에 읽기 위치를 기록하므로 재시작 후에도 이미 재생한
+ *   레코드는 다시 재생하지 않는다.
+ * - 세그먼트 수 x 세그먼트 크기가 max_bytes를 넘으면 Append가 실패한다.
+ */
+class IngestSpillStore {
+public:
+  /**
+   * @brief 재생 싱크. false를 반환하면 재생을 멈추고 해당 레코드는 남겨 둔다.
+   */
+  using ReplaySink =
+      std::function<bool(Structs::DeviceDataMessage &&message, uint8_t lane)>;
+
+  IngestSpillStore();
+  ~IngestSpillStore();
+
+  IngestSpillStore(const IngestSpillStore &) = delete;
+  IngestSpillStore &operator=(const IngestSpillStore &) = delete;
+
+  /**
+   * @brief 디렉토리를 열고 기존 세그먼트를 복구
+   * @param directory 세그먼트 파일 위치 (없으면 생성)
+   * @param max_bytes 디스크 사용 한도
+   * @param segment_bytes 세그먼트 파일 크기
+   * @return 성공 여부 (실패 시 비활성 상태 유지)
+   */
+  bool Open(const std::string &directory, uint64_t max_bytes,
+            uint64_t segment_bytes);
+
+  /**
+   * @brief 매핑 해제 (남은 레코드는 파일에 유지되어 다음 Open에서 재생)
+   */
+  void Close();
+
+  bool IsEnabled() const { return enabled_.load(std::memory_order_acquire); }
+  bool HasPending() const {
+    return pending_.load(std::memory_order_acquire) > 0;
+  }
+  size_t PendingCount() const { return pending_.load(); }
+
+  /**
+   * @brief 메시지를 디스크 링 끝에 추가
+   * @return 비활성/용량 초과/레코드가 세그먼트보다 크면 false
+   */
+  bool Append(const Structs::DeviceDataMessage &message, uint8_t lane);
+
+  /**
+   * @brief 가장 오래된 레코드부터 최대 max_items개를 sink로 전달
+   * @details 다른 스레드가 재생 중이면 기다리지 않고 0을 반환한다.
+   * @return sink가 수락한 메시지 수
+   */
+  size_t Replay(const ReplaySink &sink, size_t max_items);
+
+  IngestSpillStats GetStats() const;
+  void ResetStats();
+
+private:
+  struct MappedSegment;
+
+  std::unique_ptr<MappedSegment> CreateSegment(uint64_t seq);
+  std::unique_ptr<MappedSegment> RecoverSegment(const std::string &path,
+                                                uint64_t seq);
+  void RetireFrontSegment();
+  uint64_t MaxSegments() const;
+
+  std::string directory_;
+  uint64_t max_bytes_ = 0;
+  uint64_t segment_bytes_ = 0;
+  uint64_t next_seq_ = 0;
+
+  // 세그먼트 목록 (front = 가장 오래됨, back = 기록 중)
+  std::deque<std::unique_ptr<MappedSegment>> segments_;
+  mutable std::mutex write_mutex_;  // Append + 세그먼트 목록 변경
+  std::mutex replay_mutex_;         // 재생 스레드 1개만
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<size_t> pending_{0};
+
+  std::atomic<uint64_t> spilled_{0};
+  std::atomic<uint64_t> replayed_{0};
+  std::atomic<uint64_t> rejected_{0};
+  std::atomic<uint64_t> recovered_{0};
+  std::atomic<uint64_t> corrupt_{0};
+};
+
+} // namespace Pipeline
+} // namespace PulseOne
+
+#endif // PULSEONE_PIPELINE_INGEST_SPILL_STORE_H
@@ -5,9 +5,11 @@
 
 #include "Common/Structs.h"
 #include "Alarm/AlarmTypes.h"
-#include <vector>
-#include <memory>
+#include <algorithm>
 #include <atomic>
+#include <iterator>
+#include <memory>
+#include <vector>
 
 namespace PulseOne::Pipeline {
 
@@ -15,15 +17,34 @@ namespace PulseOne::Pipeline {
  * @brief Holds the state and data flowing through the processing pipeline.
  */
 struct PipelineContext {
-    // Input Data
-    PulseOne::Structs::DeviceDataMessage message;
+    using PointList = std::vector<PulseOne::Structs::TimestampedValue>;
+
+    /**
+     * @brief Read-only range over a slice of message.points.
+     */
+    struct PointRange {
+        PointList::const_iterator first;
+        PointList::const_iterator last;
+        PointList::const_iterator begin() const { return first; }
+        PointList::const_iterator end() const { return last; }
+        size_t size() const { return static_cast<size_t>(last - first); }
+        bool empty() const { return first == last; }
+    };
 
-    // Enriched Data (Result of EnrichmentStage)
-    PulseOne::Structs::DeviceDataMessage enriched_message;
+    // Input Data, owned by the context (moved in from the ingest batch).
+    // Enrichment is append-only: virtual points are moved onto the end of
+    // message.points, so later stages see one combined message while the
+    // original points are never copied. Originals occupy
+    // [0, original_point_count); virtual points follow.
+    PulseOne::Structs::DeviceDataMessage message;
+    size_t original_point_count = 0;
 
     // Processing Flags
     bool should_persist = true;
     bool should_evaluate_alarms = true;
+    bool halted = false; // Set when a stage returns false; later stages skip it
+    bool failed = false; // Set when a stage threw for this message; its WAL
+                         // record is released unpersisted so it is retried
     
     // Alarms (Result of AlarmStage)
     std::vector<PulseOne::Alarm::AlarmEvent> alarm_events;
@@ -31,6 +52,7 @@ struct PipelineContext {
     // Statistics for this specific message
     struct ContextStats {
         int virtual_points_added = 0;
+        int points_suppressed = 0; // Removed by DeadbandStage
         int alarms_triggered = 0;
         bool persisted_to_redis = false;
         bool persisted_to_rdb = false;
@@ -40,8 +62,59 @@ struct PipelineContext {
     // Detailed error info if processing fails
     std::string error_message;
 
-    explicit PipelineContext(const PulseOne::Structs::DeviceDataMessage& msg) 
-        : message(msg), enriched_message(msg) {}
+    explicit PipelineContext(PulseOne::Structs::DeviceDataMessage&& msg)
+        : message(std::move(msg)), original_point_count(message.points.size()) {}
+
+    PipelineContext(PipelineContext&&) = default;
+    PipelineContext& operator=(PipelineContext&&) = default;
+    PipelineContext(const PipelineContext&) = delete;
+    PipelineContext& operator=(const PipelineContext&) = delete;
+
+    /**
+     * @brief Move virtual-point results onto the end of message.points.
+     */
+    void AppendVirtualPoints(PointList&& virtual_points) {
+        if (virtual_points.empty()) {
+            return;
+        }
+        message.points.reserve(message.points.size() + virtual_points.size());
+        std::move(virtual_points.begin(), virtual_points.end(),
+                  std::back_inserter(message.points));
+        stats.virtual_points_added += static_cast<int>(virtual_points.size());
+    }
+
+    /**
+     * @brief Remove original points matching pred, keeping order.
+     * Virtual points are never touched.
+     * @return Number of removed points.
+     */
+    template <typename Pred>
+    size_t RemoveOriginalPointsIf(Pred pred) {
+        const size_t split_index = SplitIndex();
+        auto first = message.points.begin();
+        auto split = first + split_index;
+        auto kept_end = std::remove_if(first, split, pred);
+        const size_t removed = static_cast<size_t>(split - kept_end);
+        if (removed > 0) {
+            message.points.erase(kept_end, split);
+            original_point_count = split_index - removed;
+        }
+        return removed;
+    }
+
+    PointRange OriginalPoints() const {
+        auto split = message.points.cbegin() + SplitIndex();
+        return {message.points.cbegin(), split};
+    }
+
+    PointRange VirtualPoints() const {
+        auto split = message.points.cbegin() + SplitIndex();
+        return {split, message.points.cend()};
+    }
+
+    size_t SplitIndex() const {
+        return std::min(original_point_count, message.points.size());
+    }
 };
 
 } // namespace PulseOne::Pipeline
@@ -7,10 +7,11 @@
 #define PULSEONE_PIPELINE_MANAGER_H
 
 #include "Common/Structs.h"
-#include <queue>
-#include <mutex>
-#include <condition_variable>
+#include "Pipeline/IngestSpillStore.h"
+#include "Pipeline/PipelineWal.h"
+#include "Pipeline/ShardedIngestQueue.h"
 #include <atomic>
+#include <chrono>
 #include <vector>
 #include <memory>
 
@@ -58,6 +59,11 @@ public:
      * @return 성공 시 true, 큐 오버플로우 시 false
      */
     bool PushMessage(const Structs::DeviceDataMessage& message);
+    /**
+     * @brief 복사 없이 메시지 전달 (권장)
+     * @return 성공 시 true. 실패 시 message는 변경되지 않음
+     */
+    bool PushMessage(Structs::DeviceDataMessage&& message);
     /**
      * @brief Worker에서 데이터 전송 (큐에 추가만!)
      */
@@ -79,6 +85,28 @@ public:
         uint32_t timeout_ms = 100
     );
     
+    /**
+     * @brief 디바이스 친화 모드에서 처리 스레드별 배치 가져오기
+     * @details consumer_index가 소유한 샤드(= device_id 해시 그룹)만 꺼내므로
+     * 같은 디바이스의 메시지는 항상 같은 스레드에서 순서대로 처리된다.
+     * 친화 모드가 아니면 GetBatch와 동일.
+     */
+    std::vector<Structs::DeviceDataMessage> GetBatchForConsumer(
+        size_t consumer_index,
+        size_t max_batch_size = 500,
+        uint32_t timeout_ms = 100
+    );
+    
+    /**
+     * @brief 디바이스 친화 모드 설정 (처리 스레드 시작 전 호출)
+     * @param consumer_count 처리 스레드 수 (0 = 해제)
+     * @return 적용된 소비자 수 (샤드 수를 넘을 수 없음)
+     */
+    size_t SetConsumerAffinity(size_t consumer_count) {
+        return ingest_queue_.SetConsumerAffinity(consumer_count);
+    }
+    size_t GetConsumerAffinity() const { return ingest_queue_.GetConsumerAffinity(); }
+    
     /**
      * @brief 큐가 비어있는지 확인
      */
@@ -93,6 +121,60 @@ public:
      * @brief 큐 오버플로우 여부 확인
      */
     bool IsOverflowing() const;
+    
+    /**
+     * @brief 디스크 스필에 대기 중인 메시지 수
+     * @details 큐가 가득 차면 메시지는 드롭 대신 디스크로 스필되고,
+     * 처리 스레드가 따라잡으면 GetBatch에서 순서대로 큐에 되돌려진다.
+     */
+    size_t GetSpillPendingCount() const { return spill_store_.PendingCount(); }
+    
+    /**
+     * @brief 파이프라인 WAL (PIPELINE_WAL_ENABLED)
+     * @details 수락한 메시지는 PushMessage가 반환하기 전에 WAL에 기록되고
+     * message.wal_lsn을 받는다. 처리/저장 단계는 이 LSN으로 Retain/Release
+     * 하며, 모두 반환된 지점까지 체크포인트된다.
+     */
+    PipelineWal& GetWal() { return wal_; }
+    
+    /**
+     * @brief 저장 단계까지 끝난 뒤 호출 (마지막 체크포인트 기록)
+     * @details Shutdown은 처리 스레드가 아직 저장 중일 수 있어 WAL을 닫지 않는다.
+     */
+    void CloseWal() { wal_.Close(); }
+
+    // ==========================================================================
+    // 🔥 흐름 제어 (Worker 역압)
+    // ==========================================================================
+    
+    /**
+     * @brief 수집 큐 혼잡도 (NORMAL 레인 허용 한도 대비 점유율)
+     * - NONE:     < 50%
+     * - ELEVATED: >= 50%  → 폴링 주기 2배
+     * - HIGH:     >= 75%  → 폴링 주기 4배
+     * - CRITICAL: >= 90%  → 폴링 주기 8배 (곧 드롭 발생)
+     */
+    enum class CongestionLevel : uint8_t { NONE = 0, ELEVATED = 1, HIGH = 2, CRITICAL = 3 };
+    
+    /**
+     * @brief Worker가 폴링 전에 조회하는 현재 혼잡도
+     * @details 일반 폴링 데이터(NORMAL 레인)만 드롭 대상이므로 그 레인 기준으로 판단
+     */
+    CongestionLevel GetCongestionLevel() const;
+    static const char* CongestionLevelName(CongestionLevel level);
+    
+    /**
+     * @brief 혼잡도에 따른 폴링 주기 배수 (1, 2, 4, 8)
+     */
+    uint32_t GetBackoffMultiplier() const;
+    
+    /**
+     * @brief 혼잡도가 HIGH 미만으로 내려갈 때까지 대기
+     * @details 구독형 Worker(MQTT)가 수신 콜백에서 소비를 멈출 때 사용.
+     * 파이프라인 정지 시 즉시 반환.
+     * @return max_wait 이내에 여유가 생겼으면 true
+     */
+    bool WaitForCapacity(std::chrono::milliseconds max_wait) const;
 
     // ==========================================================================
     // 🔥 상태 관리
@@ -107,6 +189,28 @@ public:
     // 🔥 통계 및 모니터링
     // ==========================================================================
     
+    // ==========================================================================
+    // 🔥 우선순위 레인
+    // ==========================================================================
+    
+    /**
+     * @brief 수집 큐 레인 (숫자가 작을수록 우선)
+     * - URGENT: high_priority 메시지 (알람성 MQTT 등)
+     * - HIGH:   priority > 0 (BACnet COV 등 이벤트성 데이터)
+     * - NORMAL: 일반 폴링 결과
+     */
+    enum class Lane : size_t { URGENT = 0, HIGH = 1, NORMAL = 2 };
+    static constexpr size_t LANE_COUNT = 3;
+    
+    static Lane LaneFor(const Structs::DeviceDataMessage& message);
+    static const char* LaneName(Lane lane);
+    
+    /**
+     * @brief GetBatch의 레인 dequeue 정책 변경 (기본: WEIGHTED 16:4:1)
+     */
+    void SetDequeuePolicy(LaneDequeuePolicy policy) { ingest_queue_.SetDequeuePolicy(policy); }
+    LaneDequeuePolicy GetDequeuePolicy() const { return ingest_queue_.GetDequeuePolicy(); }
+    
     struct QueueStats {
         uint64_t total_received = 0;
         uint64_t total_delivered = 0;
@@ -114,13 +218,17 @@ public:
         size_t current_queue_size = 0;
         size_t max_queue_size = 0;
         double fill_percentage = 0.0;
+        std::vector<IngestLaneStats> lanes; // Lane 순서 (URGENT, HIGH, NORMAL)
+        CongestionLevel congestion_level = CongestionLevel::NONE;
+        IngestSpillStats spill;
+        PipelineWalStats wal;
     };
     
     QueueStats GetStatistics() const;
     void ResetStatistics();
 
 private:
-    PipelineManager() = default;
+    PipelineManager();
     ~PipelineManager() { Shutdown(); }
 
     // ==========================================================================
@@ -130,14 +238,27 @@ private:
     // 상태 관리
     std::atomic<bool> is_running_{false};
     
-    // 🔥 순수 큐 시스템
-    std::queue<Structs::DeviceDataMessage> data_queue_;
-    mutable std::mutex queue_mutex_;
-    std::condition_variable queue_cv_;
-    
     // 설정
     static constexpr size_t MAX_QUEUE_SIZE = 100000;
     static constexpr size_t OVERFLOW_THRESHOLD = 90000; // 90% 임계점
+    static constexpr size_t INGEST_SHARD_COUNT = 16;
+    static constexpr size_t SPILL_REPLAY_LOW_WATER = OVERFLOW_THRESHOLD / 2;
+    static constexpr size_t SPILL_REPLAY_BATCH = 1000;
+    
+    // 🔥 락프리 샤드 큐 (레인별 device_id 해시 → 샤드)
+    ShardedIngestQueue ingest_queue_;
+    
+    // 🔥 오버플로우 디스크 스필 (PIPELINE_SPILL_ENABLED)
+    IngestSpillStore spill_store_;
+    
+    void OpenSpillStore();
+    void ReplaySpill();
+    
+    // 🔥 크래시 대비 선행 기록 로그 (PIPELINE_WAL_ENABLED)
+    PipelineWal wal_;
+    
+    void ReplayWal();
+    void RetryWal();
     
     // 통계 (스레드 안전)
     std::atomic<uint64_t> total_received_{0};
@@ -0,0 +1,146 @@
+// =============================================================================
+// collector/include/Pipeline/PipelineMetrics.h - 파이프라인 지연 히스토그램
+// 🔥 평균 대신 p50/p99/p999로 용량 계획 (드라이버 읽기 → 큐 → 스테이지 → 저장)
+// =============================================================================
+
+#ifndef PULSEONE_PIPELINE_METRICS_H
+#define PULSEONE_PIPELINE_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+
+namespace PulseOne {
+namespace Pipeline {
+
+/**
+ * @brief HDR 스타일 로그-선형 지연 히스토그램 (마이크로초 단위)
+ * @details
+ * - 2의 거듭제곱 구간마다 16개 선형 하위 버킷 → 상대 오차 약 6% 이내
+ * - 1us ~ 약 19시간 범위, 버킷 528개 (약 4KB)
+ * - Record는 원자적 증가 몇 번뿐이라 핫패스에서 락 없이 호출 가능
+ */
+class LatencyHistogram {
+public:
+  static constexpr size_t SUB_BUCKET_BITS = 4;
+  static constexpr size_t SUB_BUCKETS = size_t(1) << SUB_BUCKET_BITS;
+  static constexpr size_t MAX_EXPONENT = 36; // 2^36 us ≈ 19시간
+  static constexpr size_t BUCKET_COUNT =
+      SUB_BUCKETS + (MAX_EXPONENT - SUB_BUCKET_BITS) * SUB_BUCKETS;
+
+  struct Snapshot {
+    uint64_t count = 0;
+    uint64_t sum_us = 0;
+    uint64_t max_us = 0;
+    uint64_t p50_us = 0;
+    uint64_t p90_us = 0;
+    uint64_t p99_us = 0;
+    uint64_t p999_us = 0;
+  };
+
+  LatencyHistogram() = default;
+  LatencyHistogram(const LatencyHistogram &) = delete;
+  LatencyHistogram &operator=(const LatencyHistogram &) = delete;
+
+  void Record(uint64_t micros);
+
+  template <typename Rep, typename Period>
+  void Record(std::chrono::duration<Rep, Period> elapsed) {
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+                  .count();
+    Record(static_cast<uint64_t>(us > 0 ? us : 0));
+  }
+
+  uint64_t Count() const { return count_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief 백분위 값 (버킷 상한, 관측 최대값을 넘지 않음)
+   * @param percentile 0 ~ 100
+   */
+  uint64_t ValueAtPercentile(double percentile) const;
+
+  Snapshot TakeSnapshot() const;
+
+  /**
+   * @brief micros 이하로 기록된 샘플 수 (Prometheus 누적 버킷용)
+   */
+  uint64_t CountAtOrBelow(uint64_t micros) const;
+
+  void Reset();
+
+  static size_t BucketIndex(uint64_t micros);
+  static uint64_t BucketUpperBound(size_t index);
+
+private:
+  std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_{};
+  std::atomic<uint64_t> count_{0};
+  std::atomic<uint64_t> sum_us_{0};
+  std::atomic<uint64_t> max_us_{0};
+};
+
+/**
+ * @brief 파이프라인 지연 히스토그램 레지스트리 (싱글톤)
+ * @details 히스토그램은 (종류, 이름) 쌍으로 식별한다.
+ * - driver_read: 프로토콜별 드라이버 읽기 시간
+ * - queue_wait:  레인별 수집 큐 체류 시간
+ * - stage:       스테이지별 배치 처리 시간
+ * - end_to_end:  프로토콜별 메시지 생성 → 파이프라인 완료
+ * - redis_write / influx_flush: 저장소 쓰기 시간
+ * 한 번 만든 히스토그램은 삭제하지 않으므로 Get이 돌려준 참조는 계속 유효하다.
+ */
+class PipelineMetrics {
+public:
+  static constexpr const char *DRIVER_READ = "driver_read";
+  static constexpr const char *QUEUE_WAIT = "queue_wait";
+  static constexpr const char *STAGE = "stage";
+  static constexpr const char *END_TO_END = "end_to_end";
+  static constexpr const char *REDIS_WRITE = "redis_write";
+  static constexpr const char *INFLUX_FLUSH = "influx_flush";
+
+  static PipelineMetrics &getInstance();
+
+  PipelineMetrics(const PipelineMetrics &) = delete;
+  PipelineMetrics &operator=(const PipelineMetrics &) = delete;
+
+  LatencyHistogram &Get(const std::string &kind, const std::string &name);
+
+  template <typename Rep, typename Period>
+  void Record(const std::string &kind, const std::string &name,
+              std::chrono::duration<Rep, Period> elapsed) {
+    Get(kind, name).Record(elapsed);
+  }
+
+  /**
+   * @brief /api/system/stats용 JSON ({kind: {name: {count, p50_ms, ...}}})
+   */
+  nlohmann::json ToJson() const;
+
+  /**
+   * @brief Prometheus 텍스트 노출 형식
+   */
+  std::string ToPrometheus() const;
+
+  void Reset();
+
+private:
+  PipelineMetrics() = default;
+  ~PipelineMetrics() = default;
+
+  using Key = std::pair<std::string, std::string>;
+
+  mutable std::shared_mutex mutex_;
+  std::map<Key, std::unique_ptr<LatencyHistogram>> histograms_;
+};
+
+} // namespace Pipeline
+} // namespace PulseOne
+
+#endif // PULSEONE_PIPELINE_METRICS_H
@@ -0,0 +1,272 @@
+// =============================================================================
+// collector/include/Pipeline/PipelineWal.h - 파이프라인 선행 기록 로그 (WAL)
+// 🔥 수락한 메시지를 응답 전에 세그먼트 파일에 그룹 커밋하고, RDB/Influx 저장이
+//    끝난 지점까지 체크포인트. 비정상 종료 후 재시작 시 미완료분을 재생
+// =============================================================================
+
+#ifndef PULSEONE_PIPELINE_WAL_H
+#define PULSEONE_PIPELINE_WAL_H
+
+#include "Common/Structs.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace PulseOne {
+namespace Pipeline {
+
+/**
+ * @brief fsync 정책
+ * - ALWAYS:   그룹 커밋마다 fsync 후 응답 (전원 차단에도 유실 없음)
+ * - INTERVAL: 그룹 커밋은 write까지만 하고 fsync는 주기적으로
+ *             (프로세스 종료/OOM에는 안전, 전원 차단 시 최대 한 주기 유실)
+ * - NONE:     fsync는 세그먼트 전환/종료 시에만
+ */
+enum class WalFsyncPolicy : uint8_t { ALWAYS = 0, INTERVAL = 1, NONE = 2 };
+
+/**
+ * @brief WAL 설정 (PIPELINE_WAL_* 키)
+ */
+struct PipelineWalOptions {
+  bool enabled = false;
+  std::string directory; // 비어 있으면 <데이터 디렉토리>/wal
+  uint64_t segment_bytes = 16ULL * 1024 * 1024;
+  uint64_t max_bytes = 512ULL * 1024 * 1024; // 초과 시 가장 오래된 세그먼트 폐기
+  WalFsyncPolicy fsync_policy = WalFsyncPolicy::INTERVAL;
+  int fsync_interval_ms = 100;
+  int checkpoint_interval_ms = 1000;
+  int retry_interval_ms = 5000; // 저장 실패 레코드를 다시 투입하는 주기
+  int retry_max_attempts = 5;   // LSN별 재투입 한도 (넘으면 버림)
+
+  static PipelineWalOptions FromConfig();
+};
+
+struct PipelineWalStats {
+  bool enabled = false;
+  uint64_t appended = 0;      // 기록한 메시지 수
+  uint64_t group_commits = 0; // 그룹 커밋(쓰기) 횟수
+  uint64_t fsyncs = 0;
+  uint64_t unpersisted = 0; // 저장 실패로 체크포인트를 붙잡은 참조 수
+  uint64_t retried = 0;     // 저장 실패 후 파이프라인에 다시 투입한 메시지 수
+  size_t retry_pending = 0; // 다시 투입을 기다리는 참조 수
+  uint64_t retry_dropped = 0; // 재투입 한도를 넘겨 버린 메시지 수
+  uint64_t truncated = 0;   // 용량 한도로 미완료 상태에서 폐기된 메시지 수
+  uint64_t recovered = 0;   // 시작 시 재생 대상으로 찾은 메시지 수
+  uint64_t replayed = 0;
+  uint64_t corrupt = 0; // 체크섬 불일치/디코딩 실패 레코드
+  uint64_t write_errors = 0;
+  uint64_t checkpoint_lsn = 0; // 이 값 미만은 모두 저장 완료
+  uint64_t next_lsn = 0;
+  size_t in_flight = 0; // 체크포인트 이후 추적 중인 메시지 수
+  size_t segments = 0;
+  uint64_t bytes_on_disk = 0;
+};
+
+/**
+ * @brief 세그먼트 기반 WAL
+ * @details
+ * - 레코드: [길이 u32][체크섬 u32][LSN u64][레인 u8 + 메시지 바이너리].
+ *   세그먼트 파일(wal_<첫 LSN>.log)은 segment_bytes를 넘으면 새로 연다.
+ * - Append는 레코드를 공유 버퍼에 넣고 기다린다. 먼저 기다리던 스레드
+ *   하나가 리더가 되어 버퍼 전체를 한 번에 쓰고(정책에 따라 fsync) 나머지를
+ *   깨운다 (그룹 커밋).
+ * - LSN마다 참조 수를 센다. Append가 처리용 참조 1을 만들고, 저장 태스크가
+ *   Retain/Release로 참조를 더하고 뺀다. 참조가 0이 된 가장 앞 LSN까지가
+ *   체크포인트이며, 저장 실패(Release(persisted=false))는 참조를 남겨
+ *   체크포인트를 붙잡는다. 그 LSN은 재시도 목록에 올라 retry_interval_ms마다
+ *   WAL에서 다시 읽어 파이프라인에 투입하고(Retry), 재투입된 메시지의 처리가
+ *   남은 참조를 가져간다. 재투입 메시지는 wal_retry가 켜져 있어 처리
+ *   서비스가 알람/데드밴드/Redis/롤업을 건너뛰고 Influx 저장만 다시 한다.
+ *   같은 LSN은 재투입마다 간격을 두 배로 늘리고(retry_interval_ms 기준,
+ *   최대 64배) retry_max_attempts번을 넘기면 저장된 것으로 반환해 버린다
+ *   (retry_dropped). 재시작 시에는 남은 레코드를 재생한다
+ *   (at-least-once, 중복 가능).
+ * - 체크포인트는 wal.checkpoint 파일에 원자적으로 기록하고, 모든 레코드가
+ *   체크포인트 이전인 세그먼트는 삭제한다.
+ */
+class PipelineWal {
+public:
+  /**
+   * @brief 재생 싱크. false를 반환하면 재생을 멈추고 해당 레코드는 남겨 둔다.
+   */
+  using ReplaySink =
+      std::function<bool(Structs::DeviceDataMessage &&message, uint8_t lane)>;
+
+  PipelineWal() = default;
+  ~PipelineWal();
+
+  PipelineWal(const PipelineWal &) = delete;
+  PipelineWal &operator=(const PipelineWal &) = delete;
+
+  /**
+   * @brief 디렉토리를 열고 체크포인트 이후 레코드를 재생 대기열로 복구
+   * @return 성공 여부 (실패 시 비활성 상태 유지)
+   */
+  bool Open(const PipelineWalOptions &options);
+
+  /**
+   * @brief fsync + 마지막 체크포인트 기록 후 닫음 (미완료 레코드는 파일에 유지)
+   */
+  void Close();
+
+  bool IsEnabled() const { return enabled_.load(std::memory_order_acquire); }
+
+  /**
+   * @brief 메시지를 기록하고 fsync 정책에 맞게 커밋될 때까지 대기
+   * @return 부여된 LSN (비활성/쓰기 실패 시 0)
+   */
+  uint64_t Append(const Structs::DeviceDataMessage &message, uint8_t lane);
+
+  /**
+   * @brief 저장 태스크 참조 추가 (LSN 0은 무시)
+   */
+  void Retain(uint64_t lsn);
+  void Retain(const std::vector<uint64_t> &lsns);
+
+  /**
+   * @brief 참조 반환. persisted가 false면 참조를 남기고 재시도 목록에 올림
+   */
+  void Release(uint64_t lsn, bool persisted);
+  void Release(const std::vector<uint64_t> &lsns, bool persisted);
+
+  /**
+   * @brief 주기 fsync / 체크포인트 기록 / 세그먼트 정리 (자체 주기 제한)
+   */
+  void Maintain();
+
+  bool HasReplay() const {
+    return replay_pending_.load(std::memory_order_acquire) > 0;
+  }
+
+  /**
+   * @brief 이전 실행의 미완료 레코드를 최대 max_items개 sink로 전달
+   * @details message.wal_lsn은 원래 LSN으로 채워진다.
+   * @return sink가 수락한 메시지 수
+   */
+  size_t Replay(const ReplaySink &sink, size_t max_items);
+
+  bool HasRetry() const {
+    return retry_pending_.load(std::memory_order_acquire) > 0;
+  }
+
+  /**
+   * @brief 저장에 실패한 레코드를 WAL에서 다시 읽어 최대 max_items개 sink로
+   * 전달 (retry_interval_ms에 한 번, 용량 한도로 폐기된 LSN은 건너뜀)
+   * @details message.wal_lsn은 원래 LSN으로, message.wal_retry는 true로
+   * 채워지며, 남아 있던 참조는 재투입된 메시지의 처리용 참조가 된다.
+   * 백오프 중인 LSN은 다음 호출로 미루고, 한도를 넘긴 LSN은 버린다.
+   * @return sink가 수락한 메시지 수
+   */
+  size_t Retry(const ReplaySink &sink, size_t max_items);
+
+  /**
+   * @brief 이번 실행에서 처음 부여한 LSN (이보다 작으면 이전 실행 레코드)
+   */
+  uint64_t SessionStartLsn() const { return session_start_lsn_; }
+
+  PipelineWalStats GetStats() const;
+
+private:
+  struct Segment {
+    uint64_t first_lsn = 0;
+    uint64_t last_lsn = 0; // 레코드가 없으면 first_lsn - 1
+    std::string path;
+    uint64_t bytes = 0;
+    size_t live = 0; // 복구 시 체크포인트 이후 레코드 수 (재생용)
+  };
+
+  // 대기 중인 레코드를 리더로서 한 번 커밋 (mutex_ 보유 상태로 호출,
+  // 파일 쓰기 동안에는 풀었다가 다시 잡음)
+  void LeadCommit(std::unique_lock<std::mutex> &lock);
+  // 버퍼를 파일에 쓰고 필요하면 fsync (io_mutex_ 보유)
+  bool WriteGroupLocked(const std::string &buffer, uint64_t first_lsn,
+                        uint64_t last_lsn);
+  bool OpenActiveSegmentLocked(uint64_t first_lsn);
+  bool SyncActiveLocked();
+
+  bool ScanSegment(Segment &segment, uint64_t checkpoint,
+                   std::vector<uint64_t> &live);
+  uint64_t CheckpointLsn() const;
+  bool WriteCheckpointFile(uint64_t lsn);
+  bool ReadCheckpointFile(uint64_t &lsn) const;
+  // 아래 두 함수는 io_mutex_ 보유 상태에서 호출
+  void DropSegmentsBefore(uint64_t checkpoint);
+  void EnforceSizeLimit();
+  void AdvanceBaseLocked(); // tracker_mutex_ 보유 상태에서 호출
+
+  std::string SegmentPath(uint64_t first_lsn) const;
+  std::string CheckpointPath() const;
+
+  PipelineWalOptions options_;
+  std::atomic<bool> enabled_{false};
+
+  // 그룹 커밋 (mutex_)
+  mutable std::mutex mutex_;
+  std::condition_variable commit_cv_;
+  std::string pending_;          // 아직 쓰지 않은 레코드들
+  uint64_t pending_first_lsn_ = 0;
+  uint64_t next_lsn_ = 1;
+  uint64_t committed_lsn_ = 0;   // 이 LSN까지 커밋 완료 (정책 기준)
+  uint64_t failed_from_ = 0;     // 쓰기 실패 이후 LSN은 기록되지 않음
+  bool leader_active_ = false;
+  uint64_t session_start_lsn_ = 1;
+
+  // 파일 I/O (리더 / Maintain / Close)
+  mutable std::mutex io_mutex_;
+  std::FILE *active_file_ = nullptr;
+  std::deque<Segment> segments_; // back = 기록 중
+  bool unsynced_ = false;
+  int64_t last_sync_ms_ = 0;
+  uint64_t last_checkpoint_written_ = 0;
+  int64_t next_checkpoint_ms_ = 0;
+  std::atomic<int64_t> next_maintenance_ms_{0};
+
+  // LSN 참조 수 (tracker_mutex_). refs_[i] = base_lsn_ + i의 참조 수
+  mutable std::mutex tracker_mutex_;
+  std::deque<uint32_t> refs_;
+  uint64_t base_lsn_ = 1;
+
+  // 재생 커서 (replay_mutex_)
+  std::mutex replay_mutex_;
+  std::vector<Segment> replay_segments_;
+  size_t replay_index_ = 0;
+  uint64_t replay_offset_ = 0;
+  size_t replay_consumed_ = 0; // 현재 세그먼트에서 처리한 live 레코드 수
+  uint64_t replay_checkpoint_ = 0;
+  std::atomic<size_t> replay_pending_{0};
+
+  // 저장 실패 재시도 (retry_mutex_). 같은 LSN이 여러 번 오면 참조도 그만큼
+  struct RetryState {
+    int attempts = 0;
+    int64_t due_ms = 0; // 이 시각 전에는 다시 투입하지 않음 (백오프)
+  };
+  std::mutex retry_mutex_;
+  std::vector<uint64_t> retry_lsns_;
+  std::unordered_map<uint64_t, RetryState> retry_states_;
+  int64_t next_retry_ms_ = 0;
+  std::atomic<size_t> retry_pending_{0};
+
+  std::atomic<uint64_t> appended_{0};
+  std::atomic<uint64_t> group_commits_{0};
+  std::atomic<uint64_t> fsyncs_{0};
+  std::atomic<uint64_t> unpersisted_{0};
+  std::atomic<uint64_t> retried_{0};
+  std::atomic<uint64_t> retry_dropped_{0};
+  std::atomic<uint64_t> truncated_{0};
+  std::atomic<uint64_t> recovered_{0};
+  std::atomic<uint64_t> replayed_{0};
+  std::atomic<uint64_t> corrupt_{0};
+  std::atomic<uint64_t> write_errors_{0};
+};
+
+} // namespace Pipeline
+} // namespace PulseOne
+
+#endif // PULSEONE_PIPELINE_WAL_H
@@ -0,0 +1,133 @@
+// =============================================================================
+// collector/include/Pipeline/PointBatch.h - 컬럼형(SoA) 포인트 배치
+// 🔥 TimestampedValue 벡터 대신 평행 배열로 포인트를 운반 (힙 할당 최소화)
+// =============================================================================
+
+#ifndef PULSEONE_PIPELINE_POINT_BATCH_H
+#define PULSEONE_PIPELINE_POINT_BATCH_H
+
+#include "Common/Structs.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace PulseOne {
+namespace Pipeline {
+
+/**
+ * @brief 컬럼형 포인트 배치 (Structure of Arrays)
+ * @details
+ * - 행 하나 = 포인트 하나. point_id / 값 / 품질 / 타임스탬프 / 플래그를
+ *   각각 연속 배열로 보관하므로 행 추가 시 포인트별 힙 할당이 없다.
+ * - 숫자 값은 8바이트 슬롯에 원래 타입 그대로(비트 보존) 저장하고,
+ *   문자열 값만 별도 사이드 테이블에 둔다.
+ * - TimestampedValue의 source / metadata / applicable_alarms 등은 운반하지
+ *   않는다. 레거시 구조체와의 변환은 경계에서만 (FromLegacy / ToLegacy).
+ */
+class PointBatch {
+public:
+  /**
+   * @brief 값 타입 (DataVariant 인덱스와 동일한 순서)
+   */
+  enum class ValueKind : uint8_t {
+    BOOL = 0,
+    INT16,
+    UINT16,
+    INT32,
+    UINT32,
+    INT64,
+    UINT64,
+    FLOAT,
+    DOUBLE,
+    STRING
+  };
+
+  /**
+   * @brief 행 플래그 (TimestampedValue의 bool 필드 중 파이프라인이 쓰는 것)
+   */
+  enum Flag : uint8_t {
+    FLAG_VALUE_CHANGED = 0x01,
+    FLAG_VIRTUAL_POINT = 0x02,
+    FLAG_FORCE_RDB_STORE = 0x04,
+  };
+
+  PointBatch() = default;
+
+  void Reserve(size_t rows);
+  void Clear();
+  size_t Size() const { return point_ids_.size(); }
+  bool Empty() const { return point_ids_.empty(); }
+
+  // ==========================================================================
+  // 🔥 행 추가
+  // ==========================================================================
+
+  void Append(int point_id, const Structs::DataValue &value,
+              Structs::DataQuality quality, const Structs::Timestamp &timestamp,
+              uint8_t flags = 0);
+  void Append(const Structs::TimestampedValue &point);
+
+  // ==========================================================================
+  // 🔥 레거시 변환 (경계에서만 사용)
+  // ==========================================================================
+
+  static PointBatch
+  FromLegacy(const std::vector<Structs::TimestampedValue> &points);
+  Structs::TimestampedValue ToLegacy(size_t row) const;
+  void AppendLegacyTo(std::vector<Structs::TimestampedValue> &out) const;
+
+  // ==========================================================================
+  // 🔥 행 조회
+  // ==========================================================================
+
+  int PointId(size_t row) const { return point_ids_[row]; }
+  ValueKind Kind(size_t row) const { return static_cast<ValueKind>(kinds_[row]); }
+  bool IsString(size_t row) const { return Kind(row) == ValueKind::STRING; }
+  Structs::DataQuality Quality(size_t row) const {
+    return static_cast<Structs::DataQuality>(qualities_[row]);
+  }
+  Structs::Timestamp Time(size_t row) const {
+    return Structs::Timestamp(Structs::Timestamp::duration(timestamps_[row]));
+  }
+  uint8_t Flags(size_t row) const { return flags_[row]; }
+  bool HasFlag(size_t row, Flag flag) const { return (flags_[row] & flag) != 0; }
+
+  /**
+   * @brief 숫자 값 (bool은 0/1, 문자열은 0.0)
+   */
+  double NumericValue(size_t row) const;
+
+  /**
+   * @brief 문자열 값 (문자열 행이 아니면 nullptr)
+   */
+  const std::string *StringValue(size_t row) const;
+
+  /**
+   * @brief 원래 타입의 값 (문자열 행이면 복사 발생)
+   */
+  Structs::DataValue Value(size_t row) const;
+
+  // 타이트 루프용 원시 컬럼
+  const std::vector<int32_t> &PointIds() const { return point_ids_; }
+  const std::vector<int64_t> &Timestamps() const { return timestamps_; }
+
+  /**
+   * @brief 컬럼이 차지하는 대략적인 메모리 (바이트)
+   */
+  size_t MemoryUsage() const;
+
+private:
+  std::vector<int32_t> point_ids_;
+  std::vector<uint64_t> values_; // 숫자: 비트 보존 / 문자열: strings_ 인덱스
+  std::vector<uint8_t> kinds_;
+  std::vector<uint8_t> qualities_;
+  std::vector<uint8_t> flags_;
+  std::vector<int64_t> timestamps_; // system_clock tick
+  std::vector<std::string> strings_; // 문자열 값 사이드 테이블
+};
+
+} // namespace Pipeline
+} // namespace PulseOne
+
+#endif // PULSEONE_PIPELINE_POINT_BATCH_H
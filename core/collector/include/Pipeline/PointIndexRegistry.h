@@ -0,0 +1,173 @@
+// =============================================================================
+// collector/include/Pipeline/PointIndexRegistry.h - 포인트 밀집 인덱스 레지스트리
+// 🔥 point_id → 0부터 연속된 32비트 인덱스. 포인트별 상태를 해시맵 대신
+//    연속 배열(PointStateArray)에 두기 위한 기반
+// =============================================================================
+
+#ifndef PULSEONE_PIPELINE_POINT_INDEX_REGISTRY_H
+#define PULSEONE_PIPELINE_POINT_INDEX_REGISTRY_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace PulseOne {
+namespace Pipeline {
+
+/**
+ * @brief 밀집 인덱스로 접근하는 포인트별 상태 배열
+ * @details
+ * - 4096개 단위 청크를 필요할 때 할당하고 한 번 할당된 청크는 옮기지 않으므로
+ *   원소 주소가 안정적이며, 확장 중에도 다른 스레드의 접근에 락이 필요 없다.
+ * - 원소 자체의 동시성은 T가 책임진다 (std::atomic 등) 또는 호출자가
+ *   인덱스 기반 스트라이프 락으로 보호한다.
+ */
+template <typename T> class PointStateArray {
+public:
+  static constexpr size_t CHUNK_BITS = 12;
+  static constexpr size_t CHUNK_SIZE = size_t(1) << CHUNK_BITS;
+  static constexpr size_t MAX_CHUNKS = 4096; // 최대 16M 포인트
+
+  PointStateArray() : chunks_(new std::atomic<T *>[MAX_CHUNKS]) {
+    for (size_t i = 0; i < MAX_CHUNKS; ++i) {
+      chunks_[i].store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  ~PointStateArray() {
+    for (size_t i = 0; i < MAX_CHUNKS; ++i) {
+      delete[] chunks_[i].load(std::memory_order_relaxed);
+    }
+  }
+
+  PointStateArray(const PointStateArray &) = delete;
+  PointStateArray &operator=(const PointStateArray &) = delete;
+
+  static constexpr size_t MaxSize() { return CHUNK_SIZE * MAX_CHUNKS; }
+
+  /**
+   * @brief 원소 참조 (청크가 없으면 할당). index는 MaxSize() 미만이어야 한다.
+   */
+  T &At(uint32_t index) {
+    const size_t c = index >> CHUNK_BITS;
+    T *chunk = chunks_[c].load(std::memory_order_acquire);
+    if (!chunk) {
+      T *fresh = new T[CHUNK_SIZE]();
+      if (chunks_[c].compare_exchange_strong(chunk, fresh,
+                                             std::memory_order_acq_rel)) {
+        chunk = fresh;
+      } else {
+        delete[] fresh; // 다른 스레드가 먼저 설치함
+      }
+    }
+    return chunk[index & (CHUNK_SIZE - 1)];
+  }
+
+  /**
+   * @brief 원소 조회 (청크가 없으면 nullptr, 할당하지 않음)
+   */
+  const T *Find(uint32_t index) const {
+    const size_t c = index >> CHUNK_BITS;
+    if (c >= MAX_CHUNKS)
+      return nullptr;
+    const T *chunk = chunks_[c].load(std::memory_order_acquire);
+    return chunk ? &chunk[index & (CHUNK_SIZE - 1)] : nullptr;
+  }
+
+  T *Find(uint32_t index) {
+    return const_cast<T *>(
+        static_cast<const PointStateArray &>(*this).Find(index));
+  }
+
+  /**
+   * @brief 모든 원소를 기본값으로 되돌림 (동시 접근이 없을 때만 호출)
+   */
+  void Reset() {
+    for (size_t i = 0; i < MAX_CHUNKS; ++i) {
+      T *chunk = chunks_[i].exchange(nullptr, std::memory_order_acq_rel);
+      delete[] chunk;
+    }
+  }
+
+private:
+  std::unique_ptr<std::atomic<T *>[]> chunks_;
+};
+
+/**
+ * @brief 설정된 모든 포인트에 밀집 인덱스를 부여하는 레지스트리 (싱글톤)
+ * @details
+ * - 시작 시 DB의 데이터포인트/가상포인트를 미리 등록하고(LoadConfiguredPoints),
+ *   이후 처음 보는 point_id는 Acquire에서 등록한다. 인덱스는 재사용하지 않는다.
+ * - point_id가 [0, DIRECT_ID_LIMIT) 범위면 직접 매핑 테이블로 락 없이 조회하고,
+ *   그 밖의 id만 해시맵(공유 락)으로 조회한다.
+ */
+class PointIndexRegistry {
+public:
+  static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+  static PointIndexRegistry &getInstance();
+
+  PointIndexRegistry(const PointIndexRegistry &) = delete;
+  PointIndexRegistry &operator=(const PointIndexRegistry &) = delete;
+
+  /**
+   * @brief 등록된 인덱스 조회 (락 없음)
+   * @return 미등록이면 INVALID_INDEX
+   */
+  uint32_t IndexOf(int point_id) const;
+
+  /**
+   * @brief 인덱스 조회, 없으면 새로 부여
+   * @return 용량(PointStateArray::MaxSize) 초과 시 INVALID_INDEX
+   */
+  uint32_t Acquire(int point_id);
+
+  /**
+   * @brief 여러 포인트를 한 번에 등록
+   */
+  void Preload(const std::vector<int> &point_ids);
+
+  /**
+   * @brief DB에 설정된 데이터포인트/가상포인트 전체 등록
+   * @return 새로 등록된 포인트 수
+   */
+  size_t LoadConfiguredPoints();
+
+  /**
+   * @brief 인덱스 → point_id 역조회 (잘못된 인덱스면 -1)
+   */
+  int PointIdOf(uint32_t index) const;
+
+  size_t Size() const { return next_index_.load(std::memory_order_acquire); }
+
+private:
+  PointIndexRegistry();
+  ~PointIndexRegistry() = default;
+
+  static constexpr int DIRECT_ID_LIMIT =
+      static_cast<int>(PointStateArray<std::atomic<uint32_t>>::CHUNK_SIZE *
+                       PointStateArray<std::atomic<uint32_t>>::MAX_CHUNKS);
+
+  uint32_t AssignLocked(int point_id);
+
+  // point_id → index + 1 (0 = 미등록)
+  PointStateArray<std::atomic<uint32_t>> direct_;
+  mutable std::shared_mutex overflow_mutex_;
+  std::unordered_map<int, uint32_t> overflow_;
+
+  // index → point_id
+  PointStateArray<std::atomic<int>> reverse_;
+
+  std::mutex assign_mutex_;
+  std::atomic<uint32_t> next_index_{0};
+};
+
+} // namespace Pipeline
+} // namespace PulseOne
+
+#endif // PULSEONE_PIPELINE_POINT_INDEX_REGISTRY_H
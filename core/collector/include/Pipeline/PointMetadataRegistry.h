@@ -0,0 +1,143 @@
+// =============================================================================
+// collector/include/Pipeline/PointMetadataRegistry.h - 포인트 메타데이터 레지스트리
+// 🔥 point_id → 이름/단위/디바이스명/스케일링/태그. DB에서 한 번 로드하고
+//    설정 변경 시 디바이스 단위로 갱신. 읽기는 스냅샷(RCU)이라 락 없음
+// =============================================================================
+
+#ifndef PULSEONE_PIPELINE_POINT_METADATA_REGISTRY_H
+#define PULSEONE_PIPELINE_POINT_METADATA_REGISTRY_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace PulseOne {
+namespace Pipeline {
+
+/**
+ * @brief 포인트 하나의 정적 메타데이터 (스냅샷 안에서 불변)
+ */
+struct PointMetadata {
+  int point_id = 0;
+  int device_id = 0; // 가상포인트는 0일 수 있음
+  bool is_virtual = false;
+  std::string name;
+  std::string unit;
+  std::string device_name;
+  std::string data_type;
+  double scaling_factor = 1.0;
+  double scaling_offset = 0.0;
+  bool log_enabled = true;      // false면 이력(raw/롤업) 저장 제외
+  uint32_t log_interval_ms = 0; // 0이면 전역 Influx 저장 주기 사용
+  std::vector<std::string> tags;
+};
+
+/**
+ * @brief 포인트 메타데이터 레지스트리 (싱글톤)
+ * @details
+ * - 전체 맵은 불변 스냅샷으로 공개하고, 갱신은 새 스냅샷을 만들어 교체한다.
+ *   읽는 쪽은 스냅샷 포인터만 원자적으로 가져오므로 락을 잡지 않는다.
+ * - 바뀌지 않은 포인트 항목은 스냅샷 간에 공유하므로 디바이스 단위 갱신은
+ *   맵 복사 + 해당 디바이스 포인트 조회 비용만 든다.
+ * - Generation()은 스냅샷이 바뀔 때마다 올라간다. 메타데이터로 만든 캐시
+ *   (Influx 라인 접두사 등)는 이 값으로 무효화를 판단한다.
+ * - 데이터포인트와 가상포인트는 서로 다른 테이블의 ID라 겹칠 수 있으므로
+ *   맵을 따로 둔다. 조회 시 TimestampedValue::is_virtual_point를 넘긴다.
+ */
+class PointMetadataRegistry {
+public:
+  using PointMap =
+      std::unordered_map<int, std::shared_ptr<const PointMetadata>>;
+
+  struct Snapshot {
+    PointMap points;         // 데이터포인트
+    PointMap virtual_points; // 가상포인트
+    uint64_t generation = 0;
+
+    const PointMap &MapFor(bool is_virtual) const {
+      return is_virtual ? virtual_points : points;
+    }
+
+    const PointMetadata *Find(int point_id, bool is_virtual) const {
+      const PointMap &map = MapFor(is_virtual);
+      auto it = map.find(point_id);
+      return it == map.end() ? nullptr : it->second.get();
+    }
+  };
+
+  static PointMetadataRegistry &getInstance();
+
+  PointMetadataRegistry(const PointMetadataRegistry &) = delete;
+  PointMetadataRegistry &operator=(const PointMetadataRegistry &) = delete;
+
+  /**
+   * @brief 현재 스냅샷 (락 없음). 배치 처리 시 한 번 잡아 두고 재사용 권장
+   */
+  std::shared_ptr<const Snapshot> GetSnapshot() const {
+    return std::atomic_load_explicit(&snapshot_, std::memory_order_acquire);
+  }
+
+  /**
+   * @brief 포인트 메타데이터 조회 (미등록이면 nullptr)
+   */
+  std::shared_ptr<const PointMetadata> Find(int point_id,
+                                            bool is_virtual) const;
+
+  /**
+   * @brief 포인트 이름 (미등록이면 "point_<id>")
+   */
+  std::string NameOf(int point_id, bool is_virtual) const;
+
+  /**
+   * @brief 단위 (미등록이면 빈 문자열)
+   */
+  std::string UnitOf(int point_id, bool is_virtual) const;
+
+  /**
+   * @brief DB의 데이터포인트/가상포인트 전체를 다시 로드 (스냅샷 교체)
+   * @return 로드된 포인트 수
+   */
+  size_t LoadAll();
+
+  /**
+   * @brief 한 디바이스의 데이터포인트만 다시 로드
+   * @details DB에서 사라진 포인트는 스냅샷에서도 제거된다.
+   * @return 갱신된 포인트 수
+   */
+  size_t RefreshDevice(int device_id);
+
+  /**
+   * @brief 직접 등록/교체 (DB 없이 구성하는 테스트·벤치마크용)
+   */
+  void Upsert(PointMetadata metadata);
+
+  uint64_t Generation() const {
+    return generation_.load(std::memory_order_acquire);
+  }
+
+  size_t Size() const {
+    auto snapshot = GetSnapshot();
+    return snapshot->points.size() + snapshot->virtual_points.size();
+  }
+
+private:
+  PointMetadataRegistry();
+  ~PointMetadataRegistry() = default;
+
+  // write_mutex_ 보유 상태에서 호출
+  void PublishLocked(PointMap &&points, PointMap &&virtual_points);
+  std::string DeviceNameOf(int device_id);
+
+  std::shared_ptr<const Snapshot> snapshot_; // std::atomic_load/store로만 접근
+  std::atomic<uint64_t> generation_{0};
+  std::mutex write_mutex_;
+};
+
+} // namespace Pipeline
+} // namespace PulseOne
+
+#endif // PULSEONE_PIPELINE_POINT_METADATA_REGISTRY_H
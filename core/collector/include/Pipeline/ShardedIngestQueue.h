@@ -0,0 +1,294 @@
+// =============================================================================
+// collector/include/Pipeline/ShardedIngestQueue.h - 락프리 샤드 수집 큐
+// 🔥 PipelineManager의 mutex + std::queue 대체
+// =============================================================================
+
+#ifndef PULSEONE_PIPELINE_SHARDED_INGEST_QUEUE_H
+#define PULSEONE_PIPELINE_SHARDED_INGEST_QUEUE_H
+
+#include "Common/Structs.h"
+#include "Pipeline/PipelineMetrics.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace PulseOne {
+namespace Pipeline {
+
+/**
+ * @brief 고정 크기 MPMC 링 버퍼 (Vyukov bounded queue)
+ * @details 슬롯마다 시퀀스 번호를 두어 생산자/소비자가 CAS 한 번으로
+ * 위치를 확보한다. 용량은 2의 거듭제곱으로 올림된다.
+ */
+template <typename T> class BoundedRingBuffer {
+public:
+  explicit BoundedRingBuffer(size_t capacity) {
+    size_t size = 2;
+    while (size < capacity) {
+      size <<= 1;
+    }
+    mask_ = size - 1;
+    cells_.reset(new Cell[size]);
+    for (size_t i = 0; i < size; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  BoundedRingBuffer(const BoundedRingBuffer &) = delete;
+  BoundedRingBuffer &operator=(const BoundedRingBuffer &) = delete;
+
+  bool TryPush(T &&item) {
+    Cell *cell;
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      size_t seq = cell->sequence.load(std::memory_order_acquire);
+      intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false; // 가득 참
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    cell->data = std::move(item);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool TryPop(T &out) {
+    Cell *cell;
+    size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      size_t seq = cell->sequence.load(std::memory_order_acquire);
+      intptr_t diff =
+          static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false; // 비어 있음
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    out = std::move(cell->data);
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+  size_t Capacity() const { return mask_ + 1; }
+
+private:
+  struct Cell {
+    std::atomic<size_t> sequence{0};
+    T data{};
+  };
+
+  std::unique_ptr<Cell[]> cells_;
+  size_t mask_ = 0;
+  alignas(64) std::atomic<size_t> enqueue_pos_{0};
+  alignas(64) std::atomic<size_t> dequeue_pos_{0};
+};
+
+/**
+ * @brief 레인 dequeue 정책
+ * - STRICT: 상위 레인이 빌 때까지 하위 레인은 꺼내지 않음
+ * - WEIGHTED: 배치마다 레인 가중치 비율로 몫을 나누고, 남는 자리는
+ *   상위 레인부터 채움 (하위 레인 기아 방지)
+ */
+enum class LaneDequeuePolicy { STRICT, WEIGHTED };
+
+/**
+ * @brief 레인별 통계 스냅샷
+ */
+struct IngestLaneStats {
+  size_t depth = 0;
+  size_t admission_limit = 0;
+  uint32_t weight = 1;
+  uint64_t pushed = 0;
+  uint64_t popped = 0;
+  uint64_t dropped = 0;
+  double avg_wait_ms = 0.0; // 큐 체류 시간 평균
+  double max_wait_ms = 0.0; // 큐 체류 시간 최대
+};
+
+/**
+ * @brief device_id 해시로 샤드를 고르는 락프리 수집 큐 (우선순위 레인 지원)
+ * @details
+ * - Worker는 메시지를 move로 넣고, 같은 디바이스/레인은 항상 같은 샤드로
+ *   가므로 레인 내 디바이스 단위 FIFO 순서가 유지된다.
+ * - 레인 0이 가장 높은 우선순위. 레인마다 admission limit을 두어
+ *   일반 데이터가 큐를 가득 채워도 긴급 데이터가 들어갈 자리를 남긴다.
+ * - 소비자는 비어 있으면 sleep 폴링 대신 condition_variable로 대기한다
+ *   (생산자는 대기자가 있을 때만 notify).
+ * - 소비자 친화(affinity) 모드에서는 샤드 s를 소비자 (s % N)만 꺼내므로
+ *   한 디바이스의 메시지는 항상 같은 처리 스레드에서 순서대로 처리된다.
+ * - 전체 용량은 원자적 카운터로 제한된다.
+ */
+class ShardedIngestQueue {
+public:
+  ShardedIngestQueue(size_t capacity, size_t shard_count,
+                     size_t lane_count = 1);
+
+  ShardedIngestQueue(const ShardedIngestQueue &) = delete;
+  ShardedIngestQueue &operator=(const ShardedIngestQueue &) = delete;
+
+  /**
+   * @brief 레인 가중치/허용 한도 설정 (소비 시작 전 호출)
+   * @param admission_limit 이 레인이 차지할 수 있는 최대 메시지 수
+   */
+  void ConfigureLane(size_t lane, uint32_t weight, size_t admission_limit);
+  void SetDequeuePolicy(LaneDequeuePolicy policy) { policy_.store(policy); }
+
+  /**
+   * @brief 레인 체류 시간을 기록할 히스토그램 연결 (소비 시작 전 호출)
+   */
+  void SetLaneWaitHistogram(size_t lane, LatencyHistogram *histogram);
+  LaneDequeuePolicy GetDequeuePolicy() const { return policy_.load(); }
+
+  /**
+   * @brief 메시지 추가 (move)
+   * @return 용량 초과 또는 닫힌 상태면 false (message는 그대로 남음)
+   */
+  bool Push(Structs::DeviceDataMessage &&message, size_t lane = 0);
+
+  /**
+   * @brief 최대 max_items개를 out에 추가 (레인 정책 적용)
+   * @details 큐가 비어 있으면 timeout 동안 대기한다.
+   * @return 추가된 메시지 수
+   */
+  size_t PopBatch(std::vector<Structs::DeviceDataMessage> &out,
+                  size_t max_items, std::chrono::milliseconds timeout);
+
+  /**
+   * @brief 친화 모드와 무관하게 모든 샤드에서 최대 max_items개를 꺼냄 (대기 없음)
+   * @details 종료 시 남은 메시지 정리용. 친화 설정은 바꾸지 않는다.
+   */
+  size_t DrainAll(std::vector<Structs::DeviceDataMessage> &out,
+                  size_t max_items);
+
+  /**
+   * @brief 소비자 친화 모드 설정
+   * @param consumer_count 0이면 해제 (모든 소비자가 모든 샤드 소비).
+   * 샤드 수보다 클 수 없으며, 소비 시작 전에 호출해야 한다.
+   * @return 실제 적용된 소비자 수
+   */
+  size_t SetConsumerAffinity(size_t consumer_count);
+  size_t GetConsumerAffinity() const { return affinity_consumers_.load(); }
+
+  /**
+   * @brief 친화 모드에서 consumer_index가 소유한 샤드만 꺼냄
+   * @details 친화 모드가 아니면 PopBatch와 같다.
+   */
+  size_t PopBatchFor(size_t consumer_index,
+                     std::vector<Structs::DeviceDataMessage> &out,
+                     size_t max_items, std::chrono::milliseconds timeout);
+
+  /**
+   * @brief 대기 중인 소비자를 모두 깨우고 이후 Push를 거부
+   */
+  void Close();
+  void Open();
+
+  /**
+   * @brief 남은 메시지 폐기
+   * @return 폐기된 메시지 수
+   */
+  size_t Clear();
+
+  size_t Size() const { return size_.load(std::memory_order_relaxed); }
+  size_t Capacity() const { return capacity_; }
+  size_t ShardCount() const { return shard_count_; }
+  size_t LaneCount() const { return lanes_.size(); }
+  bool IsClosed() const { return closed_.load(std::memory_order_acquire); }
+
+  /**
+   * @brief 레인의 현재 대기 메시지 수 (통계 스냅샷 없이 빠르게 조회)
+   */
+  size_t LaneSize(size_t lane) const {
+    return lane < lanes_.size()
+               ? lanes_[lane]->size.load(std::memory_order_relaxed)
+               : 0;
+  }
+
+  IngestLaneStats GetLaneStats(size_t lane) const;
+  void ResetLaneStats();
+
+private:
+  struct Node {
+    Structs::DeviceDataMessage message;
+    std::chrono::steady_clock::time_point enqueued_at;
+  };
+  using NodePtr = std::unique_ptr<Node>;
+
+  struct Lane {
+    std::vector<std::unique_ptr<BoundedRingBuffer<NodePtr>>> shards;
+    size_t admission_limit = 0;
+    uint32_t weight = 1;
+    alignas(64) std::atomic<size_t> size{0};
+    std::atomic<size_t> next_shard{0};
+    std::atomic<uint64_t> pushed{0};
+    std::atomic<uint64_t> popped{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<uint64_t> total_wait_us{0};
+    std::atomic<uint64_t> max_wait_us{0};
+    LatencyHistogram *wait_histogram = nullptr;
+  };
+
+  // 빈 큐 대기 슬롯 (공유 모드는 0번만, 친화 모드는 소비자별)
+  struct WaitSlot {
+    std::atomic<int> waiters{0};
+    std::mutex mutex;
+    std::condition_variable cv;
+  };
+
+  // 소비자가 볼 샤드 범위: first, first + stride, ...
+  struct ShardView {
+    size_t first = 0;
+    size_t stride = 1;
+  };
+
+  size_t ShardFor(const std::string &device_id) const;
+  ShardView ViewFor(size_t consumer_index) const;
+  size_t PendingIn(const ShardView &view) const;
+  void NotifyOwner(size_t shard);
+  size_t DrainLane(Lane &lane, const ShardView &view,
+                   std::vector<Structs::DeviceDataMessage> &out,
+                   size_t max_items);
+  size_t DrainInto(const ShardView &view,
+                   std::vector<Structs::DeviceDataMessage> &out,
+                   size_t max_items);
+
+  const size_t capacity_;
+  size_t shard_count_;
+  std::vector<std::unique_ptr<Lane>> lanes_;
+  std::atomic<LaneDequeuePolicy> policy_{LaneDequeuePolicy::WEIGHTED};
+
+  alignas(64) std::atomic<size_t> size_{0};
+  std::atomic<bool> closed_{false};
+
+  // 샤드별 대기 메시지 수 (레인 합계) - 친화 모드 대기 조건용
+  std::unique_ptr<std::atomic<size_t>[]> shard_pending_;
+  std::atomic<size_t> affinity_consumers_{0};
+
+  // 빈 큐 대기용 (핫패스에서는 잡지 않음)
+  std::vector<std::unique_ptr<WaitSlot>> wait_slots_;
+};
+
+} // namespace Pipeline
+} // namespace PulseOne
+
+#endif // PULSEONE_PIPELINE_SHARDED_INGEST_QUEUE_H
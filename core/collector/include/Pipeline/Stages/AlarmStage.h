@@ -15,6 +15,7 @@ public:
     virtual ~AlarmStage() = default;
 
     bool Process(PipelineContext& context) override;
+    void ProcessBatch(std::vector<PipelineContext>& batch) override;
     std::string GetName() const override { return "AlarmStage"; }
     
     // Define public getter for events so PersistenceStage can access them?
@@ -0,0 +1,133 @@
+#pragma once
+
+#ifndef DEADBAND_STAGE_H
+#define DEADBAND_STAGE_H
+
+#include "Pipeline/IPipelineStage.h"
+#include "Pipeline/PointIndexRegistry.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace PulseOne::Pipeline::Stages {
+
+/**
+ * @brief Report-by-exception filter placed before alarm evaluation and
+ * persistence.
+ *
+ * A sample of a configured data point is passed on only when it differs from
+ * the last reported sample by more than the point's deadband, when its
+ * quality changed, or when the point has been silent for longer than the
+ * heartbeat. Everything else is removed from the message, so alarm, Redis
+ * and Influx work scale with the change rate instead of the poll rate.
+ *
+ * - Deadband: max(log_deadband, PIPELINE_DEADBAND_PERCENT of the configured
+ *   min/max span, or of the last value when no span is configured).
+ *   Points with alarms enabled fall back to exact-change so a value can never
+ *   cross an alarm limit unseen.
+ * - Heartbeat: log_interval_ms, or PIPELINE_DEADBAND_HEARTBEAT_SEC when 0.
+ * - Points with log_enabled = false, unknown points and virtual points are
+ *   passed through untouched.
+ * - Settings are re-read when PointMetadataRegistry's generation changes,
+ *   i.e. after config:reload (LoadAll) or a device settings reload
+ *   (RefreshDevice). The PIPELINE_DEADBAND_* keys are re-read as well.
+ *   The new table is built on a background task and swapped in atomically;
+ *   until then every thread keeps filtering with the previous table.
+ */
+class DeadbandStage : public IPipelineStage {
+public:
+    DeadbandStage();
+    virtual ~DeadbandStage();
+
+    bool Process(PipelineContext& context) override;
+    void ProcessBatch(std::vector<PipelineContext>& batch) override;
+    std::string GetName() const override { return "DeadbandStage"; }
+
+    /**
+     * @brief Re-read per-point deadband settings from the DataPoint repository.
+     * @details Builds a complete table and publishes it in one step. Last
+     * reported samples are kept, so a reload does not cause a burst of
+     * reports. If the repository cannot be read the previous table stays.
+     * @return Number of points with a deadband configuration.
+     */
+    size_t LoadConfiguration();
+
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+    uint64_t GetPassedCount() const { return passed_.load(); }
+    uint64_t GetSuppressedCount() const { return suppressed_.load(); }
+    uint64_t GetHeartbeatCount() const { return heartbeats_.load(); }
+
+private:
+    // Per-point settings (from DataPoint), immutable once published
+    struct PointConfig {
+        bool configured = false;
+        bool exact_change_only = false;
+        double absolute_deadband = 0.0;
+        double span = 0.0;
+        int64_t heartbeat_ms = 0;
+    };
+
+    struct ConfigTable {
+        std::vector<PointConfig> points; // by PointIndexRegistry index
+        double percent_deadband = 0.0;
+
+        const PointConfig* Find(uint32_t index) const {
+            return index < points.size() && points[index].configured
+                       ? &points[index]
+                       : nullptr;
+        }
+    };
+
+    // Last reported sample
+    struct PointState {
+        bool has_last = false;
+        bool last_numeric = false;
+        double last_value = 0.0;
+        size_t last_hash = 0; // non-numeric values
+        uint8_t last_quality = 0;
+        int64_t last_report_ms = 0;
+    };
+
+    static constexpr size_t STRIPE_COUNT = 64;
+
+    // Returns true when the sample must be passed on
+    bool ShouldReport(const ConfigTable& config,
+                      const Structs::TimestampedValue& point, int64_t now_ms);
+
+    size_t FilterContext(const ConfigTable& config, PipelineContext& context,
+                         int64_t now_ms);
+
+    // Starts one background reload per metadata generation and returns at
+    // once; the caller keeps filtering with the current table
+    void ReloadIfChanged();
+
+    std::shared_ptr<const ConfigTable> GetConfig() const {
+        return std::atomic_load_explicit(&config_, std::memory_order_acquire);
+    }
+
+    std::mutex& StripeFor(uint32_t index) {
+        return stripes_[index & (STRIPE_COUNT - 1)];
+    }
+
+    PointStateArray<PointState> states_;
+    std::array<std::mutex, STRIPE_COUNT> stripes_;
+
+    std::shared_ptr<const ConfigTable> config_; // std::atomic_load/store only
+    std::atomic<bool> enabled_{false};
+    std::atomic<uint64_t> loaded_generation_{0};
+    std::mutex reload_mutex_;
+    std::future<size_t> reload_task_; // guarded by reload_mutex_
+
+    std::atomic<uint64_t> passed_{0};
+    std::atomic<uint64_t> suppressed_{0};
+    std::atomic<uint64_t> heartbeats_{0};
+};
+
+} // namespace PulseOne::Pipeline::Stages
+
+#endif // DEADBAND_STAGE_H
@@ -14,6 +14,7 @@ public:
     virtual ~EnrichmentStage() = default;
 
     bool Process(PipelineContext& context) override;
+    void ProcessBatch(std::vector<PipelineContext>& batch) override;
     std::string GetName() const override { return "EnrichmentStage"; }
 
 private:
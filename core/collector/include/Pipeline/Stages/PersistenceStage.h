@@ -24,15 +24,17 @@ public:
     virtual ~PersistenceStage() = default;
 
     bool Process(PipelineContext& context) override;
+    void ProcessBatch(std::vector<PipelineContext>& batch) override;
     std::string GetName() const override { return "PersistenceStage"; }
 
 private:
    std::shared_ptr<Storage::RedisDataWriter> redis_writer_;
    std::shared_ptr<IPersistenceQueue> persistence_queue_;
    
-   void SaveToRedis(PipelineContext& context);
-   void QueueForRDB(PipelineContext& context);
-   void BufferForInflux(PipelineContext& context);
+   void PublishAlarms(const PipelineContext& context);
+   void SaveWorkerStatus(const Structs::DeviceDataMessage& message);
+   void FailContext(PipelineContext& context, const std::string& step,
+                    const std::exception& e);
 };
 
 } // namespace PulseOne::Pipeline::Stages
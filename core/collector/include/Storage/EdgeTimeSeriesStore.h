@@ -0,0 +1,254 @@
+// =============================================================================
+// collector/include/Storage/EdgeTimeSeriesStore.h - 내장 엣지 시계열 저장소
+// 🔥 InfluxDB가 없는 현장용 이력 저장. 포인트별 Gorilla 압축 청크를 시간
+//    파티션 파일에 추가하고, 크기/기간 보존 + 범위/집계 조회 제공
+// =============================================================================
+
+#ifndef PULSEONE_STORAGE_EDGE_TIME_SERIES_STORE_H
+#define PULSEONE_STORAGE_EDGE_TIME_SERIES_STORE_H
+
+#include "Pipeline/PointIndexRegistry.h"
+#include "Storage/GorillaCodec.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace PulseOne {
+namespace Storage {
+
+/**
+ * @brief 엣지 시계열 저장소 설정 (EDGE_TSDB_* 키)
+ */
+struct EdgeTsdbOptions {
+  bool enabled = false;
+  std::string directory = "./data/tsdb";
+  int partition_minutes = 60;      // 파티션(파일) 하나의 시간 폭
+  uint32_t chunk_max_samples = 512; // 청크 봉인 샘플 수
+  int chunk_max_age_s = 600;        // 샘플이 적은 포인트도 이 시간 후 봉인
+  int late_grace_s = 300;  // 파티션 구간이 끝난 뒤에도 늦은 샘플을 받는 시간
+  int max_future_s = 300;  // 현재 시각보다 이만큼 넘게 앞선 샘플은 버림
+  uint64_t max_open_bytes = 32ULL * 1024 * 1024; // 열린 청크 전체 RAM 상한
+  uint64_t write_buffer_bytes = 256 * 1024;      // 파일 쓰기 버퍼
+  int retention_hours = 24 * 30;                 // 0이면 기간 보존 없음
+  uint64_t max_disk_bytes = 2ULL * 1024 * 1024 * 1024; // 0이면 크기 제한 없음
+  int maintenance_interval_s = 5;
+
+  static EdgeTsdbOptions FromConfig();
+};
+
+struct EdgeTsdbSample {
+  int64_t timestamp_ms = 0;
+  double value = 0.0;
+};
+
+struct EdgeTsdbBucket {
+  int64_t start_ms = 0;
+  double min = 0.0;
+  double max = 0.0;
+  double mean = 0.0;
+  double last = 0.0;
+  uint64_t count = 0;
+};
+
+struct EdgeTsdbStats {
+  bool enabled = false;
+  uint64_t samples = 0;         // 기록된 샘플 수
+  uint64_t out_of_order = 0;    // 포인트의 마지막 샘플보다 이르거나 같아 버림
+  uint64_t late_samples = 0;    // 유예 시간이 지난 파티션에 속해 버림
+  uint64_t future_samples = 0;  // 현재 시각보다 max_future_s 넘게 앞서 버림
+  uint64_t chunks_sealed = 0;
+  uint64_t pressure_seals = 0;  // RAM 상한 초과로 전체 봉인한 횟수
+  uint64_t partitions_dropped = 0;
+  uint64_t corrupt_chunks = 0;  // 복구 중 체크섬 불일치로 잘라낸 청크
+  uint64_t open_bytes = 0;
+  uint64_t disk_bytes = 0;
+  size_t partitions = 0;
+};
+
+/**
+ * @brief 내장 시계열 저장소 (싱글톤)
+ * @details
+ * - 포인트별 열린 청크는 PointIndexRegistry 밀집 인덱스로 보관한다. 청크가
+ *   샘플 수/나이 한도에 닿거나 열린 청크 전체가 RAM 상한을 넘으면 봉인해
+ *   그 청크가 속한 파티션 파일(p<시작ms>.dat)에 추가한다.
+ * - 파티션 수명은 벽시계로 정한다. 샘플 시각이 속한 파티션이 쓰기 중이
+ *   아니면 새로 열고, 구간 끝 + late_grace_s가 지나면 Maintain()이 닫는다.
+ *   따라서 경계 직후 파이프라인에 남아 있던 이전 구간 샘플도 받고, 한
+ *   디바이스의 시계가 앞서 있어도 다른 디바이스의 파티션을 닫지 않는다.
+ *   현재 시각보다 max_future_s 넘게 앞선 샘플은 파티션을 열지 않고 버린다.
+ * - 쓰기 중 파티션의 청크 색인은 메모리에 두고, 닫을 때 (point_id, t_min)
+ *   순으로 정렬해 p<시작ms>.idx로 쓴다. 닫힌 파티션은 조회 시 색인 파일을
+ *   이진 탐색하므로 RAM을 쓰지 않는다.
+ * - 청크 레코드: [헤더 40B: magic, point_id, count, bit_count, t_min, t_max,
+ *   payload_len, 체크섬][Gorilla 페이로드]. 시작 시 색인이 없는 파티션은
+ *   데이터 파일을 훑어 색인을 다시 만들고, 깨진 꼬리는 잘라낸다.
+ * - 열린 청크와 쓰기 버퍼는 메모리에만 있고 파이프라인 WAL도 이를 덮지
+ *   않는다. 비정상 종료 시 포인트마다 최대 chunk_max_age_s(+ Maintain
+ *   주기)만큼의 샘플을 잃는다 (Close()는 모두 봉인).
+ * - 쓰기는 Persistence 스레드 하나, 조회는 REST 스레드에서 호출한다.
+ */
+class EdgeTimeSeriesStore {
+public:
+  /**
+   * @brief 샘플 방문자. false를 반환하면 조회 중단
+   */
+  using SampleVisitor = std::function<bool(int64_t timestamp_ms, double value)>;
+
+  static EdgeTimeSeriesStore &getInstance();
+
+  EdgeTimeSeriesStore(const EdgeTimeSeriesStore &) = delete;
+  EdgeTimeSeriesStore &operator=(const EdgeTimeSeriesStore &) = delete;
+
+  /**
+   * @brief 디렉토리를 열고 기존 파티션을 복구
+   * @return 성공 여부 (실패 시 비활성 상태 유지)
+   */
+  bool Open(const EdgeTsdbOptions &options);
+
+  /**
+   * @brief 열린 청크를 모두 봉인하고 현재 파티션 색인을 쓴 뒤 닫음
+   */
+  void Close();
+
+  bool IsEnabled() const { return enabled_.load(std::memory_order_acquire); }
+
+  /**
+   * @brief 샘플 추가 (Persistence 스레드). 포인트별 타임스탬프는 증가해야 함
+   */
+  void Append(int point_id, int64_t timestamp_ms, double value);
+
+  /**
+   * @brief 오래된 청크 봉인 / 쓰기 버퍼 플러시 / 보존 정책 적용
+   * @details maintenance_interval_s마다 한 번만 실제로 수행한다.
+   */
+  void Maintain(int64_t now_ms);
+
+  /**
+   * @brief [from_ms, to_ms] 범위 샘플을 시간 순으로 방문
+   */
+  void Scan(int point_id, int64_t from_ms, int64_t to_ms,
+            const SampleVisitor &visitor) const;
+
+  /**
+   * @brief 원시 샘플 조회 (최대 limit개)
+   */
+  std::vector<EdgeTsdbSample> Query(int point_id, int64_t from_ms,
+                                    int64_t to_ms, size_t limit) const;
+
+  /**
+   * @brief bucket_ms 간격 min/max/mean/last/count 집계
+   */
+  std::vector<EdgeTsdbBucket> Aggregate(int point_id, int64_t from_ms,
+                                        int64_t to_ms,
+                                        int64_t bucket_ms) const;
+
+  EdgeTsdbStats GetStats() const;
+
+private:
+  EdgeTimeSeriesStore() = default;
+  ~EdgeTimeSeriesStore();
+
+  struct IndexEntry {
+    int32_t point_id = 0;
+    uint32_t count = 0;
+    int64_t t_min = 0;
+    int64_t t_max = 0;
+    uint64_t offset = 0; // 데이터 파일 내 청크 헤더 위치
+  };
+
+  struct Partition {
+    int64_t start_ms = 0;
+    uint64_t bytes = 0; // .dat + .idx
+  };
+
+  struct OpenChunk {
+    GorillaEncoder encoder;
+    int32_t point_id = 0;
+    int64_t partition_start = 0; // 인코더 내용이 속한 파티션
+    bool has_last = false; // 봉인 후에도 유지 (역순 샘플 판정)
+    int64_t last_ts = 0;
+  };
+
+  // 조회용으로 잘라 낸 열린 청크 사본
+  struct ChunkCopy {
+    std::string bytes;
+    uint64_t bit_count = 0;
+    uint32_t count = 0;
+  };
+
+  // 쓰기 중 파티션
+  struct WritablePartition {
+    int64_t start_ms = 0;
+    std::FILE *file = nullptr;
+    uint64_t file_bytes = 0; // 버퍼 포함 논리 크기
+    std::string write_buffer;
+    std::vector<IndexEntry> index;
+  };
+
+  // 아래 *Locked 함수는 mutex_ 보유 상태에서 호출
+  WritablePartition *FindWritableLocked(int64_t start_ms);
+  WritablePartition *OpenPartitionLocked(int64_t start_ms);
+  void ClosePartitionLocked(size_t position); // writable_[position]
+  void SealLocked(OpenChunk &chunk);
+  void SealPartitionLocked(int64_t start_ms); // 이 파티션 소속 청크만
+  void SealAllLocked();
+  // 조회 전 쓰기 버퍼 내용을 파일에 반영
+  static void FlushBuffer(WritablePartition &partition);
+  void FlushAllLocked() const;
+  void ApplyRetentionLocked(int64_t now_ms);
+
+  std::string DataPath(int64_t start_ms) const;
+  std::string IndexPath(int64_t start_ms) const;
+  int64_t PartitionStart(int64_t timestamp_ms) const;
+  int64_t PartitionWidthMs() const;
+
+  // 파일 작업 (락 없음)
+  bool RebuildIndex(int64_t start_ms, std::vector<IndexEntry> &entries);
+  static bool WriteIndexFile(const std::string &path,
+                             std::vector<IndexEntry> &entries);
+  static bool ReadIndexFile(const std::string &path,
+                            std::vector<IndexEntry> &entries);
+  static bool CheckIndexFile(const std::string &path); // 헤더/크기만 검사
+  static bool FindInIndexFile(const std::string &path, int point_id,
+                              int64_t from_ms, int64_t to_ms,
+                              std::vector<IndexEntry> &out);
+  static bool ScanChunks(const std::string &data_path,
+                         const std::vector<IndexEntry> &entries,
+                         int64_t from_ms, int64_t to_ms,
+                         const SampleVisitor &visitor);
+  static bool ScanChunk(const char *data, uint64_t bit_count, uint32_t count,
+                        int64_t from_ms, int64_t to_ms,
+                        const SampleVisitor &visitor);
+
+  EdgeTsdbOptions options_;
+  std::atomic<bool> enabled_{false};
+
+  mutable std::mutex mutex_;
+  Pipeline::PointStateArray<OpenChunk> open_chunks_;
+  uint64_t open_bytes_ = 0;
+
+  // 쓰기 중 파티션 (시작 시각 오름차순). 보통 현재 구간 하나, 경계 직후에는
+  // 유예 중인 이전 구간까지 둘
+  mutable std::vector<WritablePartition> writable_;
+
+  std::vector<Partition> partitions_; // 닫힌 파티션 (시작 시각 오름차순)
+  int64_t next_maintenance_ms_ = 0;
+
+  std::atomic<uint64_t> samples_{0};
+  std::atomic<uint64_t> out_of_order_{0};
+  std::atomic<uint64_t> late_samples_{0};
+  std::atomic<uint64_t> future_samples_{0};
+  std::atomic<uint64_t> chunks_sealed_{0};
+  std::atomic<uint64_t> pressure_seals_{0};
+  std::atomic<uint64_t> partitions_dropped_{0};
+  std::atomic<uint64_t> corrupt_chunks_{0};
+};
+
+} // namespace Storage
+} // namespace PulseOne
+
+#endif // PULSEONE_STORAGE_EDGE_TIME_SERIES_STORE_H
@@ -0,0 +1,90 @@
+// =============================================================================
+// collector/include/Storage/GorillaCodec.h - Gorilla 방식 시계열 압축
+// 🔥 타임스탬프는 delta-of-delta, 값은 이전 값과의 XOR로 비트 단위 인코딩
+//    (일정 주기 + 완만한 변화 샘플은 샘플당 1~2바이트 수준)
+// =============================================================================
+
+#ifndef PULSEONE_STORAGE_GORILLA_CODEC_H
+#define PULSEONE_STORAGE_GORILLA_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace PulseOne {
+namespace Storage {
+
+/**
+ * @brief 청크 인코더 (타임스탬프 ms + double)
+ * @details
+ * - 첫 샘플은 64비트 그대로, 이후 타임스탬프는 delta-of-delta를
+ *   '0' / '10'+7 / '110'+9 / '1110'+12 / '1111'+64 비트로 기록한다.
+ * - 값은 이전 값과 XOR해 0이면 '0', 아니면 이전 유효 비트 구간에 들어가면
+ *   '10'+구간, 아니면 '11'+선행 0 개수(5)+길이(6)+유효 비트로 기록한다.
+ * - 타임스탬프는 단조 증가해야 한다 (호출 측에서 보장).
+ */
+class GorillaEncoder {
+public:
+  void Append(int64_t timestamp_ms, double value);
+
+  /**
+   * @brief 비운다. 버퍼 메모리까지 반환 (열린 청크 RAM 상한 유지용)
+   */
+  void Clear();
+
+  uint32_t Count() const { return count_; }
+  bool Empty() const { return count_ == 0; }
+  int64_t FirstTimestamp() const { return first_ts_; }
+  int64_t LastTimestamp() const { return prev_ts_; }
+
+  const std::string &Bytes() const { return bytes_; }
+  uint64_t BitCount() const { return bit_count_; }
+
+private:
+  void WriteBits(uint64_t value, int bits);
+
+  std::string bytes_;
+  uint64_t bit_count_ = 0;
+  uint32_t count_ = 0;
+  int64_t first_ts_ = 0;
+  int64_t prev_ts_ = 0;
+  int64_t prev_delta_ = 0;
+  uint64_t prev_value_ = 0;
+  int prev_leading_ = -1; // -1 = 아직 유효 비트 구간 없음
+  int prev_trailing_ = 0;
+};
+
+/**
+ * @brief 청크 디코더 (인코더 출력 바이트를 복사 없이 읽음)
+ */
+class GorillaDecoder {
+public:
+  GorillaDecoder(const char *data, uint64_t bit_count, uint32_t count)
+      : data_(reinterpret_cast<const uint8_t *>(data)), bit_count_(bit_count),
+        remaining_(count) {}
+
+  /**
+   * @return 다음 샘플이 있으면 true. 비트가 모자라면(손상) false
+   */
+  bool Next(int64_t &timestamp_ms, double &value);
+
+private:
+  bool ReadBits(int bits, uint64_t &out);
+  bool ReadBit(bool &out);
+
+  const uint8_t *data_;
+  uint64_t bit_count_;
+  uint64_t pos_ = 0;
+  uint32_t remaining_;
+  bool first_ = true;
+  int64_t prev_ts_ = 0;
+  int64_t prev_delta_ = 0;
+  uint64_t prev_value_ = 0;
+  int prev_leading_ = 0;
+  int prev_trailing_ = 0;
+};
+
+} // namespace Storage
+} // namespace PulseOne
+
+#endif // PULSEONE_STORAGE_GORILLA_CODEC_H
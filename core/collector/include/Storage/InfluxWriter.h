@@ -0,0 +1,258 @@
+// =============================================================================
+// collector/include/Storage/InfluxWriter.h - 비동기 InfluxDB 배치 라이터
+// 🔥 Persistence 스레드는 큐에 넣기만 하고, HTTP 전송/재시도/스풀은 전용 스레드
+// =============================================================================
+
+#ifndef PULSEONE_STORAGE_INFLUX_WRITER_H
+#define PULSEONE_STORAGE_INFLUX_WRITER_H
+
+#include "Client/HttpClient.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace PulseOne {
+namespace Storage {
+
+/**
+ * @brief 라인 프로토콜 타임스탬프 정밀도 (InfluxDB v2 precision 파라미터)
+ */
+enum class InfluxPrecision : uint8_t { SECONDS = 0, MILLIS, MICROS, NANOS };
+
+/**
+ * @brief InfluxWriter 설정
+ * @details 연결 정보(url/token/org/bucket)는 호출자가 채우고,
+ * 나머지는 FromConfig()가 INFLUX_WRITER_* 키에서 읽는다.
+ */
+struct InfluxWriterOptions {
+  std::string url;
+  std::string token;
+  std::string org;
+  std::string bucket;
+
+  InfluxPrecision precision = InfluxPrecision::MILLIS;
+  size_t batch_max_lines = 5000;        // 이 줄 수가 모이면 즉시 전송
+  size_t batch_max_bytes = 1024 * 1024; // 이 크기가 모이면 즉시 전송
+  int flush_interval_ms = 1000;         // 덜 찼어도 이 주기마다 전송
+  bool gzip = true;                     // Content-Encoding: gzip
+  size_t gzip_min_bytes = 1024;         // 이보다 작은 본문은 압축하지 않음
+  int max_retries = 4;                  // 재시도 가능한 실패의 재시도 횟수
+  int retry_base_ms = 200;              // 지수 백오프 시작값 (지터 적용)
+  int retry_max_ms = 10000;             // 백오프 상한 = 오프라인 재연결 주기
+  size_t queue_max_lines = 200000;      // 메모리 큐 한도 (초과분은 드롭)
+  int timeout_sec = 10;
+
+  std::string spool_dir;                      // 비어 있으면 스풀 비활성
+  uint64_t spool_max_bytes = 512ull << 20;    // 스풀 파일 한도
+
+  /**
+   * @brief INFLUX_WRITER_* 설정 키로 튜닝 값을 채운 기본 옵션
+   */
+  static InfluxWriterOptions FromConfig();
+};
+
+/**
+ * @brief InfluxWriter 통계 스냅샷
+ */
+struct InfluxWriterStats {
+  bool running = false;
+  bool online = false;
+  uint64_t queued = 0;         // 큐에 들어온 줄 수
+  uint64_t written = 0;        // 전송 성공한 줄 수 (스풀 재생 포함)
+  uint64_t dropped = 0;        // 큐 초과/스풀 초과/4xx 거부로 버린 줄 수
+  uint64_t requests = 0;       // HTTP 요청 수 (재시도 포함)
+  uint64_t retries = 0;
+  uint64_t failed_batches = 0; // 재시도 후에도 실패한 배치 수
+  uint64_t spooled = 0;        // 스풀 파일에 기록한 줄 수
+  uint64_t replayed = 0;       // 스풀에서 재전송한 줄 수
+  uint64_t bytes_raw = 0;      // 압축 전 본문 바이트
+  uint64_t bytes_sent = 0;     // 실제 전송 바이트
+  size_t queue_depth = 0;
+  uint64_t spool_bytes = 0;    // 아직 재생되지 않은 스풀 바이트
+  uint64_t deletes = 0;        // 성공한 보존 기간 삭제 요청 수
+};
+
+/**
+ * @brief 비동기 InfluxDB v2 라인 프로토콜 라이터
+ * @details
+ * - Enqueue는 큐에 줄을 넣고 바로 반환한다 (Influx 지연이 Persistence
+ *   스레드를 막지 않음).
+ * - 전용 스레드가 줄 수/바이트/주기 기준으로 배치를 만들어 gzip으로 POST한다.
+ * - 네트워크 오류, 408/429, 5xx는 지터가 들어간 지수 백오프로 재시도하고,
+ *   그래도 실패하면 오프라인으로 전환해 배치를 스풀 파일에 덧붙인다.
+ *   오프라인 동안은 retry_max_ms마다 한 번씩만 연결을 시험한다.
+ * - 다시 연결되면 스풀 파일을 앞에서부터 재전송한다. 읽기 위치는 별도
+ *   파일에 저장하므로 재시작 후에도 이어서 재생한다 (전송 직후 크래시하면
+ *   한 배치가 중복될 수 있으나 같은 시리즈/타임스탬프는 덮어쓰기라 무해).
+ * - 그 밖의 4xx(잘못된 라인 등)는 재시도해도 소용없으므로 버린다.
+ */
+class InfluxWriter {
+public:
+  InfluxWriter();
+  ~InfluxWriter();
+
+  InfluxWriter(const InfluxWriter &) = delete;
+  InfluxWriter &operator=(const InfluxWriter &) = delete;
+
+  /**
+   * @brief 스풀을 열고 라이터 스레드 시작 (Influx가 내려가 있어도 성공)
+   */
+  bool Start(const InfluxWriterOptions &options);
+
+  /**
+   * @brief 남은 큐를 한 번 전송 시도하고 실패분은 스풀에 남긴 뒤 종료
+   */
+  void Stop();
+
+  bool IsRunning() const { return running_.load(std::memory_order_acquire); }
+  bool IsOnline() const { return online_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief 라인 프로토콜 한 줄 추가 (개행 없이)
+   * @return 큐가 가득 차 드롭되면 false
+   */
+  bool Enqueue(std::string line);
+
+  /**
+   * @brief 여러 줄을 한 번의 락으로 추가
+   * @return 큐에 들어간 줄 수
+   */
+  size_t Enqueue(std::vector<std::string> &&lines);
+
+  /**
+   * @brief 이미 인코딩된 여러 줄 블록 추가 (각 줄은 '\n'으로 끝나야 함)
+   * @details LineProtocolEncoder로 버퍼 하나에 이어 쓴 결과를 그대로 넘기면
+   * 줄마다 문자열을 만들지 않는다. 블록은 나누지 않고 한 배치에 들어간다.
+   * @param wal_lsns 블록에 담긴 메시지의 파이프라인 WAL LSN. 참조 반환은
+   * 라이터가 맡는다: 전송 성공(또는 재시도해도 소용없는 거부)이나 스풀
+   * 기록 뒤 persisted=true로, 큐 초과/스풀 실패로 드롭되면 false로 반환.
+   * @return 큐에 들어간 줄 수 (한도 초과 시 0)
+   */
+  size_t EnqueueBlock(std::string &&block, size_t lines,
+                      std::vector<uint64_t> &&wal_lsns = {});
+
+  /**
+   * @brief measurement의 before 이전 데이터 삭제 예약 (/api/v2/delete)
+   * @details 보존 기간 정리용. 라이터 스레드가 온라인일 때 다음 배치
+   * 전송 뒤 실행하며, 실패하면 다음 요청 때 다시 시도되도록 그냥 버린다.
+   * 같은 measurement의 대기 중 요청은 새 시각으로 교체된다.
+   */
+  void RequestDelete(const std::string &measurement,
+                     std::chrono::system_clock::time_point before);
+
+  InfluxPrecision GetPrecision() const { return options_.precision; }
+
+  /**
+   * @brief 현재 정밀도에 맞는 라인 프로토콜 타임스탬프
+   */
+  int64_t ToTimestamp(std::chrono::system_clock::time_point time) const {
+    return ToTimestamp(time, options_.precision);
+  }
+  static int64_t ToTimestamp(std::chrono::system_clock::time_point time,
+                             InfluxPrecision precision);
+
+  static const char *PrecisionName(InfluxPrecision precision);
+  static InfluxPrecision ParsePrecision(const std::string &name,
+                                        InfluxPrecision fallback);
+
+  /**
+   * @brief gzip 압축 (zlib 없이 빌드되면 빈 문자열)
+   */
+  static std::string GzipCompress(const std::string &data);
+
+  InfluxWriterStats GetStats() const;
+
+private:
+  enum class SendResult { OK, RETRYABLE, REJECTED, STOPPED };
+
+  // 큐 원소: '\n'으로 끝나는 한 줄 이상
+  struct Block {
+    std::string text;
+    size_t lines = 0;
+    std::vector<uint64_t> wal_lsns; // 전송/스풀 후 반환할 WAL 참조
+  };
+
+  bool PushBlock(std::string &&text, size_t lines,
+                 std::vector<uint64_t> &&wal_lsns);
+  void WriterLoop();
+  size_t TakeBatch(std::string &body, std::vector<uint64_t> &wal_lsns,
+                   bool &stopping);
+  void SendOrSpool(const std::string &body, size_t lines,
+                   const std::vector<uint64_t> &wal_lsns, bool final_attempt);
+  static void ReleaseWal(const std::vector<uint64_t> &wal_lsns,
+                         bool persisted);
+  SendResult Post(const std::string &body, InfluxPrecision precision);
+  void RunPendingDeletes();
+  SendResult SendWithRetry(const std::string &body, InfluxPrecision precision,
+                           int max_retries);
+  int BackoffMs(int attempt);
+  void MarkOffline();
+  void MarkOnline();
+
+  // 스풀 (라이터 스레드 전용, Start/Stop에서는 스레드 밖에서 접근)
+  bool OpenSpool();
+  // offset부터 헤더/체크섬이 맞는 마지막 레코드의 끝 위치
+  static uint64_t ScanSpool(const std::string &path, uint64_t offset,
+                            uint64_t file_size);
+  void CloseSpool();
+  bool SpoolAppend(const std::string &body, size_t lines,
+                   InfluxPrecision precision);
+  void ReplaySpool(size_t max_records);
+  void StoreSpoolReadOffset();
+  void ResetSpool();
+
+  InfluxWriterOptions options_;
+  std::unique_ptr<Client::HttpClient> http_client_;
+  std::string write_path_prefix_; // /api/v2/write?org=..&bucket=..&precision=
+
+  std::thread writer_thread_;
+  mutable std::mutex queue_mutex_;
+  std::condition_variable queue_cv_;
+  std::deque<Block> queue_;
+  size_t queue_lines_ = 0;
+  size_t queue_bytes_ = 0;
+  bool stop_requested_ = false;
+  // measurement → 삭제 기준 시각 (queue_mutex_로 보호)
+  std::vector<std::pair<std::string, std::chrono::system_clock::time_point>>
+      pending_deletes_;
+  std::string delete_path_; // /api/v2/delete?org=..&bucket=..
+
+  std::atomic<bool> running_{false};
+  std::atomic<bool> online_{false};
+  std::chrono::steady_clock::time_point next_probe_{};
+  std::mt19937 jitter_rng_;
+
+  // 스풀 파일: [길이 u32][체크섬 u32][정밀도 u8][줄 수 u32][본문]
+  bool spool_enabled_ = false;
+  std::string spool_path_;
+  std::string spool_offset_path_;
+  std::ofstream spool_out_;
+  uint64_t spool_read_offset_ = 0;
+  std::atomic<uint64_t> spool_size_{0};
+
+  std::atomic<uint64_t> queued_{0};
+  std::atomic<uint64_t> written_{0};
+  std::atomic<uint64_t> dropped_{0};
+  std::atomic<uint64_t> requests_{0};
+  std::atomic<uint64_t> retries_{0};
+  std::atomic<uint64_t> failed_batches_{0};
+  std::atomic<uint64_t> spooled_{0};
+  std::atomic<uint64_t> replayed_{0};
+  std::atomic<uint64_t> bytes_raw_{0};
+  std::atomic<uint64_t> bytes_sent_{0};
+  std::atomic<uint64_t> deletes_{0};
+};
+
+} // namespace Storage
+} // namespace PulseOne
+
+#endif // PULSEONE_STORAGE_INFLUX_WRITER_H
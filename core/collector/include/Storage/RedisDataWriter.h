@@ -11,17 +11,22 @@
 #ifndef REDIS_DATA_WRITER_H
 #define REDIS_DATA_WRITER_H
 
+#include "Client/RedisAsyncClient.h"
 #include "Client/RedisClient.h"
 #include "Common/Enums.h"
 #include "Common/Structs.h"
+#include "Data/RedisValueCodec.h"
 #include "Logging/LogManager.h"
 #include "Storage/BackendFormat.h" // ← 새로 추가!
 #include "nlohmann/json.hpp"
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace PulseOne {
@@ -36,6 +41,16 @@ class RedisDataWriter {
 public:
   enum class StorageMode { LIGHTWEIGHT, FULL_DATA, HYBRID };
 
+  /**
+   * @brief 현재값 키 레이아웃 (REDIS_STORAGE_LAYOUT)
+   * - LEGACY:      포인트마다 device:{num}:{name}, point:{id}:latest 등 개별 키
+   * - DEVICE_HASH: 디바이스마다 device:{num}:values 해시 하나
+   *                (필드 = point_id, 값 = CompactPointValue,
+   *                EXPIRE는 디바이스당 1회)
+   * - BOTH:        둘 다 기록 (리더 이전 기간용)
+   */
+  enum class StorageLayout { LEGACY, DEVICE_HASH, BOTH };
+
   // ==========================================================================
   // 생성자 및 초기화
   // ==========================================================================
@@ -54,6 +69,15 @@ public:
   void EnableDevicePatternStorage(bool enable);
   void EnablePointLatestStorage(bool enable);
   void EnableFullDataStorage(bool enable);
+  void SetStorageLayout(StorageLayout layout);
+
+  /**
+   * @brief 키 패밀리별 값 인코딩 (REDIS_BINARY_FAMILIES)
+   * @details MSGPACK이면 Shared::Data::RedisValueCodec 바이너리로 기록한다.
+   * 패밀리별 현재 인코딩은 meta:value_encoding 해시에 주기적으로 알린다.
+   */
+  void SetValueEncoding(Shared::Data::RedisKeyFamily family,
+                        Shared::Data::ValueEncoding encoding);
 
   /**
    * @brief DeviceDataMessage를 Backend 호환 형식으로 저장
@@ -63,6 +87,15 @@ public:
    */
   size_t SaveDeviceMessage(const Structs::DeviceDataMessage &message);
 
+  /**
+   * @brief 배치 저장 - 잠금을 한 번만 잡고, 같은 배치 안에서 뒤의 값이
+   * 덮어쓸 키(같은 포인트/디바이스)는 마지막 값만 기록
+   * @param messages 처리 순서대로 정렬된 메시지들
+   * @return 성공한 포인트 수
+   */
+  size_t
+  SaveDeviceMessages(const std::vector<const Structs::DeviceDataMessage *> &messages);
+
   /**
    * @brief 개별 포인트를 Backend 호환 형식으로 저장
    * @param point 타임스탬프 값
@@ -139,6 +172,12 @@ public:
     std::atomic<uint64_t> point_latest_writes{0};
     std::atomic<uint64_t> alarm_publishes{0};
     std::atomic<uint64_t> worker_init_writes{0};
+    std::atomic<uint64_t> pipeline_flushes{0};   // 파이프라인 전송(왕복) 횟수
+    std::atomic<uint64_t> pipelined_commands{0}; // 파이프라인으로 보낸 명령 수
+    std::atomic<uint64_t> pipeline_errors{0};    // 실패/미응답 명령 수
+    std::atomic<uint64_t> device_hash_writes{0}; // device:{num}:values 필드 수
+    std::atomic<uint64_t> binary_payloads{0};    // MessagePack으로 쓴 값 수
+    std::atomic<uint64_t> async_rejected{0}; // 비동기 큐가 차서 버린 명령 수
 
     // 기본 생성자만 유지
     WriteStats() = default;
@@ -158,6 +197,12 @@ public:
       j["point_latest_writes"] = point_latest_writes.load();
       j["alarm_publishes"] = alarm_publishes.load();
       j["worker_init_writes"] = worker_init_writes.load();
+      j["pipeline_flushes"] = pipeline_flushes.load();
+      j["pipelined_commands"] = pipelined_commands.load();
+      j["pipeline_errors"] = pipeline_errors.load();
+      j["device_hash_writes"] = device_hash_writes.load();
+      j["binary_payloads"] = binary_payloads.load();
+      j["async_rejected"] = async_rejected.load();
       return j;
     }
   };
@@ -212,12 +257,12 @@ private:
   /**
    * @brief 포인트 ID에서 포인트 이름 가져오기
    */
-  std::string GetPointName(int point_id) const;
+  std::string GetPointName(int point_id, bool is_virtual) const;
 
   /**
    * @brief 포인트 ID에서 단위 문자열 가져오기
    */
-  std::string GetUnit(int point_id) const;
+  std::string GetUnit(int point_id, bool is_virtual) const;
 
   /**
    * @brief 포인트 ID에서 디바이스 ID 추론
@@ -230,14 +275,84 @@ private:
   void HandleError(const std::string &context,
                    const std::string &error_message);
 
+  // ==========================================================================
+  // 파이프라인 (redis_mutex_ 보유 상태에서 호출)
+  // ==========================================================================
+
+  /**
+   * @brief 명령을 버퍼에 추가 (pipeline_max_commands_에 닿으면 바로 전송)
+   */
+  void QueueCommandLocked(RedisClient::StringList command);
+  void QueueSetexLocked(const std::string &key, std::string value,
+                        int expire_seconds);
+
+  /**
+   * @brief 버퍼의 명령을 왕복 1회로 전송
+   * @return 성공 응답 수
+   */
+  size_t FlushPipelineLocked();
+
+  /**
+   * @brief 버퍼를 넘겨받고 redis_mutex_를 푼 뒤 전송
+   * @details 다른 스레드는 그동안 명령을 만들고 풀의 다른 연결로 보낼 수
+   * 있다. 같은 디바이스 키의 순서는 호출자가 잡은 디바이스 잠금이 보장한다.
+   */
+  size_t FlushPipelineUnlocked(std::unique_lock<std::mutex> &lock);
+  /**
+   * @brief 명령 묶음 전송
+   * @details 비동기 클라이언트가 켜져 있으면 그 큐에 넣고 바로 돌아온다
+   * (접수한 명령 수 반환, 실패는 완료 시 pipeline_errors에 반영). 큐가
+   * REDIS_ASYNC_SUBMIT_WAIT_MS 동안 차 있으면 묶음을 버린다. 동기 경로로
+   * 돌리면 먼저 큐에 들어간 이전 값이 나중에 덮어쓸 수 있기 때문이다.
+   */
+  size_t SendCommands(const std::shared_ptr<RedisClient> &client,
+                      std::vector<RedisClient::StringList> commands);
+
+  /**
+   * @brief 디바이스별 잠금 (명령 생성부터 전송까지 같은 디바이스는 직렬)
+   * @details 인덱스 순으로 잠가 교착을 피한다.
+   */
+  std::vector<std::unique_lock<std::mutex>>
+  LockDevices(const std::vector<const std::string *> &device_ids) const;
+
   // ==========================================================================
   // 내부 저장 메서드들
   // ==========================================================================
 
-  size_t SaveLightweightFormat(const Structs::DeviceDataMessage &message);
+  // point_mask: 포인트별 기록 여부 (nullptr이면 전체 기록)
+  using PointMask = std::vector<char>;
+  size_t SaveMessageLocked(const Structs::DeviceDataMessage &message,
+                           const PointMask *point_mask, bool save_full_data);
+  size_t SaveLightweightFormat(const Structs::DeviceDataMessage &message,
+                               const PointMask *point_mask = nullptr);
   size_t SaveFullDataFormat(const Structs::DeviceDataMessage &message);
-  size_t SaveDevicePatternFormat(const Structs::DeviceDataMessage &message);
-  size_t SavePointLatestFormat(const Structs::DeviceDataMessage &message);
+  size_t SaveDevicePatternFormat(const Structs::DeviceDataMessage &message,
+                                 const PointMask *point_mask = nullptr);
+  size_t SavePointLatestFormat(const Structs::DeviceDataMessage &message,
+                               const PointMask *point_mask = nullptr);
+  // HSET device:{num}:values (+ refresh_expire면 EXPIRE 1회)
+  size_t
+  SaveDeviceHashFormat(const std::string &device_num,
+                       const std::vector<Structs::TimestampedValue> &points,
+                       const PointMask *point_mask, bool refresh_expire,
+                       int expire_seconds = 3600);
+  bool WritesLegacyLayout() const {
+    return storage_layout_ != StorageLayout::DEVICE_HASH;
+  }
+  bool WritesHashLayout() const {
+    return storage_layout_ != StorageLayout::LEGACY;
+  }
+  bool UsesBinary(Shared::Data::RedisKeyFamily family) const {
+    return family_encoding_[static_cast<size_t>(family)] ==
+           Shared::Data::ValueEncoding::MSGPACK;
+  }
+  // 바이너리 포인트 값 (metadata: RedisValueCodec::META_*). META_ALL이면
+  // 레지스트리의 포인트 이름을 point_name에도 돌려준다 (키 생성용)
+  std::string EncodeBinaryPoint(const Structs::TimestampedValue &point,
+                                const std::string &device_num, int metadata,
+                                std::string *point_name = nullptr);
+  // meta:value_encoding 해시 갱신 (kPointIndexRefresh 주기)
+  void AdvertiseEncodingLocked();
 
   // ==========================================================================
   // 멤버 변수들
@@ -252,16 +367,34 @@ private:
   /// 스레드 안전성을 위한 뮤텍스
   mutable std::mutex redis_mutex_;
 
-  /// 포인트 정보 캐시 (성능 최적화)
-  mutable std::unordered_map<int, std::string> point_name_cache_;
-  mutable std::unordered_map<int, std::string> unit_cache_;
-  mutable std::mutex cache_mutex_;
+  /// 디바이스 잠금 (ExtractDeviceNumber 해시 → 줄무늬)
+  static constexpr size_t kDeviceLockStripes = 64;
+  mutable std::array<std::mutex, kDeviceLockStripes> device_locks_;
+
+  /// 전송 대기 명령 (redis_mutex_)
+  std::vector<RedisClient::StringList> pipeline_;
+  size_t pipeline_max_commands_ = 1000; // REDIS_PIPELINE_MAX_COMMANDS
 
   // 저장 모드 설정
   StorageMode storage_mode_ = StorageMode::HYBRID;
   bool store_device_pattern_ = true;
   bool store_point_latest_ = true;
   bool store_full_data_ = true;
+  StorageLayout storage_layout_ = StorageLayout::LEGACY;
+  std::array<Shared::Data::ValueEncoding,
+             static_cast<size_t>(Shared::Data::RedisKeyFamily::COUNT)>
+      family_encoding_{}; // 기본 JSON
+  std::chrono::steady_clock::time_point next_encoding_advertise_{};
+
+  /// point:device 인덱스에 기록한 포인트 (redis_mutex_). Redis 재시작 후
+  /// 인덱스가 비어도 복구되도록 주기적으로 비운다
+  std::unordered_set<int> indexed_points_;
+  std::chrono::steady_clock::time_point index_reset_at_{};
+
+  /// 비동기 전송 (REDIS_ASYNC_ENABLED). 완료 콜백이 stats_를 쓰므로 가장
+  /// 먼저 소멸(남은 명령 전송 후 종료)되도록 마지막에 둔다
+  std::chrono::milliseconds async_submit_wait_{1000};
+  std::unique_ptr<RedisAsyncClient> async_client_;
 };
 
 } // namespace Storage
@@ -0,0 +1,176 @@
+// =============================================================================
+// collector/include/Storage/RollupEngine.h - 스트리밍 롤업(다운샘플링) 엔진
+// 🔥 포인트별 1분/15분/1시간 min/max/mean/last/count를 메모리에서 누적하고
+//    정렬된 윈도우가 닫히면 Influx/SQLite로 내보냄. 티어별 보존 기간 관리
+// =============================================================================
+
+#ifndef PULSEONE_STORAGE_ROLLUP_ENGINE_H
+#define PULSEONE_STORAGE_ROLLUP_ENGINE_H
+
+#include "Pipeline/PointIndexRegistry.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace PulseOne {
+namespace Storage {
+
+/**
+ * @brief 롤업 티어 (윈도우 길이)
+ */
+enum class RollupTier : uint8_t { MIN_1 = 0, MIN_15, HOUR_1 };
+
+constexpr size_t ROLLUP_TIER_COUNT = 3;
+
+/**
+ * @brief 롤업 설정
+ * @details FromConfig()가 ROLLUP_* 키에서 읽는다. 보존 기간이 0이면 해당
+ * 티어는 삭제하지 않는다.
+ */
+struct RollupOptions {
+  bool enabled = false;
+  bool to_influx = true;  // device_telemetry_1m / _15m / _1h measurement
+  bool to_sqlite = false; // point_rollups 테이블
+  int flush_interval_ms = 5000; // 닫힌 윈도우 수집 주기
+  int grace_ms = 2000;          // 윈도우 종료 후 늦게 도착한 샘플 대기
+  int raw_retention_hours = 24 * 7;
+  std::array<int, ROLLUP_TIER_COUNT> retention_hours = {24 * 30, 24 * 180,
+                                                        24 * 730};
+  int retention_sweep_minutes = 60;
+
+  static RollupOptions FromConfig();
+};
+
+/**
+ * @brief 닫힌 롤업 윈도우 한 개
+ */
+struct RollupRow {
+  int point_id = 0;
+  RollupTier tier = RollupTier::MIN_1;
+  int64_t window_start_ms = 0; // UTC epoch ms, 티어 길이에 정렬됨
+  double min = 0.0;
+  double max = 0.0;
+  double mean = 0.0;
+  double last = 0.0;
+  double sum = 0.0; // 열린 윈도우 체크포인트/복원용
+  uint32_t count = 0;
+};
+
+/**
+ * @brief 롤업 통계 스냅샷
+ */
+struct RollupStats {
+  bool enabled = false;
+  uint64_t samples = 0;      // 누적된 샘플 수
+  uint64_t late_samples = 0; // 이미 지난 윈도우에 도착해 버린 샘플 수
+  uint64_t overwritten = 0;  // 수집 전에 다음 윈도우가 또 닫혀 잃은 윈도우 수
+  uint64_t rows_emitted = 0; // 내보낸 윈도우 수
+};
+
+/**
+ * @brief 스트리밍 롤업 엔진
+ * @details
+ * - 포인트별 상태는 PointIndexRegistry 밀집 인덱스로 PointStateArray에 두므로
+ *   Add()는 힙 할당이 없다 (청크 최초 할당 제외). 같은 포인트를 여러 처리
+ *   스레드가 동시에 갱신할 수 있어 슬롯마다 짧은 스핀락을 쓴다.
+ * - 샘플이 현재 윈도우보다 뒤 윈도우에 속하면 현재 윈도우를 "닫힘" 칸으로
+ *   옮긴다. 닫힘 칸은 하나뿐이므로 Collect 주기는 가장 짧은 티어(1분)보다
+ *   짧아야 한다 (그렇지 않으면 overwritten 증가).
+ * - Collect()는 Persistence 스레드에서 호출한다. 닫힘 칸과, 샘플이 더 오지
+ *   않아 종료 시각 + grace가 지난 윈도우를 내보낸다.
+ * - 윈도우는 끝난 뒤 한 번만 내보낸다. 종료 시 아직 열린 윈도우는
+ *   TakeOpen()으로 꺼내 체크포인트하고, 재시작 후 Restore()로 되살려 이어서
+ *   누적하므로 재시작을 걸친 윈도우도 전체 값으로 한 번 기록된다.
+ */
+class RollupEngine {
+public:
+  RollupEngine() = default;
+
+  RollupEngine(const RollupEngine &) = delete;
+  RollupEngine &operator=(const RollupEngine &) = delete;
+
+  void Configure(const RollupOptions &options) { options_ = options; }
+  const RollupOptions &GetOptions() const { return options_; }
+  bool IsEnabled() const { return options_.enabled; }
+
+  /**
+   * @brief 샘플 누적 (처리 스레드, 할당 없음)
+   */
+  void Add(int point_id, std::chrono::system_clock::time_point time,
+           double value);
+
+  /**
+   * @brief 닫힌 윈도우 수집 (Persistence 스레드)
+   * @return out에 추가된 행 수
+   */
+  size_t Collect(std::chrono::system_clock::time_point now,
+                 std::vector<RollupRow> &out);
+
+  /**
+   * @brief 진행 중인 윈도우를 내보내지 않고 꺼냄 (종료 시 체크포인트용)
+   * @details Collect() 뒤에 호출한다. 꺼낸 윈도우는 엔진에서 비워진다.
+   * @return out에 추가된 행 수
+   */
+  size_t TakeOpen(std::vector<RollupRow> &out);
+
+  /**
+   * @brief 체크포인트한 윈도우를 열린 윈도우로 되살림 (처리 스레드 시작 전)
+   * @details 같은 윈도우가 이미 열려 있으면 합친다. row.sum/count를 쓴다.
+   */
+  void Restore(const RollupRow &row);
+
+  static int64_t TierWidthMs(RollupTier tier);
+  static const char *TierSuffix(RollupTier tier); // "1m", "15m", "1h"
+  static bool ParseTierSuffix(const std::string &suffix, RollupTier &tier);
+
+  RollupStats GetStats() const;
+
+private:
+  struct Window {
+    int64_t start_ms = -1; // -1 = 비어 있음
+    double min = 0.0;
+    double max = 0.0;
+    double sum = 0.0;
+    double last = 0.0;
+    uint32_t count = 0;
+  };
+
+  struct Slot {
+    std::atomic<bool> busy{false};
+    std::array<Window, ROLLUP_TIER_COUNT> open;
+    std::array<Window, ROLLUP_TIER_COUNT> closed;
+    // 마지막으로 내보낸 윈도우 시작 시각. 그 이전 샘플은 늦은 샘플로 버림
+    std::array<int64_t, ROLLUP_TIER_COUNT> emitted_start{{-1, -1, -1}};
+  };
+
+  class SlotLock {
+  public:
+    explicit SlotLock(Slot &slot) : slot_(slot) {
+      while (slot_.busy.exchange(true, std::memory_order_acquire)) {
+      }
+    }
+    ~SlotLock() { slot_.busy.store(false, std::memory_order_release); }
+
+  private:
+    Slot &slot_;
+  };
+
+  static void Emit(int point_id, size_t tier, Window &window,
+                   std::vector<RollupRow> &out);
+
+  RollupOptions options_;
+  Pipeline::PointStateArray<Slot> slots_;
+
+  std::atomic<uint64_t> samples_{0};
+  std::atomic<uint64_t> late_samples_{0};
+  std::atomic<uint64_t> overwritten_{0};
+  std::atomic<uint64_t> rows_emitted_{0};
+};
+
+} // namespace Storage
+} // namespace PulseOne
+
+#endif // PULSEONE_STORAGE_ROLLUP_ENGINE_H
@@ -11,6 +11,7 @@
 #include "Common/Structs.h"
 #include "Logging/LogManager.h"
 #include "Pipeline/PipelineManager.h"
+#include "Pipeline/PipelineMetrics.h"
 #include "Platform/PlatformCompat.h"
 #include <atomic>
 #include <chrono>
@@ -254,6 +255,28 @@ public:
       const std::vector<PulseOne::Structs::TimestampedValue> &values,
       uint32_t priority = 0);
 
+  /**
+   * @brief 파이프라인 혼잡도를 반영한 폴링 주기
+   * @details 큐가 차오르면 주기를 2/4/8배로 늘려 데이터를 버리는 대신
+   * 샘플링 주기를 낮춘다. 폴링 루프의 sleep 계산 직전에 호출.
+   * @param base 설정된 폴링 주기
+   */
+  std::chrono::milliseconds
+  GetBackpressureAdjustedInterval(std::chrono::milliseconds base);
+
+  /**
+   * @brief 파이프라인에 여유가 생길 때까지 대기 (구독형 Worker용)
+   * @return max_wait 이내에 여유가 생겼으면 true
+   */
+  bool WaitForPipelineCapacity(std::chrono::milliseconds max_wait);
+
+  /**
+   * @brief 혼잡으로 폴링 주기를 늘린 횟수
+   */
+  uint64_t GetBackpressureStretchCount() const {
+    return backpressure_stretch_count_.load();
+  }
+
   /**
    * @brief 새로운 데이터포인트를 DB에 자동으로 생성/등록
    * @param name 데이터포인트 이름
@@ -353,6 +376,12 @@ protected:
       const std::vector<PulseOne::Structs::TimestampedValue> &values,
       const std::string &data_type, uint32_t priority = 0);
 
+  /**
+   * @brief 드라이버 읽기 시간 기록 (프로토콜별 driver_read 히스토그램)
+   * @param started ReadValues 호출 직전 시각
+   */
+  void RecordDriverReadLatency(std::chrono::steady_clock::time_point started);
+
   // =============================================================================
   // 파생 클래스에서 접근 가능한 데이터 (protected)
   // =============================================================================
@@ -386,6 +415,7 @@ protected:
   // =============================================================================
   PulseOne::Structs::DeviceInfo device_info_; ///< 디바이스 정보
   std::string worker_id_;
+  std::atomic<Pipeline::LatencyHistogram *> driver_read_histogram_{nullptr};
 
   // =============================================================================
   // 통신 결과 업데이트 메서드들
@@ -429,6 +459,10 @@ private:
   // 시퀀스 카운터 (private)
   std::atomic<uint32_t> sequence_counter_{0};
 
+  // 파이프라인 역압 상태 (마지막으로 적용한 주기 배수)
+  std::atomic<uint32_t> backpressure_multiplier_{1};
+  std::atomic<uint64_t> backpressure_stretch_count_{0};
+
   // =============================================================================
   // 재연결 관리
   // =============================================================================
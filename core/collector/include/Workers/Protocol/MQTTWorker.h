@@ -17,6 +17,7 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <future>
 #include <map>
 #include <memory>
@@ -743,6 +744,19 @@ private:
   mutable std::mutex publish_queue_mutex_;
   std::condition_variable publish_queue_cv_;
 
+  // 수신 버퍼: 드라이버 콜백은 넣기만 하고 메시지 처리 스레드가 꺼내
+  // 처리한다. 파이프라인 혼잡 대기는 처리 스레드에서 하므로 클라이언트
+  // 콜백 스레드(keepalive/ack)를 막지 않고, 버퍼가 차면 새 메시지를 버린다.
+  struct InboundMessage {
+    std::string topic;
+    std::string payload;
+  };
+  static constexpr size_t INBOUND_QUEUE_MAX = 10000;
+  std::deque<InboundMessage> inbound_queue_;
+  std::mutex inbound_mutex_;
+  std::condition_variable inbound_cv_;
+  std::atomic<uint64_t> inbound_dropped_{0};
+
   // 스레드 관리
   std::atomic<bool> message_thread_running_;
   std::atomic<bool> publish_thread_running_;
@@ -862,6 +876,9 @@ private:
   static void MessageCallback(MQTTWorker *worker, const std::string &topic,
                               const std::string &payload);
   void SetupMQTTDriverCallbacks();
+  void EnqueueInbound(const std::string &topic, const std::string &payload);
+  // 수신 버퍼를 최대 max_wait 기다렸다가 비움 (혼잡 시 파이프라인 여유 대기)
+  void DrainInbound(std::chrono::milliseconds max_wait);
 
   // 제어 인터페이스 내부 구현
   bool WriteDataPointValue(const std::string &point_id,
@@ -12,6 +12,7 @@
 #include "Database/Repositories/DeviceRepository.h"
 #include "Database/RepositoryFactory.h"
 #include "Logging/LogManager.h"
+#include "Pipeline/PointMetadataRegistry.h"
 #include "Utils/ConfigManager.h"
 
 #include <algorithm>
@@ -175,6 +176,74 @@ AlarmEngine::evaluateForPoint(int tenant_id, const TimestampedValue &tv) {
 
   // Get rules for this point
   auto rules = registry_->getRulesForPoint(tenant_id, tv.point_id);
+  return evaluateRulesForPoint(tenant_id, tv, rules);
+}
+
+std::vector<std::vector<AlarmEvent>> AlarmEngine::evaluateForMessages(
+    const std::vector<const DeviceDataMessage *> &messages) {
+  std::vector<std::vector<AlarmEvent>> results(messages.size());
+  if (!initialized_.load() || messages.empty())
+    return results;
+
+  // 테넌트별로 포인트를 모아 상태 갱신/규칙 조회를 한 번의 잠금으로 처리
+  struct PointRef {
+    size_t message_index;
+    const TimestampedValue *tv;
+  };
+  std::unordered_map<int, std::vector<PointRef>> by_tenant;
+  std::vector<const TimestampedValue *> all_points;
+  size_t total_points = 0;
+
+  for (size_t i = 0; i < messages.size(); ++i) {
+    const auto *message = messages[i];
+    if (!message || message->points.empty())
+      continue;
+    auto &refs = by_tenant[message->tenant_id];
+    for (const auto &point : message->points) {
+      refs.push_back({i, &point});
+      all_points.push_back(&point);
+    }
+    total_points += message->points.size();
+  }
+
+  cache_->updatePointStates(all_points);
+
+  for (auto &[tenant_id, refs] : by_tenant) {
+    if (!registry_->isTenantLoaded(tenant_id)) {
+      LogManager::getInstance().Info("AlarmEngine: Loading rules for tenant " +
+                                         std::to_string(tenant_id),
+                                     "AlarmEngine");
+      registry_->loadRules(tenant_id);
+    }
+
+    std::vector<int> point_ids;
+    point_ids.reserve(refs.size());
+    for (const auto &ref : refs) {
+      point_ids.push_back(ref.tv->point_id);
+    }
+    auto rules = registry_->getRulesForPoints(tenant_id, point_ids);
+
+    // 메시지/포인트 순서대로 평가 (같은 포인트의 상태 전이 순서 유지)
+    for (size_t k = 0; k < refs.size(); ++k) {
+      if (rules[k].empty())
+        continue;
+      auto events = evaluateRulesForPoint(tenant_id, *refs[k].tv, rules[k]);
+      if (!events.empty()) {
+        auto &out = results[refs[k].message_index];
+        out.insert(out.end(), std::make_move_iterator(events.begin()),
+                   std::make_move_iterator(events.end()));
+      }
+    }
+  }
+
+  total_evaluations_.fetch_add(total_points);
+  return results;
+}
+
+std::vector<AlarmEvent> AlarmEngine::evaluateRulesForPoint(
+    int tenant_id, const TimestampedValue &tv,
+    const std::vector<AlarmRuleEntity> &rules) {
+  std::vector<AlarmEvent> events;
 
   std::string val_str;
   std::visit(
@@ -225,7 +294,7 @@ AlarmEngine::evaluateForPoint(int tenant_id, const TimestampedValue &tv) {
           ev.point_id = tv.point_id;
           ev.site_id = 0;
 
-          ev.source_name = getPointName(tv.point_id);
+          ev.source_name = getPointName(tv.point_id, tv.is_virtual_point);
           ev.rule_id = rule.getId();
           ev.occurrence_id = *occ_id;
           ev.current_value = tv.value;
@@ -254,7 +323,7 @@ AlarmEngine::evaluateForPoint(int tenant_id, const TimestampedValue &tv) {
           ev.point_id = tv.point_id;
           ev.site_id = 0;
 
-          ev.source_name = getPointName(tv.point_id);
+          ev.source_name = getPointName(tv.point_id, tv.is_virtual_point);
           ev.rule_id = rule.getId();
           ev.current_value = tv.value;
           ev.alarm_type = convertToAlarmType(rule.getAlarmType());
@@ -481,10 +550,21 @@ int AlarmEngine::getDeviceIdForPoint(int point_id) {
   return 0;
 }
 
-std::string AlarmEngine::getPointName(int point_id) {
+std::string AlarmEngine::getPointName(int point_id, bool is_virtual) {
   if (point_id <= 0)
     return "";
 
+  // 메타데이터 레지스트리 스냅샷 우선 (락/DB 없음)
+  if (auto meta = Pipeline::PointMetadataRegistry::getInstance().Find(
+          point_id, is_virtual)) {
+    if (!meta->name.empty())
+      return meta->name;
+  }
+
+  // 아래 캐시/저장소는 데이터포인트 ID 기준 (가상포인트 ID와 겹칠 수 있음)
+  if (is_virtual)
+    return "Point_" + std::to_string(point_id);
+
   {
     std::shared_lock<std::shared_mutex> lock(device_cache_mutex_);
     auto it = point_name_cache_.find(point_id);
@@ -310,6 +310,49 @@ AlarmManager::evaluateForMessage(const DeviceDataMessage &msg) {
   return events;
 }
 
+std::vector<std::vector<AlarmEvent>>
+AlarmManager::evaluateForMessages(
+    const std::vector<const DeviceDataMessage *> &messages) {
+  std::vector<std::vector<AlarmEvent>> results(messages.size());
+
+  if (!initialized_.load()) {
+    auto &logger = LogManager::getInstance();
+    logger.log("alarm", LogLevel::LOG_ERROR, "❌ AlarmManager 초기화되지 않음");
+    return results;
+  }
+
+  try {
+    results = AlarmEngine::getInstance().evaluateForMessages(messages);
+
+    size_t raised = 0;
+    for (size_t i = 0; i < results.size(); ++i) {
+      for (auto &event : results[i]) {
+        enhanceAlarmEventWithBusinessLogic(event, *messages[i]);
+        adjustSeverityByBusinessRules(event);
+        addLocationAndContext(event, *messages[i]);
+        generateLocalizedMessage(event);
+      }
+      raised += results[i].size();
+    }
+
+    total_evaluations_.fetch_add(messages.size());
+    if (raised > 0) {
+      alarms_raised_.fetch_add(raised);
+      LogManager::getInstance().log(
+          "alarm", LogLevel::INFO,
+          "🎯 배치 알람 평가 완료: " + std::to_string(messages.size()) +
+              "개 메시지, " + std::to_string(raised) + "개 이벤트 생성");
+    }
+
+  } catch (const std::exception &e) {
+    auto &logger = LogManager::getInstance();
+    logger.log("alarm", LogLevel::LOG_ERROR,
+               "❌ 배치 메시지 평가 실패: " + std::string(e.what()));
+  }
+
+  return results;
+}
+
 // =============================================================================
 // 🎯 비즈니스 로직 메서드들 - 핵심 구현
 // =============================================================================
@@ -73,6 +73,32 @@ AlarmRuleRegistry::getRulesForPoint(int tenant_id, int point_id) const {
   return result;
 }
 
+std::vector<std::vector<Database::Entities::AlarmRuleEntity>>
+AlarmRuleRegistry::getRulesForPoints(int tenant_id,
+                                     const std::vector<int> &point_ids) const {
+  std::vector<std::vector<Database::Entities::AlarmRuleEntity>> result(
+      point_ids.size());
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  auto it_tenant = tenant_rules_.find(tenant_id);
+  auto it_point_rules = tenant_point_rules_.find(tenant_id);
+  if (it_tenant == tenant_rules_.end() ||
+      it_point_rules == tenant_point_rules_.end())
+    return result;
+
+  for (size_t i = 0; i < point_ids.size(); ++i) {
+    auto it_point = it_point_rules->second.find(point_ids[i]);
+    if (it_point == it_point_rules->second.end())
+      continue;
+    for (int idx : it_point->second) {
+      if (idx >= 0 && static_cast<size_t>(idx) < it_tenant->second.size()) {
+        result[i].push_back(it_tenant->second[idx]);
+      }
+    }
+  }
+  return result;
+}
+
 std::vector<Database::Entities::AlarmRuleEntity>
 AlarmRuleRegistry::getAllRules(int tenant_id) const {
   std::shared_lock<std::shared_mutex> lock(mutex_);
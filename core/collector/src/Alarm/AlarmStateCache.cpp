@@ -4,9 +4,10 @@
 namespace PulseOne {
 namespace Alarm {
 
-void AlarmStateCache::updatePointState(int point_id, const PulseOne::Structs::DataValue& value) {
-    std::unique_lock<std::shared_mutex> lock(state_mutex_);
-    auto& state = point_states_[point_id];
+namespace {
+
+void applyPointState(AlarmStateCache::PointState& state, const PulseOne::Structs::DataValue& value,
+                     std::chrono::system_clock::time_point now) {
     state.last_value = value;
     
     // std::visit을 사용하여 값 추출
@@ -21,14 +22,36 @@ void AlarmStateCache::updatePointState(int point_id, const PulseOne::Structs::Da
         }
     }, value);
     
-    state.last_check_time = std::chrono::system_clock::now();
+    state.last_check_time = now;
+}
+
+} // namespace
+
+void AlarmStateCache::updatePointState(int point_id, const PulseOne::Structs::DataValue& value) {
+    uint32_t index = Pipeline::PointIndexRegistry::getInstance().Acquire(point_id);
+    if (index == Pipeline::PointIndexRegistry::INVALID_INDEX) return;
+    std::unique_lock<std::shared_mutex> lock(pointLock(index));
+    applyPointState(point_states_.At(index), value, std::chrono::system_clock::now());
+}
+
+void AlarmStateCache::updatePointStates(const std::vector<const PulseOne::Structs::TimestampedValue*>& values) {
+    if (values.empty()) return;
+    auto& registry = Pipeline::PointIndexRegistry::getInstance();
+    auto now = std::chrono::system_clock::now();
+    for (const auto* tv : values) {
+        uint32_t index = registry.Acquire(tv->point_id);
+        if (index == Pipeline::PointIndexRegistry::INVALID_INDEX) continue;
+        std::unique_lock<std::shared_mutex> lock(pointLock(index));
+        applyPointState(point_states_.At(index), tv->value, now);
+    }
 }
 
 AlarmStateCache::PointState AlarmStateCache::getPointState(int point_id) const {
-    std::shared_lock<std::shared_mutex> lock(state_mutex_);
-    auto it = point_states_.find(point_id);
-    if (it != point_states_.end()) return it->second;
-    return PointState();
+    uint32_t index = Pipeline::PointIndexRegistry::getInstance().IndexOf(point_id);
+    if (index == Pipeline::PointIndexRegistry::INVALID_INDEX) return PointState();
+    std::shared_lock<std::shared_mutex> lock(pointLock(index));
+    const PointState* state = point_states_.Find(index);
+    return state ? *state : PointState();
 }
 
 void AlarmStateCache::setAlarmStatus(int rule_id, bool active, int64_t occurrence_id) {
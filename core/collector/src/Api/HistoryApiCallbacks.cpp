@@ -0,0 +1,79 @@
+// =============================================================================
+// collector/src/Api/HistoryApiCallbacks.cpp
+// 내장 엣지 시계열 저장소 이력 조회 REST API 콜백 구현
+// =============================================================================
+
+#include "Api/HistoryApiCallbacks.h"
+#include "Network/RestApiServer.h"
+#include "Storage/EdgeTimeSeriesStore.h"
+#include <algorithm>
+
+namespace PulseOne {
+namespace Api {
+
+namespace {
+// 집계 버킷 수 상한 (너무 작은 step으로 응답이 커지는 것 방지)
+constexpr int64_t MAX_BUCKETS = 10000;
+constexpr size_t MAX_RAW_SAMPLES = 100000;
+}
+
+void HistoryApiCallbacks::Setup(Network::RestApiServer* server) {
+    if (!server) return;
+
+    server->SetHistoryQueryCallback(
+        [](int point_id, int64_t from_ms, int64_t to_ms, int64_t step_ms,
+           size_t limit) -> nlohmann::json {
+            return QueryPointHistory(point_id, from_ms, to_ms, step_ms, limit);
+        });
+}
+
+nlohmann::json HistoryApiCallbacks::QueryPointHistory(int point_id,
+                                                      int64_t from_ms,
+                                                      int64_t to_ms,
+                                                      int64_t step_ms,
+                                                      size_t limit) {
+    auto& store = Storage::EdgeTimeSeriesStore::getInstance();
+    nlohmann::json result;
+    if (!store.IsEnabled()) {
+        result["error"] = "Edge time-series store is disabled";
+        return result;
+    }
+
+    result["point_id"] = point_id;
+    result["from"] = from_ms;
+    result["to"] = to_ms;
+
+    if (step_ms > 0) {
+        // 범위/step이 상한을 넘으면 step을 키움
+        const int64_t span = to_ms - from_ms + 1;
+        const int64_t min_step = (span + MAX_BUCKETS - 1) / MAX_BUCKETS;
+        step_ms = std::max(step_ms, min_step);
+        result["step"] = step_ms;
+
+        nlohmann::json buckets = nlohmann::json::array();
+        for (const auto& bucket :
+             store.Aggregate(point_id, from_ms, to_ms, step_ms)) {
+            buckets.push_back({{"t", bucket.start_ms},
+                               {"min", bucket.min},
+                               {"max", bucket.max},
+                               {"mean", bucket.mean},
+                               {"last", bucket.last},
+                               {"count", bucket.count}});
+        }
+        result["buckets"] = std::move(buckets);
+    } else {
+        limit = std::min(limit, MAX_RAW_SAMPLES);
+        auto samples = store.Query(point_id, from_ms, to_ms, limit);
+
+        nlohmann::json rows = nlohmann::json::array();
+        for (const auto& sample : samples) {
+            rows.push_back({{"t", sample.timestamp_ms}, {"v", sample.value}});
+        }
+        result["truncated"] = samples.size() >= limit;
+        result["samples"] = std::move(rows);
+    }
+    return result;
+}
+
+} // namespace Api
+} // namespace PulseOne
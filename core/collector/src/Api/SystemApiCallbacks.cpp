@@ -0,0 +1,102 @@
+// =============================================================================
+// collector/src/Api/SystemApiCallbacks.cpp
+// 시스템 통계 / Prometheus 메트릭 REST API 콜백 구현
+// =============================================================================
+
+#include "Api/SystemApiCallbacks.h"
+#include "Network/RestApiServer.h"
+#include "Pipeline/PipelineManager.h"
+#include "Pipeline/PipelineMetrics.h"
+#include "Storage/EdgeTimeSeriesStore.h"
+
+namespace PulseOne {
+namespace Api {
+
+void SystemApiCallbacks::Setup(Network::RestApiServer* server) {
+    if (!server) return;
+
+    server->SetSystemStatsCallback([]() -> nlohmann::json {
+        return GetSystemStats();
+    });
+
+    server->SetMetricsCallback([]() -> std::string {
+        return Pipeline::PipelineMetrics::getInstance().ToPrometheus();
+    });
+}
+
+nlohmann::json SystemApiCallbacks::GetSystemStats() {
+    using Pipeline::PipelineManager;
+
+    auto stats = PipelineManager::getInstance().GetStatistics();
+
+    nlohmann::json queue;
+    queue["total_received"] = stats.total_received;
+    queue["total_delivered"] = stats.total_delivered;
+    queue["total_dropped"] = stats.total_dropped;
+    queue["current_size"] = stats.current_queue_size;
+    queue["max_size"] = stats.max_queue_size;
+    queue["fill_percentage"] = stats.fill_percentage;
+    queue["congestion"] = PipelineManager::CongestionLevelName(stats.congestion_level);
+    queue["spill_pending"] = stats.spill.pending;
+
+    nlohmann::json lanes = nlohmann::json::object();
+    for (size_t i = 0; i < stats.lanes.size(); ++i) {
+        const auto& lane = stats.lanes[i];
+        nlohmann::json item;
+        item["depth"] = lane.depth;
+        item["pushed"] = lane.pushed;
+        item["popped"] = lane.popped;
+        item["dropped"] = lane.dropped;
+        item["avg_wait_ms"] = lane.avg_wait_ms;
+        item["max_wait_ms"] = lane.max_wait_ms;
+        lanes[PipelineManager::LaneName(static_cast<PipelineManager::Lane>(i))] = item;
+    }
+    queue["lanes"] = lanes;
+
+    if (stats.wal.enabled) {
+        nlohmann::json wal;
+        wal["appended"] = stats.wal.appended;
+        wal["group_commits"] = stats.wal.group_commits;
+        wal["fsyncs"] = stats.wal.fsyncs;
+        wal["in_flight"] = stats.wal.in_flight;
+        wal["checkpoint_lsn"] = stats.wal.checkpoint_lsn;
+        wal["next_lsn"] = stats.wal.next_lsn;
+        wal["unpersisted"] = stats.wal.unpersisted;
+        wal["retried"] = stats.wal.retried;
+        wal["retry_pending"] = stats.wal.retry_pending;
+        wal["retry_dropped"] = stats.wal.retry_dropped;
+        wal["truncated"] = stats.wal.truncated;
+        wal["recovered"] = stats.wal.recovered;
+        wal["replayed"] = stats.wal.replayed;
+        wal["corrupt"] = stats.wal.corrupt;
+        wal["write_errors"] = stats.wal.write_errors;
+        wal["segments"] = stats.wal.segments;
+        wal["bytes_on_disk"] = stats.wal.bytes_on_disk;
+        queue["wal"] = wal;
+    }
+
+    nlohmann::json result;
+    result["pipeline"] = queue;
+    result["latency"] = Pipeline::PipelineMetrics::getInstance().ToJson();
+
+    auto tsdb = Storage::EdgeTimeSeriesStore::getInstance().GetStats();
+    if (tsdb.enabled) {
+        nlohmann::json edge;
+        edge["samples"] = tsdb.samples;
+        edge["out_of_order"] = tsdb.out_of_order;
+        edge["late_samples"] = tsdb.late_samples;
+        edge["future_samples"] = tsdb.future_samples;
+        edge["chunks_sealed"] = tsdb.chunks_sealed;
+        edge["pressure_seals"] = tsdb.pressure_seals;
+        edge["partitions"] = tsdb.partitions;
+        edge["partitions_dropped"] = tsdb.partitions_dropped;
+        edge["corrupt_chunks"] = tsdb.corrupt_chunks;
+        edge["open_bytes"] = tsdb.open_bytes;
+        edge["disk_bytes"] = tsdb.disk_bytes;
+        result["edge_tsdb"] = edge;
+    }
+    return result;
+}
+
+} // namespace Api
+} // namespace PulseOne
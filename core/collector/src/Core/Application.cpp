@@ -29,7 +29,9 @@ using namespace PulseOne::Database::SQL;
 #include "Api/ConfigApiCallbacks.h"
 #include "Api/DeviceApiCallbacks.h"
 #include "Api/HardwareApiCallbacks.h"
+#include "Api/HistoryApiCallbacks.h"
 #include "Api/LogApiCallbacks.h"
+#include "Api/SystemApiCallbacks.h"
 #endif
 
 #include <chrono>
@@ -403,6 +405,11 @@ bool CollectorApplication::Initialize() {
         data_processing_service_->SetRdbSyncInterval(60);
       }
 
+      // 디바이스 친화 처리 모드 (기본 OFF)
+      data_processing_service_->SetDeviceAffinityEnabled(
+          ConfigManager::getInstance().getBool("PIPELINE_DEVICE_AFFINITY",
+                                               false));
+
       if (!data_processing_service_->Start()) {
         LogManager::getInstance().Error(
             "✗ DataProcessingService failed to start");
@@ -796,6 +803,12 @@ bool CollectorApplication::InitializeRestApiServer() {
 
     PulseOne::Api::LogApiCallbacks::Setup(api_server_.get());
     LogManager::getInstance().Info("✓ LogApiCallbacks registered");
+
+    PulseOne::Api::SystemApiCallbacks::Setup(api_server_.get());
+    LogManager::getInstance().Info("✓ SystemApiCallbacks registered");
+
+    PulseOne::Api::HistoryApiCallbacks::Setup(api_server_.get());
+    LogManager::getInstance().Info("✓ HistoryApiCallbacks registered");
     // API 서버 시작
     if (api_server_->Start()) {
       LogManager::getInstance().Info("✓ REST API Server started on port " +
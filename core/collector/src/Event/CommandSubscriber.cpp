@@ -8,6 +8,7 @@
 #include "Event/CommandSubscriber.h"
 #include "Client/RedisClientImpl.h"
 #include "Logging/LogManager.h"
+#include "Pipeline/PointMetadataRegistry.h"
 #include "Utils/ConfigManager.h"
 #include "Workers/WorkerManager.h"
 #include <chrono>
@@ -66,6 +67,7 @@ void CommandSubscriber::handleConfigReload(const std::string &message) {
 
   try {
     ConfigManager::getInstance().reload();
+    Pipeline::PointMetadataRegistry::getInstance().LoadAll();
     LogManager::getInstance().Info("✅ Configuration reloaded successfully");
   } catch (const std::exception &e) {
     LogManager::getInstance().Error("Failed to reload configuration: " +
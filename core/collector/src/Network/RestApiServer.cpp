@@ -134,6 +134,7 @@ void RestApiServer::SetupRoutes() {
                 <li><a href="/api/docs">API Documentation</a></li>
                 <li><a href="/api/health">Health Check</a></li>
                 <li><a href="/api/system/stats">System Statistics</a></li>
+                <li><a href="/metrics">Prometheus Metrics</a></li>
                 <li><a href="/api/groups">Device Groups</a></li>
             </ul>
         )",
@@ -394,6 +395,19 @@ void RestApiServer::SetupRoutes() {
     HandleGetSystemStats(req, res);
   });
 
+  // Prometheus 스크레이프 엔드포인트
+  httplib_server->Get("/metrics", [this](const httplib::Request &req,
+                                         httplib::Response &res) {
+    HandleGetMetrics(req, res);
+  });
+
+  // 내장 엣지 시계열 저장소 이력 조회
+  httplib_server->Get(
+      R"(/api/history/points/(\d+))",
+      [this](const httplib::Request &req, httplib::Response &res) {
+        HandleGetPointHistory(req, res);
+      });
+
   // 에러 통계 API
   httplib_server->Get(
       "/api/errors/statistics",
@@ -1393,6 +1407,96 @@ void RestApiServer::HandleGetSystemStats(const httplib::Request &req,
   }
 }
 
+void RestApiServer::HandleGetMetrics(const httplib::Request &req,
+                                     httplib::Response &res) {
+  try {
+    if (metrics_callback_) {
+      res.set_content(metrics_callback_(), "text/plain; version=0.0.4");
+    } else {
+      res.status = 503;
+      res.set_content("# metrics callback not set\n", "text/plain");
+    }
+  } catch (const std::exception &e) {
+    res.status = 500;
+    res.set_content(std::string("# metrics error: ") + e.what() + "\n",
+                    "text/plain");
+  }
+}
+
+void RestApiServer::HandleGetPointHistory(const httplib::Request &req,
+                                          httplib::Response &res) {
+  try {
+    SetCorsHeaders(res);
+
+    if (!history_query_callback_) {
+      res.status = 503;
+      res.set_content(CreateErrorResponse("History query callback not set",
+                                          "SERVICE_UNAVAILABLE", "")
+                          .dump(),
+                      "application/json");
+      return;
+    }
+
+    const int point_id = std::stoi(req.matches[1]);
+
+    // 기본 범위: 최근 1시간
+    const int64_t now_ms =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    int64_t to_ms = now_ms;
+    int64_t from_ms = now_ms - 3600LL * 1000;
+    int64_t step_ms = 0;
+    size_t limit = 10000;
+
+    auto it = req.params.find("from");
+    if (it != req.params.end())
+      from_ms = std::stoll(it->second);
+    it = req.params.find("to");
+    if (it != req.params.end())
+      to_ms = std::stoll(it->second);
+    it = req.params.find("step");
+    if (it != req.params.end())
+      step_ms = std::stoll(it->second);
+    it = req.params.find("limit");
+    if (it != req.params.end())
+      limit = static_cast<size_t>(std::stoull(it->second));
+
+    if (from_ms > to_ms || step_ms < 0) {
+      res.status = 400;
+      res.set_content(CreateErrorResponse("Invalid time range or step",
+                                          "INVALID_PARAMETER", "")
+                          .dump(),
+                      "application/json");
+      return;
+    }
+
+    json data =
+        history_query_callback_(point_id, from_ms, to_ms, step_ms, limit);
+    if (data.contains("error")) {
+      res.status = 503;
+      res.set_content(
+          CreateErrorResponse(data["error"].get<std::string>(),
+                              "SERVICE_UNAVAILABLE", "")
+              .dump(),
+          "application/json");
+      return;
+    }
+    res.set_content(CreateSuccessResponse(data).dump(), "application/json");
+  } catch (const std::invalid_argument &) {
+    res.status = 400;
+    res.set_content(
+        CreateErrorResponse("Invalid query parameter", "INVALID_PARAMETER", "")
+            .dump(),
+        "application/json");
+  } catch (const std::exception &e) {
+    res.status = 500;
+    res.set_content(
+        CreateErrorResponse(e.what(), "INTERNAL_ERROR", "").dump(),
+        "application/json");
+  }
+}
+
 void RestApiServer::HandleGetSystemLogs(const httplib::Request &req,
                                         httplib::Response &res) {
   try {
@@ -1722,6 +1826,14 @@ void RestApiServer::SetSystemStatsCallback(SystemStatsCallback callback) {
   system_stats_callback_ = callback;
 }
 
+void RestApiServer::SetMetricsCallback(MetricsCallback callback) {
+  metrics_callback_ = callback;
+}
+
+void RestApiServer::SetHistoryQueryCallback(HistoryQueryCallback callback) {
+  history_query_callback_ = callback;
+}
+
 void RestApiServer::SetDiagnosticsCallback(DiagnosticsCallback callback) {
   diagnostics_callback_ = callback;
 }
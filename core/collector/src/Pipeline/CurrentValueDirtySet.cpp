@@ -0,0 +1,87 @@
+// =============================================================================
+// collector/src/Pipeline/CurrentValueDirtySet.cpp - 현재값 변경 집합
+// =============================================================================
+
+#include "Pipeline/CurrentValueDirtySet.h"
+
+namespace PulseOne {
+namespace Pipeline {
+
+void CurrentValueDirtySet::Push(uint32_t index) {
+  Shard &shard = shards_[index % SHARD_COUNT];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.indices.push_back(index);
+  pending_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CurrentValueDirtySet::Mark(const Structs::TimestampedValue &point) {
+  const uint32_t index =
+      PointIndexRegistry::getInstance().Acquire(point.point_id);
+  if (index == PointIndexRegistry::INVALID_INDEX)
+    return;
+
+  Slot &slot = slots_.At(index);
+  bool was_dirty;
+  {
+    SlotLock lock(slot);
+    slot.entry.point_id = point.point_id;
+    slot.entry.value = point.value;
+    slot.entry.timestamp = point.timestamp;
+    slot.entry.quality = point.quality;
+    was_dirty = slot.dirty;
+    slot.dirty = true;
+  }
+  // 깨끗→더러움 전환 한 번에 목록 등록 한 번 (Drain이 다시 false로 돌림)
+  if (!was_dirty)
+    Push(index);
+}
+
+size_t CurrentValueDirtySet::Drain(std::vector<Entry> &out) {
+  const size_t before = out.size();
+  std::vector<uint32_t> indices;
+
+  for (auto &shard : shards_) {
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      if (shard.indices.empty())
+        continue;
+      indices.swap(shard.indices);
+    }
+    pending_.fetch_sub(indices.size(), std::memory_order_relaxed);
+
+    for (uint32_t index : indices) {
+      Slot *slot = slots_.Find(index);
+      if (!slot)
+        continue;
+      SlotLock lock(*slot);
+      if (!slot->dirty)
+        continue;
+      out.push_back(slot->entry);
+      slot->dirty = false;
+    }
+    indices.clear();
+  }
+  return out.size() - before;
+}
+
+void CurrentValueDirtySet::Requeue(const std::vector<Entry> &entries) {
+  auto &registry = PointIndexRegistry::getInstance();
+  for (const auto &entry : entries) {
+    const uint32_t index = registry.IndexOf(entry.point_id);
+    if (index == PointIndexRegistry::INVALID_INDEX)
+      continue;
+    Slot *slot = slots_.Find(index);
+    if (!slot)
+      continue;
+    {
+      SlotLock lock(*slot);
+      if (slot->dirty)
+        continue; // 더 새 값이 이미 대기 중
+      slot->dirty = true;
+    }
+    Push(index);
+  }
+}
+
+} // namespace Pipeline
+} // namespace PulseOne
@@ -12,6 +12,7 @@
 #include "Pipeline/DataProcessingService.h"
 #include "Alarm/AlarmManager.h"
 #include "Client/InfluxClientImpl.h"
+#include "Client/LineProtocolEncoder.h"
 #include "Client/RedisClientImpl.h"
 #include "Common/Enums.h"
 #include "Database/Entities/AlarmOccurrenceEntity.h"
@@ -21,21 +22,28 @@
 #include "Database/RepositoryFactory.h"
 #include "Database/RuntimeSQLQueries.h"
 using namespace PulseOne::Database::SQL;
+#include "DatabaseAbstractionLayer.hpp"
 #include "DatabaseManager.hpp"
 #include "Logging/LogManager.h"
 #include "Pipeline/PipelineManager.h"
+#include "Pipeline/PipelineMetrics.h"
+#include "Pipeline/PointMetadataRegistry.h"
+#include "Storage/EdgeTimeSeriesStore.h"
 #include "Storage/RedisDataWriter.h"
 #include "Utils/ConfigManager.h"
 #include "VirtualPoint/VirtualPointBatchWriter.h"
 #include "VirtualPoint/VirtualPointEngine.h"
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <thread>
 
 // Includes for stages
 #include "Pipeline/Stages/AlarmStage.h"
+#include "Pipeline/Stages/DeadbandStage.h"
 #include "Pipeline/Stages/EnrichmentStage.h"
 #include "Pipeline/Stages/PersistenceStage.h"
 
@@ -45,6 +53,82 @@ using json = nlohmann::json;
 namespace PulseOne {
 namespace Pipeline {
 
+namespace {
+/**
+ * @brief 포인트 저장 주기 확인 후 선점
+ * @details 포인트 인덱스 배열에 마지막 저장 시각(steady tick, 0 = 없음)을
+ * 두고 CAS로 갱신하므로, 해시맵/뮤텍스 없이도 같은 포인트를 두 스레드가
+ * 동시에 통과시키지 않는다.
+ * @return 주기가 지나 저장해야 하면 true
+ */
+bool ClaimSaveSlot(PointStateArray<std::atomic<int64_t>> &last_ticks,
+                   int point_id, std::chrono::steady_clock::time_point now,
+                   std::chrono::steady_clock::duration interval) {
+  const uint32_t index = PointIndexRegistry::getInstance().Acquire(point_id);
+  if (index == PointIndexRegistry::INVALID_INDEX)
+    return true; // 인덱스 용량 초과: 주기 필터 없이 저장
+
+  auto &last_tick = last_ticks.At(index);
+  const int64_t now_tick = now.time_since_epoch().count();
+  int64_t prev = last_tick.load(std::memory_order_relaxed);
+  do {
+    if (prev != 0 && now_tick - prev < interval.count())
+      return false;
+  } while (!last_tick.compare_exchange_weak(prev, now_tick,
+                                            std::memory_order_relaxed));
+  return true;
+}
+
+/**
+ * @brief 롤업 대상 숫자 값 (bool/string은 false)
+ */
+bool ToRollupValue(const Structs::DataValue &value, double &out) {
+  return std::visit(
+      [&out](const auto &v) -> bool {
+        using T = std::decay_t<decltype(v)>;
+        if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+          out = static_cast<double>(v);
+          return std::isfinite(out);
+        } else {
+          return false;
+        }
+      },
+      value);
+}
+
+// 영속화 태스크용 메시지 헤더 - 저장 경로가 읽는 필드만 복사하고 points는
+// 비워 둠 (포인트는 태스크의 컬럼형 PointBatch로 따로 운반)
+// RDB: wal_lsn / Influx: 접두사 태그 / 통신 통계: 상태와 카운터
+Structs::DeviceDataMessage
+CopyMessageHeader(const Structs::DeviceDataMessage &message) {
+  Structs::DeviceDataMessage header;
+  header.device_id = message.device_id;
+  header.protocol = message.protocol;
+  header.timestamp = message.timestamp;
+  header.tenant_id = message.tenant_id;
+  header.site_id = message.site_id;
+  header.edge_server_id = message.edge_server_id;
+  header.wal_lsn = message.wal_lsn;
+  header.wal_retry = message.wal_retry;
+  header.device_status = message.device_status;
+  header.total_attempts = message.total_attempts;
+  header.total_failures = message.total_failures;
+  header.response_time = message.response_time;
+  return header;
+}
+
+// 태스크가 잡고 있는 WAL LSN (WAL 비활성이면 모두 0 → 빈 목록)
+std::vector<uint64_t> CollectWalLsns(const std::vector<PersistenceTask> &tasks) {
+  std::vector<uint64_t> lsns;
+  for (const auto &task : tasks) {
+    if (task.message.wal_lsn != 0)
+      lsns.push_back(task.message.wal_lsn);
+  }
+  return lsns;
+}
+
+} // namespace
+
 // =============================================================================
 // 생성자 및 소멸자
 // =============================================================================
@@ -70,6 +154,8 @@ DataProcessingService::DataProcessingService()
       // InfluxDB 설정 확인 및 클라이언트 생성
       auto *influx = new PulseOne::Client::InfluxClientImpl();
       influx_client_ = std::shared_ptr<PulseOne::Client::InfluxClient>(influx);
+      // 스레드는 Start()에서 연결 정보를 받은 뒤 시작
+      influx_writer_ = std::make_unique<Storage::InfluxWriter>();
 
       // Note: 실제 연결은 ConfigManager가 로드된 후에 수행되어야 함.
       // 여기서는 일단 인스턴스만 생성하고, Start() 등에서 연결 상태를
@@ -127,6 +213,33 @@ bool DataProcessingService::Start() {
     return false;
   }
 
+  // 포인트 밀집 인덱스 선등록 (이후 새 포인트는 처음 볼 때 등록)
+  PointIndexRegistry::getInstance().LoadConfiguredPoints();
+  // 포인트 이름/단위/디바이스명 스냅샷 (설정 변경 시 디바이스 단위 갱신)
+  PointMetadataRegistry::getInstance().LoadAll();
+  // 롤업 엔진 설정 + 지난 종료 때 열려 있던 윈도우 복원 (처리 스레드 시작 전)
+  rollup_engine_.Configure(Storage::RollupOptions::FromConfig());
+  RestoreOpenRollups();
+  // 내장 엣지 시계열 저장소 (InfluxDB 없는 현장용 INFLUX_SAVE 대상)
+  auto edge_tsdb_options = Storage::EdgeTsdbOptions::FromConfig();
+  if (edge_tsdb_options.enabled)
+    Storage::EdgeTimeSeriesStore::getInstance().Open(edge_tsdb_options);
+
+  // 디바이스 친화 모드: 처리 스레드 ↔ 샤드 그룹 고정
+  if (device_affinity_enabled_.load()) {
+    size_t consumers = pipeline_manager.SetConsumerAffinity(thread_count_);
+    if (consumers < thread_count_) {
+      LogManager::getInstance().log(
+          "processing", LogLevel::WARN,
+          "디바이스 친화 모드: 스레드 수를 샤드 수에 맞춰 " +
+              std::to_string(thread_count_) + " → " +
+              std::to_string(consumers) + "로 조정");
+      thread_count_ = consumers;
+    }
+  } else {
+    pipeline_manager.SetConsumerAffinity(0);
+  }
+
   should_stop_ = false;
   is_running_ = true;
 
@@ -152,12 +265,14 @@ bool DataProcessingService::Start() {
   // Pipeline 초기화
   InitializePipeline();
 
-  LogManager::getInstance().log("processing", LogLevel::INFO,
-                                "DataProcessingService 시작 완료 (Threads: " +
-                                    std::to_string(thread_count_) + ")");
+  LogManager::getInstance().log(
+      "processing", LogLevel::INFO,
+      "DataProcessingService 시작 완료 (Threads: " +
+          std::to_string(thread_count_) + ", DeviceAffinity: " +
+          (device_affinity_enabled_.load() ? "ON" : "OFF") + ")");
 
   // InfluxDB 연결 시도 (환경 변수 우선)
-  if (influx_client_) {
+  if (influx_client_ && influx_writer_) {
     try {
       auto &config = ConfigManager::getInstance();
 
@@ -204,8 +319,17 @@ bool DataProcessingService::Start() {
       } else {
         LogManager::getInstance().log(
             "processing", LogLevel::WARN,
-            "InfluxDB 연결 실패! (데이터는 유실될 수 있습니다: " + url + ")");
+            "InfluxDB 연결 실패! (InfluxWriter가 재연결까지 스풀에 보관: " +
+                url + ")");
       }
+
+      // 실제 쓰기는 비동기 라이터가 담당 (연결 실패여도 시작 → 스풀/재시도)
+      auto writer_options = Storage::InfluxWriterOptions::FromConfig();
+      writer_options.url = url;
+      writer_options.token = token;
+      writer_options.org = org;
+      writer_options.bucket = bucket;
+      influx_writer_->Start(writer_options);
     } catch (const std::exception &e) {
       LogManager::getInstance().log("processing", LogLevel::WARN,
                                     "InfluxDB 연결 중 예외 발생: " +
@@ -248,9 +372,23 @@ void DataProcessingService::Stop() {
     persistence_thread_.join();
   }
 
-  // 🔥 종료 전 Redis 모든 current_values → SQLite 일괄 플러시
+  // 끝난 롤업 윈도우는 내보내고 진행 중인 윈도우는 체크포인트 (라이터 종료 전)
+  ProcessRollups(true);
+
+  // 열린 청크 봉인 + 현재 파티션 색인 기록
+  Storage::EdgeTimeSeriesStore::getInstance().Close();
+
+  // Persistence 스레드가 넣은 마지막 줄까지 전송 (실패분은 스풀에 남음)
+  if (influx_writer_) {
+    influx_writer_->Stop();
+  }
+
+  // 🔥 종료 전 아직 동기화되지 않은 current_values → SQLite 일괄 플러시
   FlushCurrentValuesToSQLite();
 
+  // 저장까지 끝난 지점을 WAL 체크포인트로 남기고 닫음
+  PipelineManager::getInstance().CloseWal();
+
   // RDB 동기화 스레드 종료
   if (rdb_sync_thread_.joinable()) {
     rdb_sync_thread_.join();
@@ -302,28 +440,33 @@ void DataProcessingService::ProcessingThreadLoop(size_t thread_index) {
 
   while (!should_stop_.load()) {
     try {
-      auto batch = CollectBatchFromPipelineManager();
+      auto batch = CollectBatchFromPipelineManager(thread_index);
 
       if (!batch.empty()) {
         auto start_time = std::chrono::high_resolution_clock::now();
-        ProcessBatch(batch, thread_index);
+        const size_t batch_size = batch.size();
+        ProcessBatch(std::move(batch), thread_index);
         auto end_time = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
             end_time - start_time);
 
-        UpdateStatistics(batch.size(), static_cast<double>(duration.count()));
+        UpdateStatistics(batch_size, static_cast<double>(duration.count()));
       } else {
         // [CRITICAL FIX] static은 모든 스레드가 공유 → 데이터 레이스 발생
         // thread_local로 교체: 스레드별 독립 카운터 사용
+        // GetBatch가 데이터 도착 시 즉시 깨어나므로 별도 sleep 없음
         thread_local int empty_count = 0;
-        if (++empty_count >= 100) { // Every ~1 second
+        if (++empty_count >= 10) { // Every ~1 second (100ms 대기 x 10)
           LogManager::getInstance().log("processing", LogLevel::DEBUG_LEVEL,
                                         "Thread " +
                                             std::to_string(thread_index) +
                                             " waiting for data...");
           empty_count = 0;
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        // PipelineManager 종료 후에는 GetBatch가 즉시 반환되므로 스핀 방지
+        if (!PipelineManager::getInstance().IsRunning()) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
       }
 
     } catch (const std::exception &e) {
@@ -347,6 +490,11 @@ void DataProcessingService::PersistenceThreadLoop() {
     try {
       // 배치로 태스크 수집 (최대 100개씩 혹은 100ms 대기)
       auto tasks = persistence_queue_.pop_batch(100, 100);
+      ProcessRollups(false);
+      Storage::EdgeTimeSeriesStore::getInstance().Maintain(
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              std::chrono::system_clock::now().time_since_epoch())
+              .count());
       if (tasks.empty()) {
         if (should_stop_.load())
           break;
@@ -374,12 +522,16 @@ void DataProcessingService::PersistenceThreadLoop() {
       }
 
       // 개별 처리 메서드 호출 (컴파일러 부담 완화 및 코드 명확화)
+      // 저장에 실패한 태스크의 WAL 참조는 남겨 WAL이 다시 투입 (Retry)
+      auto &wal = PipelineManager::getInstance().GetWal();
       if (!rdb_tasks.empty())
-        ProcessRDBTasks(rdb_tasks);
+        wal.Release(CollectWalLsns(rdb_tasks), ProcessRDBTasks(rdb_tasks));
       if (!influx_tasks.empty())
-        ProcessInfluxTasks(influx_tasks);
-      if (!comm_stats_tasks.empty())
+        ProcessInfluxTasks(influx_tasks); // WAL 참조는 InfluxWriter가 반환
+      if (!comm_stats_tasks.empty()) {
         ProcessCommStatsTasks(comm_stats_tasks);
+        wal.Release(CollectWalLsns(comm_stats_tasks), true);
+      }
 
     } catch (const std::exception &e) {
       LogManager::getInstance().log("processing", LogLevel::LOG_ERROR,
@@ -392,13 +544,13 @@ void DataProcessingService::PersistenceThreadLoop() {
                                 "Persistence 스레드 종료");
 }
 
-void DataProcessingService::ProcessRDBTasks(
+bool DataProcessingService::ProcessRDBTasks(
     const std::vector<PersistenceTask> &rdb_tasks) {
   auto &factory = PulseOne::Database::RepositoryFactory::getInstance();
   auto current_value_repo = factory.getCurrentValueRepository();
 
   if (!current_value_repo)
-    return;
+    return false;
 
   // 🔥 모든 task의 포인트를 한 번에 모아 saveBatch() 1회 호출
   // (기존: 포인트당 개별 트랜잭션 → 30K 포인트 = 30K 트랜잭션 → 느림)
@@ -407,14 +559,16 @@ void DataProcessingService::ProcessRDBTasks(
 
   size_t total_points = 0;
   for (const auto &task : rdb_tasks) {
-    total_points += task.points.size();
+    total_points += task.points.Size();
   }
   batch_entities.reserve(total_points);
 
   for (const auto &task : rdb_tasks) {
-    for (const auto &point : task.points) {
+    for (size_t row = 0; row < task.points.Size(); ++row) {
       try {
-        auto entity = ConvertToCurrentValueEntity(point, task.message);
+        // 엔티티 변환 경계에서만 레거시 구조체로 복원
+        auto entity =
+            ConvertToCurrentValueEntity(task.points.ToLegacy(row), task.message);
         batch_entities.push_back(std::move(entity));
       } catch (...) {
         // 변환 실패 포인트는 건너뜀
@@ -423,7 +577,7 @@ void DataProcessingService::ProcessRDBTasks(
   }
 
   if (batch_entities.empty())
-    return;
+    return true;
 
   // 🔒 SQLite 직렬화: FlushCurrentValuesToSQLite와 동시 executeBatch() 호출
   // 방지
@@ -435,10 +589,11 @@ void DataProcessingService::ProcessRDBTasks(
         "processing", LogLevel::DEBUG_LEVEL,
         "🔥 디지털 RDB 즉시 저장: " + std::to_string(saved) + "개 포인트");
   }
+  return saved > 0;
 }
 
 // =============================================================================
-// 🔥 주기 Redis→SQLite 동기화 (아날로그 포인트 배치 저장)
+// 🔥 주기 RDB 동기화 (변경된 아날로그 포인트 배치 저장)
 // =============================================================================
 
 void DataProcessingService::RdbSyncThreadLoop() {
@@ -458,7 +613,7 @@ void DataProcessingService::RdbSyncThreadLoop() {
     if (should_stop_.load())
       break;
 
-    // Redis 전체 스캔 → current_values 배치 저장
+    // 변경된 포인트만 current_values 배치 저장
     FlushCurrentValuesToSQLite();
   }
 
@@ -467,172 +622,411 @@ void DataProcessingService::RdbSyncThreadLoop() {
 }
 
 void DataProcessingService::FlushCurrentValuesToSQLite() {
-  // Redis keys("point:*:current") + mget() 2회 호출로 모든 포인트 최신값 배치
-  // 조회 → 기존: 포인트마다 GET N회, 개선: 2회 왕복으로 30K포인트 처리
+  // 처리 스레드가 기록한 변경 집합만 저장 (Redis 왕복/JSON 파싱 없음)
+  // → 비용이 전체 포인트 수가 아니라 변경량에 비례
   auto &factory = PulseOne::Database::RepositoryFactory::getInstance();
   auto current_value_repo = factory.getCurrentValueRepository();
   if (!current_value_repo)
     return;
 
-  auto &db_manager = DbLib::DatabaseManager::getInstance();
-  auto *redis = db_manager.getRedisClient();
-  if (!redis) {
-    LogManager::getInstance().log(
-        "processing", LogLevel::DEBUG_LEVEL,
-        "FlushCurrentValuesToSQLite: Redis 없음, 스킵");
+  std::vector<CurrentValueDirtySet::Entry> dirty;
+  if (current_value_dirty_.Drain(dirty) == 0)
     return;
-  }
 
   try {
-    // 1) SCAN으로 논블로킹 키 순회 (KEYS 대신 사용 - 30K+ 키 안전)
-    auto keys = redis->scan("point:*:current", 200);
-    if (keys.empty())
-      return;
-
-    // 2) MGET으로 모든 값 한 번에 조회 (1회 왕복)
-    auto values = redis->mget(keys);
-
     std::vector<PulseOne::Database::Entities::CurrentValueEntity> batch;
-    batch.reserve(keys.size());
-
-    for (size_t i = 0; i < keys.size() && i < values.size(); ++i) {
-      if (values[i].empty())
-        continue;
-
-      // 키에서 point_id 추출: "point:12345:current" → 12345
-      int point_id = 0;
-      try {
-        const auto &k = keys[i];
-        auto first_colon = k.find(':');
-        auto second_colon = k.find(':', first_colon + 1);
-        if (first_colon == std::string::npos ||
-            second_colon == std::string::npos)
-          continue;
-        point_id = std::stoi(
-            k.substr(first_colon + 1, second_colon - first_colon - 1));
-      } catch (...) {
-        continue;
-      }
-
+    batch.reserve(dirty.size());
+
+    // 엔티티 변환은 포인트 필드만 사용 (메시지는 빈 값)
+    const Structs::DeviceDataMessage no_message;
+    Structs::TimestampedValue point;
+    for (const auto &entry : dirty) {
+      point.point_id = entry.point_id;
+      point.value = entry.value;
+      point.timestamp = entry.timestamp;
+      point.quality = entry.quality;
       try {
-        auto j = nlohmann::json::parse(values[i]);
-        PulseOne::Database::Entities::CurrentValueEntity entity;
-        entity.setPointId(point_id);
-        entity.setCurrentValue(j.value("value", ""));
-        entity.setRawValue(j.value("value", ""));
-        entity.setValueType("number");
-        entity.setQuality(
-            static_cast<PulseOne::Enums::DataQuality>(j.value("quality", 0)));
-        entity.setValueTimestamp(PulseOne::Utils::GetCurrentTimestamp());
-        batch.push_back(std::move(entity));
+        batch.push_back(ConvertToCurrentValueEntity(point, no_message));
       } catch (...) {
-        // JSON 파싱 실패 시 스킵
+        // 변환 실패 포인트는 건너뜀
       }
     }
 
     if (batch.empty())
       return;
 
-    // 🔒 SQLite 직렬화: ProcessRDBTasks와 동시 executeBatch() 호출 방지
-    std::lock_guard<std::mutex> lock(sqlite_write_mutex_);
-    size_t saved = current_value_repo->saveBatch(batch);
+    size_t saved = 0;
+    {
+      // 🔒 SQLite 직렬화: ProcessRDBTasks와 동시 saveBatch() 호출 방지
+      std::lock_guard<std::mutex> lock(sqlite_write_mutex_);
+      saved = current_value_repo->saveBatch(batch);
+    }
+
+    if (saved == 0) {
+      // 다음 주기에 다시 시도 (그 사이 더 새 값이 온 포인트는 새 값 유지)
+      current_value_dirty_.Requeue(dirty);
+      LogManager::getInstance().log(
+          "processing", LogLevel::WARN,
+          "🔄 RDB 주기 동기화 실패: " + std::to_string(batch.size()) +
+              "개 포인트 다음 주기에 재시도");
+      return;
+    }
+
     LogManager::getInstance().log(
         "processing", LogLevel::INFO,
-        "🔄 Redis→SQLite 주기 동기화: " + std::to_string(saved) + "/" +
-            std::to_string(batch.size()) + "개 포인트 저장 (SCAN+MGET)");
+        "🔄 RDB 주기 동기화: " + std::to_string(saved) + "/" +
+            std::to_string(batch.size()) + "개 변경 포인트 저장");
 
   } catch (const std::exception &e) {
+    current_value_dirty_.Requeue(dirty);
     LogManager::getInstance().log("processing", LogLevel::WARN,
                                   "FlushCurrentValuesToSQLite 실패: " +
                                       std::string(e.what()));
   }
 }
 
+const std::string &DataProcessingService::GetInfluxLinePrefix(
+    const Structs::DeviceDataMessage &msg, int point_id, bool is_virtual) {
+  // 두 값 모두 단조 증가하므로 합이 바뀌면 어느 한쪽이 바뀐 것
+  const uint64_t generation =
+      influx_prefix_generation_.load(std::memory_order_relaxed) +
+      PointMetadataRegistry::getInstance().Generation();
+  const uint32_t index = PointIndexRegistry::getInstance().Acquire(point_id);
+
+  InfluxLinePrefix *cached = nullptr;
+  if (index != PointIndexRegistry::INVALID_INDEX) {
+    cached = &influx_line_prefixes_.At(index);
+    if (cached->generation == generation && cached->is_virtual == is_virtual &&
+        cached->tenant_id == msg.tenant_id && cached->site_id == msg.site_id &&
+        cached->device_id == msg.device_id && cached->protocol == msg.protocol)
+      return cached->text;
+  }
+
+  // 태그는 키 순서로 (InfluxDB 권장, 기존 std::map 순서와 동일)
+  const std::string point_id_str = std::to_string(point_id);
+  const Client::LineProtocolEncoder::Tags tags = {
+      {"device_id", msg.device_id},
+      {"point_id", point_id_str},
+      {"point_name", getPointName(point_id, is_virtual)},
+      {"protocol", msg.protocol},
+      {"site_id", std::to_string(msg.site_id)},
+      {"tenant_id", std::to_string(msg.tenant_id)}};
+  std::string text = Client::LineProtocolEncoder::BuildPrefix(
+      "device_telemetry", tags, "p_" + point_id_str);
+
+  if (!cached) {
+    influx_prefix_scratch_ = std::move(text);
+    return influx_prefix_scratch_;
+  }
+  cached->generation = generation;
+  cached->is_virtual = is_virtual;
+  cached->tenant_id = msg.tenant_id;
+  cached->site_id = msg.site_id;
+  cached->device_id = msg.device_id;
+  cached->protocol = msg.protocol;
+  cached->text = std::move(text);
+  return cached->text;
+}
+
 void DataProcessingService::ProcessInfluxTasks(
     const std::vector<PersistenceTask> &influx_tasks) {
-  if (!influx_client_)
+  auto &edge_store = Storage::EdgeTimeSeriesStore::getInstance();
+  if (edge_store.IsEnabled()) {
+    for (const auto &task : influx_tasks) {
+      const auto &points = task.points;
+      // WAL 재투입분은 처음 처리 때 이미 기록됨
+      if (task.message.wal_retry)
+        continue;
+      for (size_t row = 0; row < points.Size(); ++row) {
+        // 저장소 키는 point_id 뿐이라 ID가 겹칠 수 있는 가상포인트는 제외
+        // (롤업과 동일)
+        if (points.IsString(row) ||
+            points.HasFlag(row, PointBatch::FLAG_VIRTUAL_POINT))
+          continue;
+        edge_store.Append(
+            points.PointId(row),
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                points.Time(row).time_since_epoch())
+                .count(),
+            points.NumericValue(row));
+      }
+    }
+  }
+
+  auto &wal = PipelineManager::getInstance().GetWal();
+  std::vector<uint64_t> wal_lsns = CollectWalLsns(influx_tasks);
+
+  // 라이터가 없으면 Influx 저장 대상 아님 (체크포인트 진행)
+  if (!influx_writer_ || !influx_writer_->IsRunning()) {
+    wal.Release(wal_lsns, true);
     return;
+  }
 
-  std::vector<std::string> batch_lines;
-  batch_lines.reserve(influx_tasks.size() * 5); // Conservative estimate
+  // 🔥 캐시된 접두사 + 값 + 타임스탬프를 버퍼 하나에 이어 쓰기
+  // (기존: 포인트마다 태그 map + ostringstream + 이스케이프 반복)
+  std::string &buffer = influx_line_buffer_;
+  buffer.clear();
+  size_t lines = 0;
 
   for (const auto &task : influx_tasks) {
     const auto &msg = task.message;
-    std::string measurement = "device_telemetry";
-
-    for (const auto &point : task.points) {
-      std::map<std::string, std::string> tags;
-      tags["device_id"] = msg.device_id;
-      tags["protocol"] = msg.protocol;
-      tags["tenant_id"] = std::to_string(msg.tenant_id);
-      tags["site_id"] = std::to_string(msg.site_id);
-      tags["point_id"] = std::to_string(point.point_id);
-      tags["point_name"] = getPointName(point.point_id);
-
-      std::map<std::string, double> fields;
-
-      std::visit(
-          [&](const auto &val) {
-            using T = std::decay_t<decltype(val)>;
-            if constexpr (std::is_arithmetic_v<T>) {
-              fields["p_" + std::to_string(point.point_id)] =
-                  static_cast<double>(val);
-            }
-          },
-          point.value);
-
-      if (!fields.empty()) {
-        // [BUG #25 FIX] Use actual measurement timestamp instead of now().
-        // Convert point.timestamp (system_clock::time_point) to epoch seconds.
-        long long epoch_s = std::chrono::duration_cast<std::chrono::seconds>(
-                                point.timestamp.time_since_epoch())
-                                .count();
-
-        // Build line protocol manually so we can pass the real timestamp.
-        // Tags are already escaped inside formatLineProtocol.
-        std::string measurement_escaped = "device_telemetry";
-        std::ostringstream line;
-        line << measurement_escaped;
-        for (const auto &[k, v] : tags) {
-          // Inline escape: space→\ , comma→\, , equals→\=
-          auto esc = [](const std::string &s) {
-            std::string o;
-            o.reserve(s.size() + 4);
-            for (char c : s) {
-              if (c == ' ')
-                o += "\\ ";
-              else if (c == ',')
-                o += "\\,";
-              else if (c == '=')
-                o += "\\=";
-              else
-                o += c;
-            }
-            return o;
-          };
-          line << "," << esc(k) << "=" << esc(v);
-        }
-        line << " ";
-        bool first_f = true;
-        for (const auto &[k, v] : fields) {
-          if (!first_f)
-            line << ",";
-          line << k << "=" << v;
-          first_f = false;
-        }
-        if (epoch_s > 0)
-          line << " " << epoch_s;
+    const auto &points = task.points;
+    for (size_t row = 0; row < points.Size(); ++row) {
+      if (points.IsString(row))
+        continue;
 
-        batch_lines.push_back(line.str());
+      // [BUG #25 FIX] Use actual measurement timestamp instead of now().
+      // 라이터 정밀도(기본 ms)로 변환해 1초 미만 샘플이 겹치지 않게 함
+      const int64_t timestamp = influx_writer_->ToTimestamp(points.Time(row));
+      if (Client::LineProtocolEncoder::AppendLine(
+              buffer,
+              GetInfluxLinePrefix(
+                  msg, points.PointId(row),
+                  points.HasFlag(row, PointBatch::FLAG_VIRTUAL_POINT)),
+              points.NumericValue(row), timestamp)) {
+        ++lines;
       }
     }
   }
 
-  if (!batch_lines.empty()) {
-    if (influx_client_->writeBatch(batch_lines)) {
-      influx_writes_.fetch_add(batch_lines.size());
+  if (lines == 0) {
+    wal.Release(wal_lsns, true);
+    return;
+  }
+
+  // 큐에 넣고 바로 반환 - 전송/재시도/스풀과 WAL 참조 반환은 InfluxWriter
+  // 스레드가 처리 (큐 수락만으로는 저장된 것이 아님)
+  const size_t capacity = buffer.capacity();
+  influx_writes_.fetch_add(influx_writer_->EnqueueBlock(
+      std::move(buffer), lines, std::move(wal_lsns)));
+  buffer = std::string();
+  buffer.reserve(capacity);
+}
+
+// =============================================================================
+// 롤업 / 보존 기간
+// =============================================================================
+
+void DataProcessingService::ProcessRollups(bool force) {
+  if (!rollup_engine_.IsEnabled())
+    return;
+
+  const auto &options = rollup_engine_.GetOptions();
+  const auto steady_now = std::chrono::steady_clock::now();
+  if (!force && steady_now < next_rollup_flush_)
+    return;
+  next_rollup_flush_ =
+      steady_now + std::chrono::milliseconds(options.flush_interval_ms);
+
+  const auto now = std::chrono::system_clock::now();
+  try {
+    rollup_rows_.clear();
+    if (rollup_engine_.Collect(now, rollup_rows_) > 0) {
+      if (options.to_influx)
+        WriteRollupsToInflux(rollup_rows_);
+      if (options.to_sqlite)
+        WriteRollupsToSQLite(rollup_rows_);
+    }
+
+    // 부분 윈도우를 내보내면 재시작 후 같은 윈도우 행이 뒷부분만으로
+    // 덮어써지므로 누적 상태로 남겨 두었다가 RestoreOpenRollups에서 이어감
+    if (force) {
+      rollup_rows_.clear();
+      if (rollup_engine_.TakeOpen(rollup_rows_) > 0)
+        SaveOpenRollups(rollup_rows_);
+      return;
+    }
+
+    if (steady_now >= next_retention_sweep_) {
+      next_retention_sweep_ =
+          steady_now + std::chrono::minutes(options.retention_sweep_minutes);
+      ApplyRetention(now);
+    }
+  } catch (const std::exception &e) {
+    LogManager::getInstance().log("processing", LogLevel::WARN,
+                                  "롤업 처리 실패: " + std::string(e.what()));
+  }
+}
+
+void DataProcessingService::WriteRollupsToInflux(
+    const std::vector<Storage::RollupRow> &rows) {
+  if (!influx_writer_ || !influx_writer_->IsRunning())
+    return;
+
+  using Encoder = Client::LineProtocolEncoder;
+  const auto metadata = PointMetadataRegistry::getInstance().GetSnapshot();
+  std::string buffer;
+  buffer.reserve(rows.size() * 160);
+  size_t lines = 0;
+
+  for (const auto &row : rows) {
+    // 롤업은 데이터포인트만 누적 (BuildInfluxTask)
+    const PointMetadata *meta = metadata->Find(row.point_id, false);
+    const std::string point_id_str = std::to_string(row.point_id);
+    const Encoder::Tags tags = {
+        {"device_id", meta ? std::to_string(meta->device_id) : std::string()},
+        {"point_id", point_id_str},
+        {"point_name", meta && !meta->name.empty() ? meta->name
+                                                   : "point_" + point_id_str}};
+    buffer += Encoder::BuildPrefix(
+        std::string("device_telemetry_") +
+            Storage::RollupEngine::TierSuffix(row.tier),
+        tags);
+
+    buffer += "min=";
+    Encoder::AppendDouble(buffer, row.min);
+    buffer += ",max=";
+    Encoder::AppendDouble(buffer, row.max);
+    buffer += ",mean=";
+    Encoder::AppendDouble(buffer, row.mean);
+    buffer += ",last=";
+    Encoder::AppendDouble(buffer, row.last);
+    buffer += ",count=";
+    Encoder::AppendInteger(buffer, row.count);
+    buffer += "i ";
+    const std::chrono::system_clock::time_point window_start{
+        std::chrono::milliseconds(row.window_start_ms)};
+    Encoder::AppendInteger(buffer, influx_writer_->ToTimestamp(window_start));
+    buffer += '\n';
+    ++lines;
+  }
+
+  influx_writes_.fetch_add(
+      influx_writer_->EnqueueBlock(std::move(buffer), lines));
+}
+
+void DataProcessingService::WriteRollupsToSQLite(
+    const std::vector<Storage::RollupRow> &rows) {
+  std::vector<std::string> queries;
+  queries.reserve(rows.size() + 1);
+  if (!rollup_table_ready_)
+    queries.push_back(Runtime::PointRollup::CREATE_TABLE);
+
+  for (const auto &row : rows) {
+    queries.push_back(Runtime::PointRollup::UPSERT(
+        row.point_id, Storage::RollupEngine::TierSuffix(row.tier),
+        row.window_start_ms, row.min, row.max, row.mean, row.last, row.count));
+  }
+
+  // 🔒 SQLite 직렬화 (ProcessRDBTasks/FlushCurrentValuesToSQLite와 공유)
+  std::lock_guard<std::mutex> lock(sqlite_write_mutex_);
+  DbLib::DatabaseAbstractionLayer db_layer;
+  if (db_layer.executeBatch(queries)) {
+    rollup_table_ready_ = true;
+  }
+}
+
+void DataProcessingService::SaveOpenRollups(
+    const std::vector<Storage::RollupRow> &rows) {
+  std::vector<std::string> queries;
+  queries.reserve(rows.size() + 2);
+  queries.push_back(Runtime::PointRollup::CREATE_OPEN_TABLE);
+  for (const auto &row : rows) {
+    queries.push_back(Runtime::PointRollup::INSERT_OPEN(
+        row.point_id, Storage::RollupEngine::TierSuffix(row.tier),
+        row.window_start_ms, row.min, row.max, row.sum, row.last, row.count));
+  }
+
+  std::lock_guard<std::mutex> lock(sqlite_write_mutex_);
+  DbLib::DatabaseAbstractionLayer db_layer;
+  if (!db_layer.executeBatch(queries)) {
+    LogManager::getInstance().log("processing", LogLevel::WARN,
+                                  "열린 롤업 윈도우 체크포인트 실패: " +
+                                      std::to_string(rows.size()) + "개 유실");
+    return;
+  }
+  LogManager::getInstance().log("processing", LogLevel::INFO,
+                                "열린 롤업 윈도우 체크포인트: " +
+                                    std::to_string(rows.size()) + "개");
+}
+
+void DataProcessingService::RestoreOpenRollups() {
+  if (!rollup_engine_.IsEnabled())
+    return;
+
+  size_t restored = 0;
+  try {
+    std::lock_guard<std::mutex> lock(sqlite_write_mutex_);
+    DbLib::DatabaseAbstractionLayer db_layer;
+    if (!db_layer.executeNonQuery(Runtime::PointRollup::CREATE_OPEN_TABLE))
+      return;
+    const auto results = db_layer.executeQuery(Runtime::PointRollup::SELECT_OPEN);
+    for (const auto &result : results) {
+      Storage::RollupRow row;
+      if (!Storage::RollupEngine::ParseTierSuffix(result.at("tier"), row.tier))
+        continue;
+      row.point_id = std::stoi(result.at("point_id"));
+      row.window_start_ms = std::stoll(result.at("window_start"));
+      row.min = std::stod(result.at("min_value"));
+      row.max = std::stod(result.at("max_value"));
+      row.sum = std::stod(result.at("sum_value"));
+      row.last = std::stod(result.at("last_value"));
+      row.count = static_cast<uint32_t>(std::stoul(result.at("sample_count")));
+      rollup_engine_.Restore(row);
+      ++restored;
+    }
+    // 한 번만 되살림 (다음 종료 때 다시 기록)
+    db_layer.executeNonQuery(Runtime::PointRollup::DELETE_OPEN);
+  } catch (const std::exception &e) {
+    LogManager::getInstance().log("processing", LogLevel::WARN,
+                                  "열린 롤업 윈도우 복원 실패: " +
+                                      std::string(e.what()));
+    return;
+  }
+
+  if (restored > 0) {
+    LogManager::getInstance().log("processing", LogLevel::INFO,
+                                  "열린 롤업 윈도우 복원: " +
+                                      std::to_string(restored) + "개");
+  }
+}
+
+void DataProcessingService::ApplyRetention(
+    std::chrono::system_clock::time_point now) {
+  const auto &options = rollup_engine_.GetOptions();
+  auto cutoff = [now](int hours) { return now - std::chrono::hours(hours); };
+
+  // Influx: raw/롤업 measurement별로 삭제 예약 (라이터 스레드가 실행)
+  if (influx_writer_ && influx_writer_->IsRunning()) {
+    if (options.raw_retention_hours > 0) {
+      influx_writer_->RequestDelete("device_telemetry",
+                                    cutoff(options.raw_retention_hours));
+    }
+    if (options.to_influx) {
+      for (size_t tier = 0; tier < Storage::ROLLUP_TIER_COUNT; ++tier) {
+        if (options.retention_hours[tier] <= 0)
+          continue;
+        influx_writer_->RequestDelete(
+            std::string("device_telemetry_") +
+                Storage::RollupEngine::TierSuffix(
+                    static_cast<Storage::RollupTier>(tier)),
+            cutoff(options.retention_hours[tier]));
+      }
     }
   }
+
+  if (!options.to_sqlite || !rollup_table_ready_)
+    return;
+
+  std::vector<std::string> queries;
+  for (size_t tier = 0; tier < Storage::ROLLUP_TIER_COUNT; ++tier) {
+    if (options.retention_hours[tier] <= 0)
+      continue;
+    const auto before_ms =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            cutoff(options.retention_hours[tier]).time_since_epoch())
+            .count();
+    queries.push_back(Runtime::PointRollup::DELETE_BEFORE(
+        Storage::RollupEngine::TierSuffix(
+            static_cast<Storage::RollupTier>(tier)),
+        before_ms));
+  }
+  if (queries.empty())
+    return;
+
+  std::lock_guard<std::mutex> lock(sqlite_write_mutex_);
+  DbLib::DatabaseAbstractionLayer db_layer;
+  db_layer.executeBatch(queries);
 }
 
 void DataProcessingService::ProcessCommStatsTasks(
@@ -657,8 +1051,9 @@ void DataProcessingService::ProcessCommStatsTasks(
             : 0.0;
     fields["success_rate"] = success_rate;
 
-    if (influx_client_) {
-      influx_client_->writeRecord("comm_stats", tags, fields);
+    if (influx_client_ && influx_writer_) {
+      influx_writer_->Enqueue(
+          influx_client_->formatRecord("comm_stats", tags, fields));
     }
 
     // 🔧 E2E 스크립트 및 백엔드 호환성: device_status 테이블 상태 업데이트
@@ -717,8 +1112,11 @@ void DataProcessingService::ProcessCommStatsTasks(
 }
 
 std::vector<Structs::DeviceDataMessage>
-DataProcessingService::CollectBatchFromPipelineManager() {
+DataProcessingService::CollectBatchFromPipelineManager(size_t thread_index) {
   auto &pipeline_manager = PipelineManager::getInstance();
+  if (device_affinity_enabled_.load()) {
+    return pipeline_manager.GetBatchForConsumer(thread_index, batch_size_, 100);
+  }
   return pipeline_manager.GetBatch(batch_size_, 100);
 }
 
@@ -734,7 +1132,10 @@ void DataProcessingService::InitializePipeline() {
   // 1. Enrichment Stage
   pipeline_stages_.push_back(std::make_unique<Stages::EnrichmentStage>());
 
-  // 2. Alarm Stage
+  // 2. Deadband Stage - 변화 없는 샘플은 알람/저장 전에 제거 (report-by-exception)
+  pipeline_stages_.push_back(std::make_unique<Stages::DeadbandStage>());
+
+  // 3. Alarm Stage
   pipeline_stages_.push_back(std::make_unique<Stages::AlarmStage>());
 
   // DataProxy Wrappers
@@ -754,52 +1155,106 @@ void DataProcessingService::InitializePipeline() {
 }
 
 void DataProcessingService::ProcessBatch(
-    const std::vector<Structs::DeviceDataMessage> &batch, size_t thread_index) {
+    std::vector<Structs::DeviceDataMessage> &&batch, size_t thread_index) {
 
   if (batch.empty())
     return;
 
+  const size_t batch_size = batch.size();
+  auto &wal = PipelineManager::getInstance().GetWal();
+  std::vector<uint64_t> wal_lsns;
+
   auto start_time = std::chrono::high_resolution_clock::now();
 
   try {
     LogManager::getInstance().log(
         "processing", LogLevel::INFO,
-        "ProcessBatch Pipeline Start: " + std::to_string(batch.size()) +
+        "ProcessBatch Pipeline Start: " + std::to_string(batch_size) +
             " messages (Thread " + std::to_string(thread_index) + ")");
 
+    // WAL 재투입 메시지는 스테이지를 거치지 않고 Influx 저장만 다시
+    auto retry_begin = std::stable_partition(
+        batch.begin(), batch.end(),
+        [](const Structs::DeviceDataMessage &m) { return !m.wal_retry; });
+    if (retry_begin != batch.end()) {
+      std::vector<Structs::DeviceDataMessage> retries(
+          std::make_move_iterator(retry_begin),
+          std::make_move_iterator(batch.end()));
+      batch.erase(retry_begin, batch.end());
+      QueueWalRetries(retries);
+      if (batch.empty())
+        return;
+    }
+
     size_t processed_count = 0;
 
+    // 처리용 WAL 참조는 이 배치가 끝나면 반환 (저장 태스크는 따로 Retain)
     for (const auto &message : batch) {
-      try {
-
-        // Initialize Context
-        PipelineContext context(message);
-        context.should_evaluate_alarms = alarm_evaluation_enabled_.load();
-
-        // Execute Pipeline
-        for (auto &stage : pipeline_stages_) {
-          if (!stage->Process(context)) {
-            break; // Stop if stage returns false
-          }
-        }
+      if (message.wal_lsn != 0)
+        wal_lsns.push_back(message.wal_lsn);
+    }
 
-        // Update Global Counters from Context Stats
-        if (context.stats.virtual_points_added > 0)
-          virtual_points_calculated_.fetch_add(
-              context.stats.virtual_points_added);
-        if (context.stats.alarms_triggered > 0)
-          alarms_evaluated_.fetch_add(1); // Approximate
-        if (context.stats.persisted_to_redis)
-          redis_writes_.fetch_add(1); // Per message or point?
+    // Initialize Contexts - 메시지는 복사하지 않고 컨텍스트로 이동
+    std::vector<PipelineContext> contexts;
+    contexts.reserve(batch_size);
+    const bool evaluate_alarms = alarm_evaluation_enabled_.load();
+    for (auto &message : batch) {
+      contexts.emplace_back(std::move(message));
+      contexts.back().should_evaluate_alarms = evaluate_alarms;
+    }
+    batch.clear();
 
-        processed_count++;
+    auto &metrics = PipelineMetrics::getInstance();
 
+    // Execute Pipeline - 각 스테이지가 배치 전체를 한 번에 처리
+    for (auto &stage : pipeline_stages_) {
+      try {
+        auto stage_start = std::chrono::steady_clock::now();
+        stage->ProcessBatch(contexts);
+        metrics.Record(PipelineMetrics::STAGE, stage->GetName(),
+                       std::chrono::steady_clock::now() - stage_start);
       } catch (const std::exception &e) {
-        LogManager::getInstance().Error(
-            "Pipeline Error (device=" + message.device_id +
-            "): " + std::string(e.what()));
-        processing_errors_.fetch_add(1);
+        // 스테이지는 메시지별로 실패를 가두지만, 그 밖에서 던지면 아직
+        // 살아있는 메시지만 실패 처리하고 이미 멈춘 메시지는 그대로 둠
+        LogManager::getInstance().Error("Pipeline Error (stage=" +
+                                        stage->GetName() + ", batch=" +
+                                        std::to_string(contexts.size()) +
+                                        "): " + std::string(e.what()));
+        for (auto &context : contexts) {
+          if (context.halted)
+            continue;
+          context.halted = true;
+          context.failed = true;
+        }
+      }
+    }
+
+    // 메시지 생성 → 파이프라인 완료 지연 (프로토콜별)
+    const auto completed_at = std::chrono::system_clock::now();
+    const std::string *last_protocol = nullptr;
+    LatencyHistogram *end_to_end = nullptr;
+    for (const auto &context : contexts) {
+      const auto &message = context.message;
+      if (!last_protocol || *last_protocol != message.protocol) {
+        last_protocol = &message.protocol;
+        end_to_end = &metrics.Get(PipelineMetrics::END_TO_END,
+                                  message.protocol.empty() ? "unknown"
+                                                           : message.protocol);
       }
+      end_to_end->Record(completed_at - message.timestamp);
+    }
+
+    // Update Global Counters from Context Stats
+    for (const auto &context : contexts) {
+      if (context.stats.virtual_points_added > 0)
+        virtual_points_calculated_.fetch_add(
+            context.stats.virtual_points_added);
+      if (context.stats.alarms_triggered > 0)
+        alarms_evaluated_.fetch_add(1); // Approximate
+      if (context.stats.persisted_to_redis)
+        redis_writes_.fetch_add(1); // Per message or point?
+
+      processed_count++;
     }
 
     auto end_time = std::chrono::high_resolution_clock::now();
@@ -808,37 +1263,121 @@ void DataProcessingService::ProcessBatch(
 
     UpdateStatistics(processed_count, static_cast<double>(duration.count()));
 
+    // 실패한 메시지만 WAL 재시도로 다시 투입, 나머지는 처리 완료
+    std::vector<uint64_t> failed_lsns;
+    std::vector<uint64_t> done_lsns;
+    done_lsns.reserve(wal_lsns.size());
+    for (const auto &context : contexts) {
+      if (context.failed)
+        processing_errors_.fetch_add(1);
+      if (context.message.wal_lsn == 0)
+        continue;
+      (context.failed ? failed_lsns : done_lsns)
+          .push_back(context.message.wal_lsn);
+    }
+    wal.Release(failed_lsns, false);
+    wal.Release(done_lsns, true);
+
   } catch (const std::exception &e) {
     LogManager::getInstance().Error("ProcessBatch Critical Error: " +
                                     std::string(e.what()));
-    processing_errors_.fetch_add(batch.size());
+    processing_errors_.fetch_add(batch_size);
+    wal.Release(wal_lsns, false);
   }
 }
 
 // IPersistenceQueue Implementation
-void DataProcessingService::QueueRDBTask(
+bool DataProcessingService::BuildRDBTask(
     const Structs::DeviceDataMessage &message,
-    const std::vector<Structs::TimestampedValue> &points) {
+    const std::vector<Structs::TimestampedValue> &points,
+    PersistenceTask &task) {
 
   // 🎯 디지털(bool) 포인트 중 값이 변경된 것만 즉시 SQLite에 저장
-  // 아날로그는 RDB 큐에 넣지 않음 → RdbSyncThreadLoop이 주기적으로 처리
-  std::vector<Structs::TimestampedValue> digital_changed;
+  // 나머지는 변경 집합에 최신값만 남김 → RdbSyncThreadLoop이 주기적으로 처리
+  // 즉시 저장하는 포인트도 변경 집합에 남겨야 이전에 남아 있던 더 오래된
+  // 값이 다음 동기화 때 방금 저장한 값을 덮어쓰지 않음
+  PointBatch digital_changed;
   for (const auto &p : points) {
-    if (std::holds_alternative<bool>(p.value) && p.value_changed) {
-      digital_changed.push_back(p);
-    }
+    if (std::holds_alternative<bool>(p.value) && p.value_changed)
+      digital_changed.Append(p);
+    current_value_dirty_.Mark(p);
   }
 
-  if (digital_changed.empty())
-    return;
+  if (digital_changed.Empty())
+    return false;
 
-  PersistenceTask task;
   task.type = PersistenceTask::Type::RDB_SAVE;
-  task.message = message;
+  task.message = CopyMessageHeader(message);
   task.points = std::move(digital_changed);
+  return true;
+}
+
+bool DataProcessingService::BuildInfluxTask(
+    const Structs::DeviceDataMessage &message,
+    const std::vector<Structs::TimestampedValue> &points,
+    std::chrono::steady_clock::time_point now, PersistenceTask &task) {
+
+  const int interval_ms = influxdb_storage_interval_ms_.load();
+  const bool rollup_enabled = rollup_engine_.IsEnabled();
+  // 포인트별 이력 설정(log_enabled/log_interval_ms)은 스냅샷 한 번으로 조회
+  const auto metadata = PointMetadataRegistry::getInstance().GetSnapshot();
+  PointBatch filtered_points;
+  filtered_points.Reserve(points.size());
+
+  for (const auto &p : points) {
+    const PointMetadata *meta =
+        metadata->Find(p.point_id, p.is_virtual_point);
+    if (meta && !meta->log_enabled)
+      continue;
+
+    // bool이나 string 같은 상태성 데이터는 주기 상관없이 항상 저장
+    const bool stateful = std::holds_alternative<bool>(p.value) ||
+                          std::holds_alternative<std::string>(p.value);
+
+    // 롤업은 주기 필터 전의 모든 아날로그 샘플로 누적. 롤업 키는 point_id
+    // 뿐이라 ID가 겹칠 수 있는 가상포인트는 제외
+    double numeric = 0.0;
+    if (rollup_enabled && !stateful && !p.is_virtual_point &&
+        ToRollupValue(p.value, numeric))
+      rollup_engine_.Add(p.point_id, p.timestamp, numeric);
+
+    // 아날로그 데이터는 포인트 log_interval_ms (없으면 전역 주기) 체크
+    // (포인트 인덱스 배열, 해시/락 없음)
+    const int point_interval_ms =
+        meta && meta->log_interval_ms > 0
+            ? static_cast<int>(meta->log_interval_ms)
+            : interval_ms;
+    if (stateful || point_interval_ms <= 0 ||
+        ClaimSaveSlot(influx_last_save_ticks_, p.point_id, now,
+                      std::chrono::milliseconds(point_interval_ms))) {
+      filtered_points.Append(p);
+    }
+  }
+
+  if (filtered_points.Empty()) {
+    return false; // 저장할 포인트가 없으면 스킵
+  }
+
+  task.type = PersistenceTask::Type::INFLUX_SAVE;
+  task.message = CopyMessageHeader(message);
+  task.points = std::move(filtered_points);
+  return true;
+}
+
+void DataProcessingService::QueueRDBTask(
+    const Structs::DeviceDataMessage &message,
+    const std::vector<Structs::TimestampedValue> &points) {
+
+  PersistenceTask task;
+  if (!BuildRDBTask(message, points, task))
+    return;
 
   // Backpressure Protection: 큐가 가득 차면 데이터를 버림 (10,000개 제한)
+  auto &wal = PipelineManager::getInstance().GetWal();
+  const uint64_t lsn = message.wal_lsn;
+  wal.Retain(lsn);
   if (!persistence_queue_.try_push(std::move(task), 10000)) {
+    wal.Release(lsn, false);
     static std::atomic<int> drop_counter{0};
     int count = ++drop_counter;
     if (count % 100 == 1) {
@@ -854,55 +1393,17 @@ void DataProcessingService::QueueInfluxTask(
     const Structs::DeviceDataMessage &message,
     const std::vector<Structs::TimestampedValue> &points) {
 
-  int interval_ms = influxdb_storage_interval_ms_.load();
-  std::vector<Structs::TimestampedValue> filtered_points;
-
-  if (interval_ms <= 0) {
-    // 필터링 없이 모두 저장
-    filtered_points = points;
-  } else {
-    auto now = std::chrono::steady_clock::now();
-    std::lock_guard<std::mutex> lock(influxd_save_mutex_);
-
-    for (const auto &p : points) {
-      bool should_save = false;
-
-      // bool이나 string 같은 상태성 데이터는 주기 상관없이 항상 저장
-      if (std::holds_alternative<bool>(p.value) ||
-          std::holds_alternative<std::string>(p.value)) {
-        should_save = true;
-      } else {
-        // 아날로그 데이터의 경우 주기 체크
-        auto it = last_influxd_save_times_.find(p.point_id);
-        if (it == last_influxd_save_times_.end()) {
-          should_save = true;
-        } else {
-          auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-                             now - it->second)
-                             .count();
-          if (elapsed >= interval_ms) {
-            should_save = true;
-          }
-        }
-      }
-
-      if (should_save) {
-        filtered_points.push_back(p);
-        last_influxd_save_times_[p.point_id] = now;
-      }
-    }
-  }
-
-  if (filtered_points.empty()) {
-    return; // 저장할 포인트가 없으면 스킵
-  }
-
   PersistenceTask task;
-  task.type = PersistenceTask::Type::INFLUX_SAVE;
-  task.message = message;
-  task.points = filtered_points;
+  if (!BuildInfluxTask(message, points, std::chrono::steady_clock::now(),
+                       task))
+    return;
+
   // Backpressure Protection
+  auto &wal = PipelineManager::getInstance().GetWal();
+  const uint64_t lsn = message.wal_lsn;
+  wal.Retain(lsn);
   if (!persistence_queue_.try_push(std::move(task), 10000)) {
+    wal.Release(lsn, false);
     // ...logging logic remains...
     static std::atomic<int> drop_counter{0};
     int count = ++drop_counter;
@@ -919,12 +1420,118 @@ void DataProcessingService::QueueCommStatsTask(
     const Structs::DeviceDataMessage &message) {
   PersistenceTask task;
   task.type = PersistenceTask::Type::COMM_STATS_SAVE;
-  task.message = message;
+  task.message = CopyMessageHeader(message);
 
   // Backpressure Protection
+  auto &wal = PipelineManager::getInstance().GetWal();
+  const uint64_t lsn = message.wal_lsn;
+  wal.Retain(lsn);
   if (!persistence_queue_.try_push(std::move(task), 10000)) {
     // Comm stats are less critical, drop silently or verbose log
+    wal.Release(lsn, true);
+  }
+}
+
+void DataProcessingService::QueueBatch(
+    const std::vector<const Structs::DeviceDataMessage *> &messages) {
+  std::vector<PersistenceTask> tasks;
+  tasks.reserve(messages.size() * 2);
+
+  const auto now = std::chrono::steady_clock::now();
+  for (const auto *message : messages) {
+    PersistenceTask task;
+    if (BuildRDBTask(*message, message->points, task))
+      tasks.push_back(std::move(task));
+
+    PersistenceTask influx_task;
+    if (BuildInfluxTask(*message, message->points, now, influx_task))
+      tasks.push_back(std::move(influx_task));
+
+    PersistenceTask stats_task;
+    stats_task.type = PersistenceTask::Type::COMM_STATS_SAVE;
+    stats_task.message = CopyMessageHeader(*message);
+    tasks.push_back(std::move(stats_task));
+  }
+
+  if (tasks.empty())
+    return;
+
+  // 넣기 전에 참조를 잡아야 Persistence 스레드의 Release보다 앞섬
+  auto &wal = PipelineManager::getInstance().GetWal();
+  std::vector<uint64_t> lsns = CollectWalLsns(tasks);
+  wal.Retain(lsns);
+
+  // Backpressure Protection: 큐 잠금 한 번으로 넣을 수 있는 만큼 넣음
+  size_t pushed = persistence_queue_.try_push_batch(tasks, 10000);
+  if (pushed < tasks.size()) {
+    // 버린 RDB/Influx 태스크는 체크포인트를 붙잡아 재시작 시 재생
+    std::vector<uint64_t> dropped_data;
+    std::vector<uint64_t> dropped_stats;
+    for (size_t i = pushed; i < tasks.size(); ++i) {
+      const uint64_t lsn = tasks[i].message.wal_lsn;
+      if (tasks[i].type == PersistenceTask::Type::COMM_STATS_SAVE)
+        dropped_stats.push_back(lsn);
+      else
+        dropped_data.push_back(lsn);
+    }
+    wal.Release(dropped_data, false);
+    wal.Release(dropped_stats, true);
+
+    static std::atomic<int> drop_counter{0};
+    int count = drop_counter.fetch_add(static_cast<int>(tasks.size() - pushed)) + 1;
+    if (count % 100 == 1 || tasks.size() - pushed >= 100) {
+      LogManager::getInstance().log(
+          "processing", LogLevel::WARN,
+          "Persistence Queue FULL (10,000 items). Dropping " +
+              std::to_string(tasks.size() - pushed) +
+              " batched tasks! (Count: " + std::to_string(count) + ")");
+    }
+  }
+}
+
+void DataProcessingService::QueueWalRetries(
+    const std::vector<Structs::DeviceDataMessage> &messages) {
+  // 실시간 상태(알람/데드밴드/Redis/현재값)는 다음 샘플이 대신하고 누적
+  // (롤업/엣지 저장소/통신 통계)은 처음 처리 때 이미 반영됐으므로 다시 하면
+  // 중복/역행. 같은 시리즈+타임스탬프로 덮어써지는 Influx 이력만 다시 저장
+  auto &wal = PipelineManager::getInstance().GetWal();
+  std::vector<uint64_t> processing_lsns;
+  std::vector<PersistenceTask> tasks;
+  tasks.reserve(messages.size());
+  const auto metadata = PointMetadataRegistry::getInstance().GetSnapshot();
+  for (const auto &message : messages) {
+    if (message.wal_lsn != 0)
+      processing_lsns.push_back(message.wal_lsn);
+
+    PointBatch points;
+    points.Reserve(message.points.size());
+    for (const auto &p : message.points) {
+      const PointMetadata *meta =
+          metadata->Find(p.point_id, p.is_virtual_point);
+      if (meta && !meta->log_enabled)
+        continue;
+      points.Append(p);
+    }
+    if (points.Empty())
+      continue;
+
+    PersistenceTask task;
+    task.type = PersistenceTask::Type::INFLUX_SAVE;
+    task.message = CopyMessageHeader(message);
+    task.points = std::move(points);
+    tasks.push_back(std::move(task));
+  }
+
+  std::vector<uint64_t> task_lsns = CollectWalLsns(tasks);
+  wal.Retain(task_lsns);
+  const size_t pushed = persistence_queue_.try_push_batch(tasks, 10000);
+  if (pushed < tasks.size()) {
+    std::vector<uint64_t> dropped;
+    for (size_t i = pushed; i < tasks.size(); ++i)
+      dropped.push_back(tasks[i].message.wal_lsn);
+    wal.Release(dropped, false); // 다음 재시도 (시도 횟수는 WAL이 셈)
   }
+  wal.Release(processing_lsns, true);
 }
 
 // =============================================================================
@@ -1326,25 +1933,13 @@ void DataProcessingService::SaveChangedPointsToRDB(
     auto now_steady = std::chrono::steady_clock::now();
     std::vector<Structs::TimestampedValue> points_to_save;
 
-    {
-      // 🎯 저장 간격 필터링 (Digital: 상시, Analog: 5분 주기)
-      std::lock_guard<std::mutex> lock(rdb_save_mutex_);
-      for (const auto &point : changed_points) {
-        bool is_digital = std::holds_alternative<bool>(point.value);
+    // 🎯 저장 간격 필터링 (Digital: 상시, Analog: 5분 주기)
+    for (const auto &point : changed_points) {
+      bool is_digital = std::holds_alternative<bool>(point.value);
 
-        if (is_digital) {
-          points_to_save.push_back(point);
-        } else {
-          auto it = last_rdb_save_times_.find(point.point_id);
-          if (it == last_rdb_save_times_.end() ||
-              std::chrono::duration_cast<std::chrono::minutes>(now_steady -
-                                                               it->second)
-                      .count() >= 5) {
-
-            points_to_save.push_back(point);
-            last_rdb_save_times_[point.point_id] = now_steady;
-          }
-        }
+      if (is_digital || ClaimSaveSlot(rdb_last_save_ticks_, point.point_id,
+                                      now_steady, std::chrono::minutes(5))) {
+        points_to_save.push_back(point);
       }
     }
 
@@ -1356,8 +1951,8 @@ void DataProcessingService::SaveChangedPointsToRDB(
     if (is_running_.load()) {
       PersistenceTask task;
       task.type = PersistenceTask::Type::RDB_SAVE;
-      task.message = message;
-      task.points = std::move(points_to_save);
+      task.message = CopyMessageHeader(message);
+      task.points = PointBatch::FromLegacy(points_to_save);
       persistence_queue_.push(std::move(task));
     } else {
       // 서비스가 실행 중이 아니면 동기식으로 저장 (테스트용)
@@ -1395,7 +1990,8 @@ void DataProcessingService::SaveToInfluxDB(
     task.type = PersistenceTask::Type::INFLUX_SAVE;
     // 'message' is not available in this scope, assuming it's not needed for
     // this specific task type or should be derived. task.message = message;
-    task.points = batch; // Use 'batch' as 'changed_points' from the instruction
+    task.points = PointBatch::FromLegacy(
+        batch); // Use 'batch' as 'changed_points' from the instruction
     persistence_queue_.push(std::move(task));
   } else {
     // 서비스가 실행 중이 아니면 동기식으로 저장 (테스트용)
@@ -1421,8 +2017,8 @@ void DataProcessingService::BufferForInfluxDB(
   try {
     PersistenceTask task;
     task.type = PersistenceTask::Type::INFLUX_SAVE;
-    task.message = message;
-    task.points = ConvertToTimestampedValues(message);
+    task.message = CopyMessageHeader(message);
+    task.points = PointBatch::FromLegacy(ConvertToTimestampedValues(message));
 
     persistence_queue_.push(std::move(task));
 
@@ -1438,7 +2034,7 @@ void DataProcessingService::BufferCommStatsForInfluxDB(
   try {
     PersistenceTask task;
     task.type = PersistenceTask::Type::COMM_STATS_SAVE;
-    task.message = message;
+    task.message = CopyMessageHeader(message);
 
     persistence_queue_.push(std::move(task));
 
@@ -1594,9 +2190,15 @@ std::string DataProcessingService::ConvertToLightPointValue(
   light_point["point_id"] = value.point_id;
   light_point["device_id"] = device_id;
 
-  // 간단한 네이밍 (DB 조회 없이)
-  std::string point_name = getPointName(value.point_id); // 멤버 함수 호출
-  std::string device_name = "device_" + device_id;
+  // 메타데이터 스냅샷에서 이름/단위 조회 (DB 조회 없음)
+  const auto metadata = PointMetadataRegistry::getInstance().Find(
+      value.point_id, value.is_virtual_point);
+  std::string point_name = metadata && !metadata->name.empty()
+                               ? metadata->name
+                               : "point_" + std::to_string(value.point_id);
+  std::string device_name = metadata && !metadata->device_name.empty()
+                                ? metadata->device_name
+                                : "device_" + device_id;
   light_point["key"] = "device:" + device_id + ":" + point_name;
 
   light_point["device_name"] = device_name;
@@ -1646,8 +2248,7 @@ std::string DataProcessingService::ConvertToLightPointValue(
   light_point["quality"] =
       PulseOne::Utils::DataQualityToString(value.quality, true);
 
-  // 단위 (멤버 함수 사용)
-  light_point["unit"] = getUnit(value.point_id);
+  light_point["unit"] = metadata ? metadata->unit : std::string();
 
   // 값 변경 여부
   if (value.value_changed) {
@@ -1690,37 +2291,17 @@ std::string DataProcessingService::getDeviceIdForPoint(int point_id) {
 }
 
 // =============================================================================
-// ✅ 컴파일 에러 수정: getPointName, getUnit 멤버 함수 구현
+// 포인트 메타데이터 (PointMetadataRegistry 스냅샷)
 // =============================================================================
 
-std::string DataProcessingService::getPointName(int point_id) const {
-  // Backend realtime.js와 일치하는 포인트 이름들
-  std::unordered_map<int, std::string> point_names = {
-      {1, "temperature_sensor_01"},
-      {2, "pressure_sensor_01"},
-      {3, "flow_rate"},
-      {4, "pump_status"},
-      {5, "room_temperature"},
-      {6, "humidity_level"},
-      {7, "fan_speed"},
-      {8, "cooling_mode"},
-      {9, "voltage_l1"},
-      {10, "current_l1"},
-      {11, "power_total"},
-      {12, "energy_consumed"}};
-
-  auto it = point_names.find(point_id);
-  return (it != point_names.end()) ? it->second
-                                   : ("point_" + std::to_string(point_id));
+std::string DataProcessingService::getPointName(int point_id,
+                                               bool is_virtual) const {
+  return PointMetadataRegistry::getInstance().NameOf(point_id, is_virtual);
 }
 
-std::string DataProcessingService::getUnit(int point_id) const {
-  std::unordered_map<int, std::string> units = {
-      {1, "°C"},  {2, "bar"}, {3, "L/min"}, {4, ""},   {5, "°C"}, {6, "%"},
-      {7, "rpm"}, {8, ""},    {9, "V"},     {10, "A"}, {11, "W"}, {12, "kWh"}};
-
-  auto it = units.find(point_id);
-  return (it != units.end()) ? it->second : "";
+std::string DataProcessingService::getUnit(int point_id,
+                                           bool is_virtual) const {
+  return PointMetadataRegistry::getInstance().UnitOf(point_id, is_virtual);
 }
 
 // =============================================================================
@@ -1764,6 +2345,12 @@ DataProcessingService::GetStatistics() const {
   return stats;
 }
 
+Storage::InfluxWriterStats DataProcessingService::GetInfluxWriterStats() const {
+  if (!influx_writer_)
+    return Storage::InfluxWriterStats{};
+  return influx_writer_->GetStats();
+}
+
 PulseOne::Alarm::AlarmProcessingStats
 DataProcessingService::GetAlarmStatistics() const {
   PulseOne::Alarm::AlarmProcessingStats stats;
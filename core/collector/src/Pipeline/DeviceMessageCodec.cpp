@@ -0,0 +1,312 @@
+// =============================================================================
+// collector/src/Pipeline/DeviceMessageCodec.cpp - 메시지 바이너리 인코딩
+// =============================================================================
+
+#include "Pipeline/DeviceMessageCodec.h"
+
+#include <cstring>
+
+namespace PulseOne {
+namespace Pipeline {
+namespace DeviceMessageCodec {
+
+namespace {
+
+// 리틀 엔디언 고정 폭 + 길이 접두 문자열
+class RecordWriter {
+public:
+  explicit RecordWriter(std::string &out) : out_(out) {}
+
+  template <typename T> void Pod(T value) {
+    const char *p = reinterpret_cast<const char *>(&value);
+    out_.append(p, sizeof(T));
+  }
+  void U8(uint8_t v) { Pod(v); }
+  void U32(uint32_t v) { Pod(v); }
+  void I32(int32_t v) { Pod(v); }
+  void I64(int64_t v) { Pod(v); }
+  void F64(double v) { Pod(v); }
+  void Bool(bool v) { U8(v ? 1 : 0); }
+  void Str(const std::string &s) {
+    U32(static_cast<uint32_t>(s.size()));
+    out_.append(s);
+  }
+  void Time(const Structs::Timestamp &t) {
+    I64(std::chrono::duration_cast<std::chrono::microseconds>(
+            t.time_since_epoch())
+            .count());
+  }
+  void Value(const Structs::DataValue &value) {
+    U8(static_cast<uint8_t>(value.index()));
+    std::visit(
+        [this](const auto &v) {
+          using V = std::decay_t<decltype(v)>;
+          if constexpr (std::is_same_v<V, std::string>) {
+            Str(v);
+          } else if constexpr (std::is_same_v<V, bool>) {
+            Bool(v);
+          } else {
+            Pod(v);
+          }
+        },
+        value);
+  }
+
+private:
+  std::string &out_;
+};
+
+class RecordReader {
+public:
+  RecordReader(const uint8_t *data, size_t size) : data_(data), size_(size) {}
+
+  template <typename T> bool Pod(T &value) {
+    if (pos_ + sizeof(T) > size_)
+      return false;
+    std::memcpy(&value, data_ + pos_, sizeof(T));
+    pos_ += sizeof(T);
+    return true;
+  }
+  bool Bool(bool &v) {
+    uint8_t b = 0;
+    if (!Pod(b))
+      return false;
+    v = b != 0;
+    return true;
+  }
+  bool Str(std::string &s) {
+    uint32_t len = 0;
+    if (!Pod(len) || pos_ + len > size_)
+      return false;
+    s.assign(reinterpret_cast<const char *>(data_ + pos_), len);
+    pos_ += len;
+    return true;
+  }
+  bool Time(Structs::Timestamp &t) {
+    int64_t us = 0;
+    if (!Pod(us))
+      return false;
+    t = Structs::Timestamp(
+        std::chrono::duration_cast<Structs::Timestamp::duration>(
+            std::chrono::microseconds(us)));
+    return true;
+  }
+  template <typename E> bool Enum(E &e) {
+    std::underlying_type_t<E> raw{};
+    if (!Pod(raw))
+      return false;
+    e = static_cast<E>(raw);
+    return true;
+  }
+  bool Value(Structs::DataValue &value) {
+    uint8_t index = 0;
+    if (!Pod(index))
+      return false;
+    switch (index) {
+    case 0: {
+      bool v = false;
+      if (!Bool(v))
+        return false;
+      value = v;
+      return true;
+    }
+    case 1:
+      return PodValue<int16_t>(value);
+    case 2:
+      return PodValue<uint16_t>(value);
+    case 3:
+      return PodValue<int32_t>(value);
+    case 4:
+      return PodValue<uint32_t>(value);
+    case 5:
+      return PodValue<int64_t>(value);
+    case 6:
+      return PodValue<uint64_t>(value);
+    case 7:
+      return PodValue<float>(value);
+    case 8:
+      return PodValue<double>(value);
+    case 9: {
+      std::string v;
+      if (!Str(v))
+        return false;
+      value = std::move(v);
+      return true;
+    }
+    default:
+      return false;
+    }
+  }
+
+  bool AtEnd() const { return pos_ >= size_; }
+
+private:
+  template <typename T> bool PodValue(Structs::DataValue &value) {
+    T v{};
+    if (!Pod(v))
+      return false;
+    value = v;
+    return true;
+  }
+
+  const uint8_t *data_;
+  size_t size_;
+  size_t pos_ = 0;
+};
+
+static_assert(std::variant_size_v<Structs::DataValue> == 10,
+              "RecordReader::Value must match DataVariant alternatives");
+
+} // namespace
+
+uint32_t Checksum(const uint8_t *data, size_t size, uint32_t seed) {
+  uint32_t hash = seed;
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+void Encode(const Structs::DeviceDataMessage &m, uint8_t lane,
+            std::string &out) {
+  RecordWriter w(out);
+  w.U8(lane);
+  w.Str(m.type);
+  w.Str(m.device_id);
+  w.Str(m.protocol);
+  w.Str(m.device_type);
+  w.Time(m.timestamp);
+  w.U32(m.priority);
+  w.I32(m.tenant_id);
+  w.I32(m.site_id);
+  w.I32(m.edge_server_id);
+  w.Bool(m.trigger_alarms);
+  w.Bool(m.trigger_virtual_points);
+  w.Bool(m.high_priority);
+  w.Str(m.correlation_id);
+  w.Str(m.source_worker);
+  w.U32(m.batch_sequence);
+
+  w.U8(static_cast<uint8_t>(m.device_status));
+  w.U8(static_cast<uint8_t>(m.previous_status));
+  w.Bool(m.status_changed);
+  w.Bool(m.manual_status);
+  w.Str(m.status_message);
+  w.Time(m.status_changed_time);
+  w.Str(m.status_changed_by);
+  w.Bool(m.is_connected);
+  w.U32(m.consecutive_failures);
+  w.U32(m.total_failures);
+  w.U32(m.total_attempts);
+  w.I64(m.response_time.count());
+  w.Time(m.last_success_time);
+  w.Time(m.last_attempt_time);
+  w.Str(m.last_error_message);
+  w.I32(m.last_error_code);
+  w.U32(m.total_points_configured);
+  w.U32(m.successful_points);
+  w.U32(m.failed_points);
+
+  w.U32(static_cast<uint32_t>(m.points.size()));
+  for (const auto &p : m.points) {
+    w.Value(p.value);
+    w.Time(p.timestamp);
+    w.U8(static_cast<uint8_t>(p.quality));
+    w.Str(p.source);
+    w.I32(p.point_id);
+    w.Bool(p.is_virtual_point);
+    w.Value(p.previous_value);
+    w.Bool(p.value_changed);
+    w.F64(p.change_threshold);
+    w.Bool(p.force_rdb_store);
+    w.U32(p.sequence_number);
+    w.F64(p.raw_value);
+    w.F64(p.scaling_factor);
+    w.F64(p.scaling_offset);
+    w.U32(static_cast<uint32_t>(p.applicable_alarms.size()));
+    for (int id : p.applicable_alarms) {
+      w.I32(id);
+    }
+    w.Bool(p.suppress_alarms);
+    w.Bool(p.trigger_alarm_check);
+    // 대부분 비어 있으므로 빈 객체는 길이 0으로 기록
+    w.Str(p.metadata.empty() ? std::string() : p.metadata.dump());
+  }
+  // 끝에 덧붙인 필드 (없는 이전 레코드도 디코딩 가능)
+  w.Pod(m.wal_lsn);
+  w.Bool(m.wal_retry);
+}
+
+bool Decode(const uint8_t *data, size_t size, Structs::DeviceDataMessage &m,
+            uint8_t &lane) {
+  RecordReader r(data, size);
+  int64_t response_ms = 0;
+  uint32_t point_count = 0;
+
+  bool ok = r.Pod(lane) && r.Str(m.type) && r.Str(m.device_id) &&
+            r.Str(m.protocol) && r.Str(m.device_type) && r.Time(m.timestamp) &&
+            r.Pod(m.priority) && r.Pod(m.tenant_id) && r.Pod(m.site_id) &&
+            r.Pod(m.edge_server_id) && r.Bool(m.trigger_alarms) &&
+            r.Bool(m.trigger_virtual_points) && r.Bool(m.high_priority) &&
+            r.Str(m.correlation_id) && r.Str(m.source_worker) &&
+            r.Pod(m.batch_sequence) && r.Enum(m.device_status) &&
+            r.Enum(m.previous_status) && r.Bool(m.status_changed) &&
+            r.Bool(m.manual_status) && r.Str(m.status_message) &&
+            r.Time(m.status_changed_time) && r.Str(m.status_changed_by) &&
+            r.Bool(m.is_connected) && r.Pod(m.consecutive_failures) &&
+            r.Pod(m.total_failures) && r.Pod(m.total_attempts) &&
+            r.Pod(response_ms) && r.Time(m.last_success_time) &&
+            r.Time(m.last_attempt_time) && r.Str(m.last_error_message) &&
+            r.Pod(m.last_error_code) && r.Pod(m.total_points_configured) &&
+            r.Pod(m.successful_points) && r.Pod(m.failed_points) &&
+            r.Pod(point_count);
+  if (!ok || point_count > size) {
+    return false;
+  }
+  m.response_time = std::chrono::milliseconds(response_ms);
+
+  m.points.clear();
+  m.points.reserve(point_count);
+  for (uint32_t i = 0; i < point_count; ++i) {
+    Structs::TimestampedValue p;
+    uint32_t alarm_count = 0;
+    std::string metadata;
+    ok = r.Value(p.value) && r.Time(p.timestamp) && r.Enum(p.quality) &&
+         r.Str(p.source) && r.Pod(p.point_id) && r.Bool(p.is_virtual_point) &&
+         r.Value(p.previous_value) && r.Bool(p.value_changed) &&
+         r.Pod(p.change_threshold) && r.Bool(p.force_rdb_store) &&
+         r.Pod(p.sequence_number) && r.Pod(p.raw_value) &&
+         r.Pod(p.scaling_factor) && r.Pod(p.scaling_offset) &&
+         r.Pod(alarm_count);
+    if (!ok || alarm_count > size) {
+      return false;
+    }
+    p.applicable_alarms.resize(alarm_count);
+    for (uint32_t a = 0; a < alarm_count; ++a) {
+      if (!r.Pod(p.applicable_alarms[a]))
+        return false;
+    }
+    if (!r.Bool(p.suppress_alarms) || !r.Bool(p.trigger_alarm_check) ||
+        !r.Str(metadata)) {
+      return false;
+    }
+    if (!metadata.empty()) {
+      p.metadata = nlohmann::json::parse(metadata, nullptr, false);
+      if (p.metadata.is_discarded())
+        p.metadata = nlohmann::json::object();
+    }
+    m.points.push_back(std::move(p));
+  }
+  m.wal_lsn = 0;
+  if (!r.AtEnd() && !r.Pod(m.wal_lsn))
+    return false;
+  m.wal_retry = false;
+  if (!r.AtEnd() && !r.Bool(m.wal_retry))
+    return false;
+  return true;
+}
+
+} // namespace DeviceMessageCodec
+} // namespace Pipeline
+} // namespace PulseOne
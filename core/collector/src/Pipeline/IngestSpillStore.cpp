@@ -0,0 +1,456 @@
+// =============================================================================
+// collector/src/Pipeline/IngestSpillStore.cpp - 수집 큐 디스크 스필 구현
+// =============================================================================
+
+#include "Pipeline/IngestSpillStore.h"
+#include "Logging/LogManager.h"
+#include "Pipeline/DeviceMessageCodec.h"
+#include "Platform/PlatformCompat.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+#if !PULSEONE_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace PulseOne {
+namespace Pipeline {
+
+namespace {
+
+constexpr uint32_t SEGMENT_MAGIC = 0x4C505350; // "PSPL"
+constexpr uint32_t SEGMENT_VERSION = 1;
+constexpr uint64_t HEADER_SIZE = 64;
+constexpr uint64_t READ_OFFSET_POS = 16;
+constexpr uint64_t RECORD_HEADER_SIZE = 8; // 길이 u32 + 체크섬 u32
+constexpr uint64_t MIN_SEGMENT_BYTES = 64 * 1024;
+
+std::string SegmentFileName(uint64_t seq) {
+  char name[40];
+  std::snprintf(name, sizeof(name), "spill_%016llx.seg",
+                static_cast<unsigned long long>(seq));
+  return name;
+}
+
+} // namespace
+
+// =============================================================================
+// 🔥 mmap 세그먼트
+// =============================================================================
+
+struct IngestSpillStore::MappedSegment {
+  uint64_t seq = 0;
+  std::string path;
+  uint8_t *base = nullptr;
+  uint64_t size = 0;
+  std::atomic<uint64_t> write_offset{HEADER_SIZE};
+  uint64_t read_offset = HEADER_SIZE; // 재생 스레드만 접근
+#if PULSEONE_WINDOWS
+  HANDLE file = INVALID_HANDLE_VALUE;
+  HANDLE mapping = nullptr;
+#else
+  int fd = -1;
+#endif
+
+  ~MappedSegment() { Unmap(); }
+
+  bool Map(const std::string &file_path, uint64_t bytes, bool create) {
+    path = file_path;
+    size = bytes;
+#if PULSEONE_WINDOWS
+    file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+                       create ? CREATE_ALWAYS : OPEN_EXISTING,
+                       FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+      return false;
+    if (create) {
+      LARGE_INTEGER li;
+      li.QuadPart = static_cast<LONGLONG>(size);
+      if (!SetFilePointerEx(file, li, nullptr, FILE_BEGIN) ||
+          !SetEndOfFile(file))
+        return false;
+    }
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+    if (!mapping)
+      return false;
+    base = static_cast<uint8_t *>(
+        MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size));
+    return base != nullptr;
+#else
+    fd = ::open(path.c_str(), create ? (O_RDWR | O_CREAT | O_TRUNC) : O_RDWR,
+                0644);
+    if (fd < 0)
+      return false;
+    if (create && ::ftruncate(fd, static_cast<off_t>(size)) != 0)
+      return false;
+    void *p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED)
+      return false;
+    base = static_cast<uint8_t *>(p);
+    return true;
+#endif
+  }
+
+  void Flush() {
+    if (!base)
+      return;
+#if PULSEONE_WINDOWS
+    FlushViewOfFile(base, 0);
+#else
+    ::msync(base, size, MS_ASYNC);
+#endif
+  }
+
+  void Unmap() {
+#if PULSEONE_WINDOWS
+    if (base)
+      UnmapViewOfFile(base);
+    if (mapping)
+      CloseHandle(mapping);
+    if (file != INVALID_HANDLE_VALUE)
+      CloseHandle(file);
+    mapping = nullptr;
+    file = INVALID_HANDLE_VALUE;
+#else
+    if (base)
+      ::munmap(base, size);
+    if (fd >= 0)
+      ::close(fd);
+    fd = -1;
+#endif
+    base = nullptr;
+  }
+
+  void StoreReadOffset() {
+    std::memcpy(base + READ_OFFSET_POS, &read_offset, sizeof(read_offset));
+  }
+
+  uint64_t Free() const {
+    return size - write_offset.load(std::memory_order_relaxed);
+  }
+};
+
+IngestSpillStore::IngestSpillStore() = default;
+IngestSpillStore::~IngestSpillStore() { Close(); }
+
+uint64_t IngestSpillStore::MaxSegments() const {
+  return std::max<uint64_t>(max_bytes_ / segment_bytes_, 1);
+}
+
+std::unique_ptr<IngestSpillStore::MappedSegment>
+IngestSpillStore::CreateSegment(uint64_t seq) {
+  auto segment = std::make_unique<MappedSegment>();
+  segment->seq = seq;
+  std::string path =
+      (std::filesystem::path(directory_) / SegmentFileName(seq)).string();
+  if (!segment->Map(path, segment_bytes_, true)) {
+    LogManager::getInstance().Error("스필 세그먼트 생성 실패: {}", path);
+    return nullptr;
+  }
+
+  uint8_t *h = segment->base;
+  std::memset(h, 0, HEADER_SIZE);
+  std::memcpy(h, &SEGMENT_MAGIC, 4);
+  std::memcpy(h + 4, &SEGMENT_VERSION, 4);
+  std::memcpy(h + 8, &seq, 8);
+  segment->StoreReadOffset();
+  std::memcpy(h + 24, &segment_bytes_, 8);
+  return segment;
+}
+
+std::unique_ptr<IngestSpillStore::MappedSegment>
+IngestSpillStore::RecoverSegment(const std::string &path, uint64_t seq) {
+  std::error_code ec;
+  uint64_t file_size = std::filesystem::file_size(path, ec);
+  if (ec || file_size < HEADER_SIZE)
+    return nullptr;
+
+  auto segment = std::make_unique<MappedSegment>();
+  segment->seq = seq;
+  if (!segment->Map(path, file_size, false))
+    return nullptr;
+
+  uint32_t magic = 0, version = 0;
+  std::memcpy(&magic, segment->base, 4);
+  std::memcpy(&version, segment->base + 4, 4);
+  if (magic != SEGMENT_MAGIC || version != SEGMENT_VERSION)
+    return nullptr;
+
+  uint64_t read_offset = 0;
+  std::memcpy(&read_offset, segment->base + READ_OFFSET_POS, 8);
+
+  // 길이 0 또는 체크섬 불일치 지점이 기록 끝
+  uint64_t offset = HEADER_SIZE;
+  while (offset + RECORD_HEADER_SIZE <= file_size) {
+    uint32_t len = 0, checksum = 0;
+    std::memcpy(&len, segment->base + offset, 4);
+    std::memcpy(&checksum, segment->base + offset + 4, 4);
+    if (len == 0 || offset + RECORD_HEADER_SIZE + len > file_size ||
+        DeviceMessageCodec::Checksum(
+            segment->base + offset + RECORD_HEADER_SIZE, len) != checksum)
+      break;
+    offset += RECORD_HEADER_SIZE + len;
+  }
+
+  segment->write_offset.store(offset);
+  segment->read_offset =
+      std::min(std::max(read_offset, HEADER_SIZE), offset);
+  return segment;
+}
+
+bool IngestSpillStore::Open(const std::string &directory, uint64_t max_bytes,
+                            uint64_t segment_bytes) {
+  Close();
+
+  directory_ = directory;
+  segment_bytes_ = std::max(segment_bytes, MIN_SEGMENT_BYTES);
+  max_bytes_ = std::max(max_bytes, segment_bytes_);
+
+  std::error_code ec;
+  std::filesystem::create_directories(directory_, ec);
+  if (ec) {
+    LogManager::getInstance().Error("스필 디렉토리 생성 실패: {} ({})",
+                                    directory_, ec.message());
+    return false;
+  }
+
+  // 기존 세그먼트를 시퀀스 순으로 복구
+  std::vector<std::pair<uint64_t, std::string>> files;
+  for (const auto &entry :
+       std::filesystem::directory_iterator(directory_, ec)) {
+    const std::string name = entry.path().filename().string();
+    unsigned long long seq = 0;
+    if (std::sscanf(name.c_str(), "spill_%llx.seg", &seq) == 1) {
+      files.emplace_back(static_cast<uint64_t>(seq), entry.path().string());
+    }
+  }
+  std::sort(files.begin(), files.end());
+
+  size_t recovered = 0;
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  for (const auto &file : files) {
+    next_seq_ = std::max(next_seq_, file.first + 1);
+    auto segment = RecoverSegment(file.second, file.first);
+    if (!segment) {
+      LogManager::getInstance().Warn("손상된 스필 세그먼트 삭제: {}",
+                                     file.second);
+      std::filesystem::remove(file.second, ec);
+      continue;
+    }
+
+    size_t count = 0;
+    for (uint64_t off = segment->read_offset;
+         off < segment->write_offset.load();) {
+      uint32_t len = 0;
+      std::memcpy(&len, segment->base + off, 4);
+      off += RECORD_HEADER_SIZE + len;
+      ++count;
+    }
+    if (count == 0) {
+      segment->Unmap();
+      std::filesystem::remove(file.second, ec);
+      continue;
+    }
+    recovered += count;
+    segments_.push_back(std::move(segment));
+  }
+
+  // 복구된 세그먼트는 읽기 전용으로 두고 새 세그먼트에 이어서 기록
+  auto active = CreateSegment(next_seq_++);
+  if (!active) {
+    segments_.clear();
+    return false;
+  }
+  segments_.push_back(std::move(active));
+
+  pending_.store(recovered);
+  recovered_.store(recovered);
+  enabled_.store(true, std::memory_order_release);
+
+  LogManager::getInstance().Info(
+      "💾 수집 큐 스필 활성화: {} (한도 {}MB, 세그먼트 {}MB, 복구 {}개)",
+      directory_, max_bytes_ / (1024 * 1024), segment_bytes_ / (1024 * 1024),
+      recovered);
+  return true;
+}
+
+void IngestSpillStore::Close() {
+  std::lock_guard<std::mutex> replay_lock(replay_mutex_);
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  if (!enabled_.exchange(false))
+    return;
+
+  std::error_code ec;
+  for (auto &segment : segments_) {
+    segment->StoreReadOffset();
+    segment->Flush();
+    bool drained = segment->read_offset >= segment->write_offset.load();
+    std::string path = segment->path;
+    segment->Unmap();
+    if (drained) {
+      std::filesystem::remove(path, ec);
+    }
+  }
+  segments_.clear();
+  pending_.store(0);
+}
+
+bool IngestSpillStore::Append(const Structs::DeviceDataMessage &message,
+                              uint8_t lane) {
+  if (!IsEnabled())
+    return false;
+
+  // 인코딩은 락 밖에서
+  std::string payload;
+  payload.reserve(256 + message.points.size() * 96);
+  DeviceMessageCodec::Encode(message, lane, payload);
+  const uint64_t record_size = RECORD_HEADER_SIZE + payload.size();
+
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  if (!IsEnabled() || segments_.empty())
+    return false;
+
+  if (record_size > segment_bytes_ - HEADER_SIZE) {
+    rejected_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  MappedSegment *segment = segments_.back().get();
+  if (segment->Free() < record_size) {
+    if (segments_.size() >= MaxSegments()) {
+      rejected_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    segment->Flush();
+    auto next = CreateSegment(next_seq_++);
+    if (!next) {
+      rejected_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    segment = next.get();
+    segments_.push_back(std::move(next));
+  }
+
+  // 본문 → 체크섬 → 길이 순으로 기록 (길이가 0이 아니면 완성된 레코드)
+  const uint64_t offset = segment->write_offset.load(std::memory_order_relaxed);
+  uint8_t *dst = segment->base + offset;
+  const uint32_t len = static_cast<uint32_t>(payload.size());
+  const uint32_t checksum = DeviceMessageCodec::Checksum(
+      reinterpret_cast<const uint8_t *>(payload.data()), payload.size());
+  std::memcpy(dst + RECORD_HEADER_SIZE, payload.data(), payload.size());
+  std::memcpy(dst + 4, &checksum, 4);
+  std::memcpy(dst, &len, 4);
+  segment->write_offset.store(offset + record_size, std::memory_order_release);
+
+  pending_.fetch_add(1, std::memory_order_release);
+  spilled_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void IngestSpillStore::RetireFrontSegment() {
+  std::unique_ptr<MappedSegment> retired;
+  {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    retired = std::move(segments_.front());
+    segments_.pop_front();
+  }
+  std::string path = retired->path;
+  retired->Unmap();
+  std::error_code ec;
+  std::filesystem::remove(path, ec);
+}
+
+size_t IngestSpillStore::Replay(const ReplaySink &sink, size_t max_items) {
+  if (!HasPending() || max_items == 0)
+    return 0;
+
+  std::unique_lock<std::mutex> replay_lock(replay_mutex_, std::try_to_lock);
+  if (!replay_lock.owns_lock() || !IsEnabled())
+    return 0;
+
+  size_t replayed = 0;
+  while (replayed < max_items) {
+    MappedSegment *segment = nullptr;
+    bool sealed = false;
+    {
+      std::lock_guard<std::mutex> lock(write_mutex_);
+      if (segments_.empty())
+        break;
+      segment = segments_.front().get();
+      sealed = segments_.size() > 1; // 뒤에 세그먼트가 있으면 기록 종료됨
+    }
+
+    const uint64_t end = segment->write_offset.load(std::memory_order_acquire);
+    bool sink_full = false;
+    while (replayed < max_items && segment->read_offset < end) {
+      const uint8_t *rec = segment->base + segment->read_offset;
+      uint32_t len = 0, checksum = 0;
+      std::memcpy(&len, rec, 4);
+      std::memcpy(&checksum, rec + 4, 4);
+      const uint64_t next = segment->read_offset + RECORD_HEADER_SIZE + len;
+
+      Structs::DeviceDataMessage message;
+      uint8_t lane = 0;
+      if (DeviceMessageCodec::Checksum(rec + RECORD_HEADER_SIZE, len) !=
+              checksum ||
+          !DeviceMessageCodec::Decode(rec + RECORD_HEADER_SIZE, len, message,
+                                      lane)) {
+        corrupt_.fetch_add(1, std::memory_order_relaxed);
+        segment->read_offset = next;
+        pending_.fetch_sub(1);
+        continue;
+      }
+      if (!sink(std::move(message), lane)) {
+        sink_full = true;
+        break;
+      }
+      segment->read_offset = next;
+      pending_.fetch_sub(1);
+      ++replayed;
+    }
+    segment->StoreReadOffset();
+
+    if (sink_full || segment->read_offset < end || !sealed)
+      break;
+    RetireFrontSegment();
+  }
+
+  replayed_.fetch_add(replayed, std::memory_order_relaxed);
+  return replayed;
+}
+
+IngestSpillStats IngestSpillStore::GetStats() const {
+  IngestSpillStats stats;
+  stats.enabled = IsEnabled();
+  stats.spilled = spilled_.load();
+  stats.replayed = replayed_.load();
+  stats.rejected = rejected_.load();
+  stats.recovered = recovered_.load();
+  stats.corrupt = corrupt_.load();
+  stats.pending = pending_.load();
+  stats.max_bytes = max_bytes_;
+  {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    stats.segments = segments_.size();
+    for (const auto &segment : segments_) {
+      stats.bytes_on_disk += segment->size;
+    }
+  }
+  return stats;
+}
+
+void IngestSpillStore::ResetStats() {
+  spilled_ = 0;
+  replayed_ = 0;
+  rejected_ = 0;
+  recovered_ = 0;
+  corrupt_ = 0;
+}
+
+} // namespace Pipeline
+} // namespace PulseOne
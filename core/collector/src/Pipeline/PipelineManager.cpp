@@ -4,8 +4,11 @@
 
 #include "Pipeline/PipelineManager.h"
 #include "Logging/LogManager.h"
+#include "Utils/ConfigManager.h"
 #include <iostream>
 #include <chrono>
+#include <thread>
+#include <algorithm>
 
 namespace PulseOne {
 namespace Pipeline {
@@ -19,14 +22,57 @@ PipelineManager& PipelineManager::getInstance() {
     return instance;
 }
 
+PipelineManager::PipelineManager()
+    : ingest_queue_(MAX_QUEUE_SIZE, INGEST_SHARD_COUNT, LANE_COUNT) {
+    // 일반 폴링 데이터는 임계점까지만 허용 → 나머지 10%는 긴급/이벤트 데이터 전용
+    ingest_queue_.ConfigureLane(static_cast<size_t>(Lane::URGENT), 16, MAX_QUEUE_SIZE);
+    ingest_queue_.ConfigureLane(static_cast<size_t>(Lane::HIGH), 4, MAX_QUEUE_SIZE);
+    ingest_queue_.ConfigureLane(static_cast<size_t>(Lane::NORMAL), 1, OVERFLOW_THRESHOLD);
+    ingest_queue_.SetDequeuePolicy(LaneDequeuePolicy::WEIGHTED);
+
+    // 레인별 큐 체류 시간 분포 (/metrics, /api/system/stats)
+    for (Lane lane : {Lane::URGENT, Lane::HIGH, Lane::NORMAL}) {
+        ingest_queue_.SetLaneWaitHistogram(
+            static_cast<size_t>(lane),
+            &PipelineMetrics::getInstance().Get(PipelineMetrics::QUEUE_WAIT, LaneName(lane)));
+    }
+}
+
+PipelineManager::Lane PipelineManager::LaneFor(const Structs::DeviceDataMessage& message) {
+    if (message.high_priority) {
+        return Lane::URGENT;
+    }
+    if (message.priority > 0) {
+        return Lane::HIGH;
+    }
+    return Lane::NORMAL;
+}
+
+const char* PipelineManager::LaneName(Lane lane) {
+    switch (lane) {
+        case Lane::URGENT: return "urgent";
+        case Lane::HIGH:   return "high";
+        case Lane::NORMAL: return "normal";
+    }
+    return "unknown";
+}
+
 void PipelineManager::Start() {
     if (is_running_.load()) {
         LogManager::getInstance().Warn("⚠️ PipelineManager already running");
         return;
     }
     
+    ingest_queue_.Open();
+    OpenSpillStore();
+    auto wal_options = PipelineWalOptions::FromConfig();
+    if (wal_options.enabled && !wal_.Open(wal_options)) {
+        LogManager::getInstance().Warn("⚠️ 파이프라인 WAL 비활성화 (열기 실패): {}",
+                                       wal_options.directory);
+    }
     is_running_ = true;
-    LogManager::getInstance().Info("✅ PipelineManager 큐 시스템 시작됨 (Instance: " + std::to_string((uintptr_t)this) + ")");
+    LogManager::getInstance().Info("✅ PipelineManager 큐 시스템 시작됨 (Instance: " + std::to_string((uintptr_t)this) +
+                                   ", Shards: " + std::to_string(ingest_queue_.ShardCount()) + ")");
 }
 
 void PipelineManager::Shutdown() {
@@ -37,21 +83,34 @@ void PipelineManager::Shutdown() {
     LogManager::getInstance().Info("🛑 PipelineManager 큐 시스템 종료 시작...");
     
     is_running_ = false;
-    queue_cv_.notify_all(); // 대기 중인 모든 스레드 깨우기
+    ingest_queue_.Close(); // 대기 중인 모든 스레드 깨우기
     
-    // 남은 데이터 정리
-    {
-        std::lock_guard<std::mutex> lock(queue_mutex_);
-        size_t remaining = data_queue_.size();
-        if (remaining > 0) {
-            LogManager::getInstance().Warn("⚠️ 큐에 {}개 미처리 데이터 남음", remaining);
+    // 스필이 켜져 있으면 남은 데이터를 디스크에 보관 → 다음 시작 시 재생
+    // (이미 스필된 레코드 뒤에 붙으므로 종료 경계에서는 순서가 바뀔 수 있음)
+    // WAL이 켜져 있으면 남은 데이터는 이미 WAL에 있으므로 재시작 시 WAL에서 재생
+    if (spill_store_.IsEnabled() && !wal_.IsEnabled()) {
+        std::vector<Structs::DeviceDataMessage> rest;
+        size_t saved = 0;
+        // 친화 설정은 유지 (같은 프로세스에서 다시 Start해도 그대로 적용)
+        while (ingest_queue_.DrainAll(rest, 1000) > 0) {
+            for (const auto& message : rest) {
+                if (spill_store_.Append(message, static_cast<uint8_t>(LaneFor(message)))) {
+                    ++saved;
+                }
+            }
+            rest.clear();
         }
-        
-        // 큐 비우기
-        while (!data_queue_.empty()) {
-            data_queue_.pop();
+        if (saved > 0) {
+            LogManager::getInstance().Info("💾 미처리 데이터 {}개 디스크 스필에 보관", saved);
         }
     }
+    spill_store_.Close();
+    
+    // 남은 데이터 정리
+    size_t remaining = ingest_queue_.Clear();
+    if (remaining > 0) {
+        LogManager::getInstance().Warn("⚠️ 큐에 {}개 미처리 데이터 남음", remaining);
+    }
     
     LogManager::getInstance().Info("✅ PipelineManager 큐 시스템 종료 완료");
 }
@@ -62,24 +121,48 @@ bool PipelineManager::PushMessage(const Structs::DeviceDataMessage& message) {
     }
     
     try {
-        // 🔥 큐에 직접 추가 (오버플로우 체크)
-        {
-            std::lock_guard<std::mutex> lock(queue_mutex_);
-            
-            // 오버플로우 체크
-            if (data_queue_.size() >= MAX_QUEUE_SIZE) {
-                total_dropped_.fetch_add(1);
-                LogManager::getInstance().Warn("❌ 큐 오버플로우! 데이터 드롭: {} (포인트: {}개)", 
-                                             message.device_id, message.points.size());
-                return false;
-            }
-            
-            // 큐에 추가 (복사 or 이동)
-            data_queue_.push(message);
+        Structs::DeviceDataMessage copy = message;
+        return PushMessage(std::move(copy));
+    } catch (const std::exception& e) {
+        LogManager::getInstance().Error("PushMessage 예외: {}", e.what());
+        return false;
+    }
+}
+
+bool PipelineManager::PushMessage(Structs::DeviceDataMessage&& message) {
+    if (!is_running_.load() || message.points.empty()) {
+        return false;
+    }
+    
+    try {
+        // 🔥 락프리 샤드 큐에 이동 (오버플로우 시 message 보존)
+        Lane lane = LaneFor(message);
+        
+        // 수락 전에 WAL에 기록 (fsync 정책에 따라 그룹 커밋 대기)
+        if (wal_.IsEnabled()) {
+            message.wal_lsn = wal_.Append(message, static_cast<uint8_t>(lane));
         }
         
-        // 대기 중인 처리기 깨우기
-        queue_cv_.notify_one();
+        // 스필 재생 중에는 일반 데이터를 디스크 뒤에 붙여 순서 유지
+        if (lane == Lane::NORMAL && spill_store_.HasPending() &&
+            spill_store_.Append(message, static_cast<uint8_t>(lane))) {
+            total_received_.fetch_add(1);
+            return true;
+        }
+        
+        if (!ingest_queue_.Push(std::move(message), static_cast<size_t>(lane))) {
+            // 큐 포화 → 디스크 스필 (비활성/한도 초과면 드롭)
+            if (spill_store_.Append(message, static_cast<uint8_t>(lane))) {
+                total_received_.fetch_add(1);
+                return true;
+            }
+            // 수락하지 않은 메시지는 추적 해제 (호출자가 실패를 받음)
+            wal_.Release(message.wal_lsn, true);
+            total_dropped_.fetch_add(1);
+            LogManager::getInstance().Warn("❌ 큐 오버플로우! 데이터 드롭: {} (포인트: {}개, 레인: {})", 
+                                         message.device_id, message.points.size(), LaneName(lane));
+            return false;
+        }
         
         // 통계 업데이트
         total_received_.fetch_add(1);
@@ -87,7 +170,7 @@ bool PipelineManager::PushMessage(const Structs::DeviceDataMessage& message) {
         return true;
         
     } catch (const std::exception& e) {
-        LogManager::getInstance().Error("SendDeviceData 예외: {}", e.what());
+        LogManager::getInstance().Error("PushMessage 예외: {}", e.what());
         return false;
     }
 }
@@ -108,91 +191,192 @@ bool PipelineManager::SendDeviceData(
     message.protocol = "AUTO_DETECTED";  // Worker에서 설정 가능
     message.points = values;              // 🔥 기존 points 필드 사용!
     message.priority = priority;
+    message.source_worker = worker_id;
     message.timestamp = std::chrono::system_clock::now();
     
-    // 🔥 큐에 추가 (오버플로우 체크)
-    {
-        std::lock_guard<std::mutex> lock(queue_mutex_);
-        
-        // 오버플로우 체크
-        if (data_queue_.size() >= MAX_QUEUE_SIZE) {
-            LogManager::getInstance().Warn("❌ 큐 오버플로우! 데이터 드롭: {} (Worker: {})", 
-                                         device_id, worker_id);
-            return false;
-        }
-        
-        // 큐에 추가
-        data_queue_.push(std::move(message));
-        LogManager::getInstance().Info("PipelineManager::SendDeviceData pushed (Instance: " + std::to_string((uintptr_t)this) + "), QSize: " + std::to_string(data_queue_.size()));
-    }
-    
-    // 대기 중인 처리기 깨우기
-    queue_cv_.notify_one();
-    
-    // 통계 업데이트
-    total_received_.fetch_add(1);
-    
-    return true;
+    return PushMessage(std::move(message));
 }
 
 std::vector<Structs::DeviceDataMessage> PipelineManager::GetBatch(
     size_t max_batch_size,
     uint32_t timeout_ms) {
+    return GetBatchForConsumer(0, max_batch_size, timeout_ms);
+}
+
+std::vector<Structs::DeviceDataMessage> PipelineManager::GetBatchForConsumer(
+    size_t consumer_index,
+    size_t max_batch_size,
+    uint32_t timeout_ms) {
     
     std::vector<Structs::DeviceDataMessage> batch;
+    if (!is_running_.load()) {
+        return batch;
+    }
     batch.reserve(max_batch_size);
     
-    std::unique_lock<std::mutex> lock(queue_mutex_);
-    
-    // LogManager::getInstance().Info("PipelineManager::GetBatch waiting (Instance: " + std::to_string((uintptr_t)this) + ")");
-
-    // 타임아웃 또는 데이터 있을 때까지 대기
-    auto timeout = std::chrono::milliseconds(timeout_ms);
-    bool has_data = queue_cv_.wait_for(lock, timeout, [this] {
-        return !data_queue_.empty() || !is_running_.load();
-    });
-    
-    if (!has_data || !is_running_.load()) {
-        return batch; // 빈 배치 반환
+    // 처리 스레드가 따라잡았으면 이전 실행의 WAL → 스필 순으로 큐에 되돌림
+    if ((wal_.HasReplay() || spill_store_.HasPending()) &&
+        ingest_queue_.LaneSize(static_cast<size_t>(Lane::NORMAL)) < SPILL_REPLAY_LOW_WATER) {
+        if (wal_.HasReplay()) {
+            ReplayWal();
+        } else {
+            ReplaySpill();
+        }
     }
-    
-    // 배치 크기만큼 수집
-    while (!data_queue_.empty() && batch.size() < max_batch_size) {
-        batch.push_back(std::move(data_queue_.front()));
-        data_queue_.pop();
+    // 저장에 실패한 메시지는 WAL에서 다시 읽어 재투입 (재시도 주기는 WAL이 제한)
+    if (wal_.HasRetry() &&
+        ingest_queue_.LaneSize(static_cast<size_t>(Lane::NORMAL)) < SPILL_REPLAY_LOW_WATER) {
+        RetryWal();
     }
+    wal_.Maintain();
+    
+    // 데이터가 없으면 timeout 동안 블로킹 대기 (sleep 폴링 없음)
+    size_t taken = ingest_queue_.PopBatchFor(consumer_index, batch, max_batch_size,
+                                             std::chrono::milliseconds(timeout_ms));
     
     // 통계 업데이트
-    total_delivered_.fetch_add(batch.size());
+    if (taken > 0) {
+        total_delivered_.fetch_add(taken);
+    }
     
     return batch;
 }
 
 bool PipelineManager::IsEmpty() const {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
-    return data_queue_.empty();
+    return ingest_queue_.Size() == 0;
 }
 
 size_t PipelineManager::GetQueueSize() const {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
-    return data_queue_.size();
+    return ingest_queue_.Size();
 }
 
 bool PipelineManager::IsOverflowing() const {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
-    return data_queue_.size() >= OVERFLOW_THRESHOLD;
+    return ingest_queue_.Size() >= OVERFLOW_THRESHOLD;
 }
 
-PipelineManager::QueueStats PipelineManager::GetStatistics() const {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
+void PipelineManager::OpenSpillStore() {
+    auto& config = ConfigManager::getInstance();
+    if (!config.getBool("PIPELINE_SPILL_ENABLED", false)) {
+        return;
+    }
+    
+    std::string dir = config.getOrDefault("PIPELINE_SPILL_DIR", "");
+    if (dir.empty()) {
+        dir = config.getDataDirectory() + "/spill";
+    }
+    uint64_t max_mb = static_cast<uint64_t>(std::max(config.getInt("PIPELINE_SPILL_MAX_MB", 256), 1));
+    uint64_t segment_mb = static_cast<uint64_t>(std::max(config.getInt("PIPELINE_SPILL_SEGMENT_MB", 8), 1));
     
+    if (!spill_store_.Open(dir, max_mb * 1024 * 1024, segment_mb * 1024 * 1024)) {
+        LogManager::getInstance().Warn("⚠️ 디스크 스필 비활성화 (열기 실패): {}", dir);
+    }
+}
+
+void PipelineManager::ReplaySpill() {
+    const bool wal_enabled = wal_.IsEnabled();
+    const uint64_t session_start = wal_.SessionStartLsn();
+    size_t replayed = spill_store_.Replay(
+        [this, wal_enabled, session_start](Structs::DeviceDataMessage&& message, uint8_t lane) {
+            // 이전 실행에서 WAL에 기록된 메시지는 WAL 재생이 이미 넘김 (중복 방지)
+            if (wal_enabled && message.wal_lsn != 0 && message.wal_lsn < session_start) {
+                return true;
+            }
+            return ingest_queue_.Push(std::move(message), lane);
+        },
+        SPILL_REPLAY_BATCH);
+    
+    if (replayed > 0 && !spill_store_.HasPending()) {
+        LogManager::getInstance().Info("💾 디스크 스필 재생 완료 (누적 {}개)",
+                                       spill_store_.GetStats().replayed);
+    }
+}
+
+void PipelineManager::ReplayWal() {
+    size_t replayed = wal_.Replay(
+        [this](Structs::DeviceDataMessage&& message, uint8_t lane) {
+            return ingest_queue_.Push(std::move(message), lane);
+        },
+        SPILL_REPLAY_BATCH);
+    
+    if (replayed > 0) {
+        total_received_.fetch_add(replayed);
+    }
+}
+
+void PipelineManager::RetryWal() {
+    size_t retried = wal_.Retry(
+        [this](Structs::DeviceDataMessage&& message, uint8_t lane) {
+            return ingest_queue_.Push(std::move(message), lane);
+        },
+        SPILL_REPLAY_BATCH);
+    
+    if (retried > 0) {
+        LogManager::getInstance().Info("📝 저장 실패 메시지 {}개 WAL에서 재투입", retried);
+    }
+}
+
+PipelineManager::CongestionLevel PipelineManager::GetCongestionLevel() const {
+    size_t normal_depth = ingest_queue_.LaneSize(static_cast<size_t>(Lane::NORMAL));
+    double fill = static_cast<double>(normal_depth) / OVERFLOW_THRESHOLD;
+    if (fill >= 0.9) {
+        return CongestionLevel::CRITICAL;
+    }
+    if (fill >= 0.75) {
+        return CongestionLevel::HIGH;
+    }
+    if (fill >= 0.5) {
+        return CongestionLevel::ELEVATED;
+    }
+    return CongestionLevel::NONE;
+}
+
+const char* PipelineManager::CongestionLevelName(CongestionLevel level) {
+    switch (level) {
+        case CongestionLevel::NONE:     return "none";
+        case CongestionLevel::ELEVATED: return "elevated";
+        case CongestionLevel::HIGH:     return "high";
+        case CongestionLevel::CRITICAL: return "critical";
+    }
+    return "unknown";
+}
+
+uint32_t PipelineManager::GetBackoffMultiplier() const {
+    return 1u << static_cast<uint32_t>(GetCongestionLevel());
+}
+
+bool PipelineManager::WaitForCapacity(std::chrono::milliseconds max_wait) const {
+    // 처리 스레드가 큐를 비우는 동안 짧게 나눠서 재확인
+    constexpr auto slice = std::chrono::milliseconds(20);
+    auto deadline = std::chrono::steady_clock::now() + max_wait;
+    
+    while (is_running_.load() && GetCongestionLevel() >= CongestionLevel::HIGH) {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            return false;
+        }
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now);
+        std::this_thread::sleep_for(std::min(slice, remaining));
+    }
+    return true;
+}
+
+PipelineManager::QueueStats PipelineManager::GetStatistics() const {
     QueueStats stats;
+    size_t current = ingest_queue_.Size();
     stats.total_received = total_received_.load();
     stats.total_delivered = total_delivered_.load();
     stats.total_dropped = total_dropped_.load();
-    stats.current_queue_size = data_queue_.size();
+    stats.current_queue_size = current;
     stats.max_queue_size = MAX_QUEUE_SIZE;
-    stats.fill_percentage = (static_cast<double>(data_queue_.size()) / MAX_QUEUE_SIZE) * 100.0;
+    stats.fill_percentage = (static_cast<double>(current) / MAX_QUEUE_SIZE) * 100.0;
+    
+    stats.lanes.reserve(LANE_COUNT);
+    for (size_t i = 0; i < LANE_COUNT; ++i) {
+        stats.lanes.push_back(ingest_queue_.GetLaneStats(i));
+    }
+    stats.congestion_level = GetCongestionLevel();
+    stats.spill = spill_store_.GetStats();
+    stats.wal = wal_.GetStats();
     
     return stats;
 }
@@ -201,6 +385,8 @@ void PipelineManager::ResetStatistics() {
     total_received_ = 0;
     total_delivered_ = 0;
     total_dropped_ = 0;
+    ingest_queue_.ResetLaneStats();
+    spill_store_.ResetStats();
     
     LogManager::getInstance().Info("📊 PipelineManager 통계 리셋됨");
 }
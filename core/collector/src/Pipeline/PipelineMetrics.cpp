@@ -0,0 +1,224 @@
+// =============================================================================
+// collector/src/Pipeline/PipelineMetrics.cpp - 파이프라인 지연 히스토그램
+// =============================================================================
+
+#include "Pipeline/PipelineMetrics.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+
+namespace PulseOne {
+namespace Pipeline {
+
+namespace {
+
+size_t FloorLog2(uint64_t value) {
+  size_t e = 0;
+  while (value >>= 1) {
+    ++e;
+  }
+  return e;
+}
+
+// Prometheus 누적 버킷 경계 (초)
+constexpr double PROMETHEUS_BOUNDS_S[] = {
+    0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05,
+    0.1,    0.25,    0.5,    1.0,   2.5,    5.0,   10.0, 30.0,  60.0};
+
+std::string EscapeLabel(const std::string &value) {
+  std::string out;
+  out.reserve(value.size());
+  for (char c : value) {
+    if (c == '\\' || c == '"') {
+      out += '\\';
+      out += c;
+    } else if (c == '\n') {
+      out += "\\n";
+    } else {
+      out += c;
+    }
+  }
+  return out;
+}
+
+double ToMillis(uint64_t micros) { return static_cast<double>(micros) / 1000.0; }
+
+} // namespace
+
+// =============================================================================
+// LatencyHistogram
+// =============================================================================
+
+size_t LatencyHistogram::BucketIndex(uint64_t micros) {
+  if (micros < SUB_BUCKETS)
+    return static_cast<size_t>(micros);
+
+  size_t exponent = FloorLog2(micros);
+  if (exponent >= MAX_EXPONENT)
+    return BUCKET_COUNT - 1;
+
+  const size_t shift = exponent - SUB_BUCKET_BITS;
+  const size_t sub = static_cast<size_t>(micros >> shift) - SUB_BUCKETS;
+  return SUB_BUCKETS + (exponent - SUB_BUCKET_BITS) * SUB_BUCKETS + sub;
+}
+
+uint64_t LatencyHistogram::BucketUpperBound(size_t index) {
+  if (index < SUB_BUCKETS)
+    return index;
+
+  const size_t k = index - SUB_BUCKETS;
+  const size_t shift = k / SUB_BUCKETS;
+  const uint64_t lower = static_cast<uint64_t>(SUB_BUCKETS + k % SUB_BUCKETS)
+                         << shift;
+  return lower + (uint64_t(1) << shift) - 1;
+}
+
+void LatencyHistogram::Record(uint64_t micros) {
+  buckets_[BucketIndex(micros)].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  sum_us_.fetch_add(micros, std::memory_order_relaxed);
+
+  uint64_t prev = max_us_.load(std::memory_order_relaxed);
+  while (micros > prev &&
+         !max_us_.compare_exchange_weak(prev, micros,
+                                        std::memory_order_relaxed)) {
+  }
+}
+
+uint64_t LatencyHistogram::ValueAtPercentile(double percentile) const {
+  const uint64_t total = Count();
+  if (total == 0)
+    return 0;
+
+  percentile = std::min(100.0, std::max(0.0, percentile));
+  uint64_t target = static_cast<uint64_t>(
+      std::ceil(percentile / 100.0 * static_cast<double>(total)));
+  if (target == 0)
+    target = 1;
+
+  const uint64_t max_us = max_us_.load(std::memory_order_relaxed);
+  uint64_t seen = 0;
+  for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+    seen += buckets_[i].load(std::memory_order_relaxed);
+    if (seen >= target)
+      return std::min(BucketUpperBound(i), max_us);
+  }
+  return max_us;
+}
+
+uint64_t LatencyHistogram::CountAtOrBelow(uint64_t micros) const {
+  uint64_t seen = 0;
+  for (size_t i = 0; i < BUCKET_COUNT && BucketUpperBound(i) <= micros; ++i) {
+    seen += buckets_[i].load(std::memory_order_relaxed);
+  }
+  return seen;
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::TakeSnapshot() const {
+  Snapshot snapshot;
+  snapshot.count = Count();
+  snapshot.sum_us = sum_us_.load(std::memory_order_relaxed);
+  snapshot.max_us = max_us_.load(std::memory_order_relaxed);
+  snapshot.p50_us = ValueAtPercentile(50.0);
+  snapshot.p90_us = ValueAtPercentile(90.0);
+  snapshot.p99_us = ValueAtPercentile(99.0);
+  snapshot.p999_us = ValueAtPercentile(99.9);
+  return snapshot;
+}
+
+void LatencyHistogram::Reset() {
+  for (auto &bucket : buckets_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+  count_ = 0;
+  sum_us_ = 0;
+  max_us_ = 0;
+}
+
+// =============================================================================
+// PipelineMetrics
+// =============================================================================
+
+PipelineMetrics &PipelineMetrics::getInstance() {
+  static PipelineMetrics instance;
+  return instance;
+}
+
+LatencyHistogram &PipelineMetrics::Get(const std::string &kind,
+                                       const std::string &name) {
+  Key key(kind, name);
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = histograms_.find(key);
+    if (it != histograms_.end())
+      return *it->second;
+  }
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  auto &slot = histograms_[key];
+  if (!slot)
+    slot = std::make_unique<LatencyHistogram>();
+  return *slot;
+}
+
+nlohmann::json PipelineMetrics::ToJson() const {
+  nlohmann::json result = nlohmann::json::object();
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  for (const auto &[key, histogram] : histograms_) {
+    auto snapshot = histogram->TakeSnapshot();
+    nlohmann::json entry;
+    entry["count"] = snapshot.count;
+    entry["avg_ms"] = snapshot.count > 0
+                          ? ToMillis(snapshot.sum_us) / snapshot.count
+                          : 0.0;
+    entry["p50_ms"] = ToMillis(snapshot.p50_us);
+    entry["p90_ms"] = ToMillis(snapshot.p90_us);
+    entry["p99_ms"] = ToMillis(snapshot.p99_us);
+    entry["p999_ms"] = ToMillis(snapshot.p999_us);
+    entry["max_ms"] = ToMillis(snapshot.max_us);
+    result[key.first][key.second] = entry;
+  }
+  return result;
+}
+
+std::string PipelineMetrics::ToPrometheus() const {
+  std::ostringstream out;
+  out << std::setprecision(10);
+  out << "# HELP pulseone_pipeline_latency_seconds Collector pipeline latency "
+         "by kind (driver_read, queue_wait, stage, end_to_end, redis_write, "
+         "influx_flush) and name.\n";
+  out << "# TYPE pulseone_pipeline_latency_seconds histogram\n";
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  for (const auto &[key, histogram] : histograms_) {
+    const std::string labels = "kind=\"" + EscapeLabel(key.first) +
+                               "\",name=\"" + EscapeLabel(key.second) + "\"";
+    auto snapshot = histogram->TakeSnapshot();
+
+    for (double bound_s : PROMETHEUS_BOUNDS_S) {
+      const auto bound_us = static_cast<uint64_t>(bound_s * 1e6);
+      out << "pulseone_pipeline_latency_seconds_bucket{" << labels << ",le=\""
+          << bound_s << "\"} " << histogram->CountAtOrBelow(bound_us) << "\n";
+    }
+    out << "pulseone_pipeline_latency_seconds_bucket{" << labels
+        << ",le=\"+Inf\"} " << snapshot.count << "\n";
+    out << "pulseone_pipeline_latency_seconds_sum{" << labels << "} "
+        << static_cast<double>(snapshot.sum_us) / 1e6 << "\n";
+    out << "pulseone_pipeline_latency_seconds_count{" << labels << "} "
+        << snapshot.count << "\n";
+  }
+  return out.str();
+}
+
+void PipelineMetrics::Reset() {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  for (auto &[key, histogram] : histograms_) {
+    histogram->Reset();
+  }
+}
+
+} // namespace Pipeline
+} // namespace PulseOne
@@ -0,0 +1,1013 @@
+// =============================================================================
+// collector/src/Pipeline/PipelineWal.cpp - 파이프라인 WAL 구현
+// =============================================================================
+
+#include "Pipeline/PipelineWal.h"
+#include "Logging/LogManager.h"
+#include "Pipeline/DeviceMessageCodec.h"
+#include "Platform/PlatformCompat.h"
+#include "Utils/ConfigManager.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#if PULSEONE_WINDOWS
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace PulseOne {
+namespace Pipeline {
+
+namespace {
+
+constexpr uint32_t SEGMENT_MAGIC = 0x4C415750;    // "PWAL"
+constexpr uint32_t CHECKPOINT_MAGIC = 0x4B435750; // "PWCK"
+constexpr uint32_t SEGMENT_VERSION = 1;
+constexpr uint64_t MIN_SEGMENT_BYTES = 256 * 1024;
+constexpr uint32_t MAX_RECORD_BYTES = 64 * 1024 * 1024;
+
+struct SegmentHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t first_lsn;
+  uint64_t reserved[2];
+};
+static_assert(sizeof(SegmentHeader) == 32, "segment header layout");
+
+struct RecordHeader {
+  uint32_t length; // 페이로드 길이
+  uint32_t checksum;
+  uint64_t lsn;
+};
+static_assert(sizeof(RecordHeader) == 16, "record header layout");
+
+struct CheckpointRecord {
+  uint32_t magic;
+  uint32_t checksum;
+  uint64_t lsn;
+};
+static_assert(sizeof(CheckpointRecord) == 16, "checkpoint layout");
+
+int64_t NowMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// LSN까지 체크섬에 포함 (헤더가 찢어져도 검출)
+uint32_t RecordChecksum(uint64_t lsn, const char *payload, size_t size) {
+  const uint32_t seed = DeviceMessageCodec::Checksum(
+      reinterpret_cast<const uint8_t *>(&lsn), sizeof(lsn));
+  return DeviceMessageCodec::Checksum(
+      reinterpret_cast<const uint8_t *>(payload), size, seed);
+}
+
+bool SyncFile(std::FILE *file) {
+  if (std::fflush(file) != 0)
+    return false;
+#if PULSEONE_WINDOWS
+  return _commit(_fileno(file)) == 0;
+#else
+  return ::fsync(::fileno(file)) == 0;
+#endif
+}
+
+std::string SegmentFileName(uint64_t first_lsn) {
+  char name[40];
+  std::snprintf(name, sizeof(name), "wal_%016llx.log",
+                static_cast<unsigned long long>(first_lsn));
+  return name;
+}
+
+} // namespace
+
+// =============================================================================
+// 설정
+// =============================================================================
+
+PipelineWalOptions PipelineWalOptions::FromConfig() {
+  auto &config = ConfigManager::getInstance();
+  PipelineWalOptions options;
+
+  options.enabled = config.getBool("PIPELINE_WAL_ENABLED", false);
+  options.directory = config.getOrDefault("PIPELINE_WAL_DIR", "");
+  if (options.directory.empty())
+    options.directory = config.getDataDirectory() + "/wal";
+  options.segment_bytes =
+      static_cast<uint64_t>(
+          std::max(config.getInt("PIPELINE_WAL_SEGMENT_MB", 16), 1)) *
+      1024 * 1024;
+  options.max_bytes =
+      static_cast<uint64_t>(
+          std::max(config.getInt("PIPELINE_WAL_MAX_MB", 512), 1)) *
+      1024 * 1024;
+
+  std::string policy = config.getOrDefault("PIPELINE_WAL_FSYNC", "interval");
+  std::transform(policy.begin(), policy.end(), policy.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+  if (policy == "always")
+    options.fsync_policy = WalFsyncPolicy::ALWAYS;
+  else if (policy == "none")
+    options.fsync_policy = WalFsyncPolicy::NONE;
+  else
+    options.fsync_policy = WalFsyncPolicy::INTERVAL;
+
+  options.fsync_interval_ms =
+      std::max(config.getInt("PIPELINE_WAL_FSYNC_INTERVAL_MS", 100), 1);
+  options.checkpoint_interval_ms =
+      std::max(config.getInt("PIPELINE_WAL_CHECKPOINT_MS", 1000), 10);
+  options.retry_interval_ms =
+      std::max(config.getInt("PIPELINE_WAL_RETRY_MS", 5000), 100);
+  options.retry_max_attempts =
+      std::max(config.getInt("PIPELINE_WAL_RETRY_MAX", 5), 1);
+  return options;
+}
+
+// =============================================================================
+// 수명 주기 / 복구
+// =============================================================================
+
+PipelineWal::~PipelineWal() { Close(); }
+
+std::string PipelineWal::SegmentPath(uint64_t first_lsn) const {
+  return (std::filesystem::path(options_.directory) /
+          SegmentFileName(first_lsn))
+      .string();
+}
+
+std::string PipelineWal::CheckpointPath() const {
+  return (std::filesystem::path(options_.directory) / "wal.checkpoint")
+      .string();
+}
+
+bool PipelineWal::ReadCheckpointFile(uint64_t &lsn) const {
+  std::ifstream in(CheckpointPath(), std::ios::binary);
+  CheckpointRecord record{};
+  if (!in.read(reinterpret_cast<char *>(&record), sizeof(record)))
+    return false;
+  if (record.magic != CHECKPOINT_MAGIC ||
+      record.checksum != DeviceMessageCodec::Checksum(
+                             reinterpret_cast<const uint8_t *>(&record.lsn),
+                             sizeof(record.lsn)))
+    return false;
+  lsn = record.lsn;
+  return true;
+}
+
+bool PipelineWal::WriteCheckpointFile(uint64_t lsn) {
+  CheckpointRecord record{};
+  record.magic = CHECKPOINT_MAGIC;
+  record.lsn = lsn;
+  record.checksum = DeviceMessageCodec::Checksum(
+      reinterpret_cast<const uint8_t *>(&record.lsn), sizeof(record.lsn));
+
+  // 임시 파일 → rename (부분 기록된 체크포인트를 읽지 않도록)
+  const std::string path = CheckpointPath();
+  const std::string tmp = path + ".tmp";
+  std::FILE *file = std::fopen(tmp.c_str(), "wb");
+  if (!file)
+    return false;
+  const bool written = std::fwrite(&record, sizeof(record), 1, file) == 1;
+  const bool closed = std::fclose(file) == 0;
+  std::error_code ec;
+  if (!written || !closed) {
+    std::filesystem::remove(tmp, ec);
+    return false;
+  }
+  std::filesystem::rename(tmp, path, ec);
+  return !ec;
+}
+
+bool PipelineWal::ScanSegment(Segment &segment, uint64_t checkpoint,
+                              std::vector<uint64_t> &live) {
+  std::ifstream in(segment.path, std::ios::binary);
+  SegmentHeader header{};
+  if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+      header.magic != SEGMENT_MAGIC || header.version != SEGMENT_VERSION)
+    return false;
+
+  segment.first_lsn = header.first_lsn;
+  segment.last_lsn = header.first_lsn - 1;
+  segment.live = 0;
+
+  // 길이/체크섬이 맞지 않거나 LSN이 증가하지 않는 지점이 기록 끝
+  std::string payload;
+  uint64_t valid_bytes = sizeof(header);
+  RecordHeader record{};
+  while (in.read(reinterpret_cast<char *>(&record), sizeof(record))) {
+    if (record.length == 0 || record.length > MAX_RECORD_BYTES ||
+        record.lsn <= segment.last_lsn)
+      break;
+    payload.resize(record.length);
+    if (!in.read(&payload[0], record.length) ||
+        RecordChecksum(record.lsn, payload.data(), payload.size()) !=
+            record.checksum)
+      break;
+
+    segment.last_lsn = record.lsn;
+    valid_bytes += sizeof(record) + record.length;
+    if (record.lsn >= checkpoint) {
+      live.push_back(record.lsn);
+      ++segment.live;
+    }
+  }
+
+  std::error_code ec;
+  segment.bytes = std::filesystem::file_size(segment.path, ec);
+  if (!ec && segment.bytes > valid_bytes) {
+    // 비정상 종료로 찢어진 꼬리 (마지막 완전한 레코드까지만 유효)
+    corrupt_.fetch_add(1, std::memory_order_relaxed);
+    LogManager::getInstance().Warn("WAL 세그먼트 꼬리 {}바이트 무시: {}",
+                                   segment.bytes - valid_bytes, segment.path);
+  }
+  return true;
+}
+
+bool PipelineWal::Open(const PipelineWalOptions &options) {
+  Close();
+
+  options_ = options;
+  options_.segment_bytes = std::max(options.segment_bytes, MIN_SEGMENT_BYTES);
+  options_.max_bytes = std::max(options.max_bytes, options_.segment_bytes * 2);
+
+  std::error_code ec;
+  std::filesystem::create_directories(options_.directory, ec);
+  if (ec) {
+    LogManager::getInstance().Error("WAL 디렉토리 생성 실패: {} ({})",
+                                    options_.directory, ec.message());
+    return false;
+  }
+
+  // LSN은 1부터. 체크포인트 파일이 없으면 남은 레코드를 모두 재생
+  uint64_t checkpoint = 1;
+  if (!ReadCheckpointFile(checkpoint) || checkpoint == 0)
+    checkpoint = 1;
+
+  std::vector<Segment> found;
+  for (const auto &entry :
+       std::filesystem::directory_iterator(options_.directory, ec)) {
+    const std::string name = entry.path().filename().string();
+    unsigned long long first = 0;
+    if (std::sscanf(name.c_str(), "wal_%llx.log", &first) == 1) {
+      Segment segment;
+      segment.first_lsn = static_cast<uint64_t>(first);
+      segment.path = entry.path().string();
+      found.push_back(std::move(segment));
+    }
+  }
+  std::sort(found.begin(), found.end(),
+            [](const Segment &a, const Segment &b) {
+              return a.first_lsn < b.first_lsn;
+            });
+
+  std::vector<uint64_t> live;
+  std::vector<Segment> kept;
+  uint64_t next = checkpoint;
+  for (auto &segment : found) {
+    if (!ScanSegment(segment, checkpoint, live)) {
+      LogManager::getInstance().Warn("손상된 WAL 세그먼트 삭제: {}",
+                                     segment.path);
+      std::filesystem::remove(segment.path, ec);
+      continue;
+    }
+    next = std::max(next, segment.last_lsn + 1);
+    if (segment.live == 0) {
+      // 모두 체크포인트 이전 (또는 빈 세그먼트)
+      std::filesystem::remove(segment.path, ec);
+      continue;
+    }
+    kept.push_back(segment);
+  }
+
+  // 체크포인트 이후 LSN 중 파일에 남은 것만 미완료 (사이 구멍은 완료 처리)
+  {
+    std::lock_guard<std::mutex> lock(tracker_mutex_);
+    base_lsn_ = checkpoint;
+    refs_.assign(next - checkpoint, 0);
+    for (uint64_t lsn : live)
+      refs_[lsn - checkpoint] = 1;
+    AdvanceBaseLocked();
+  }
+
+  {
+    std::lock_guard<std::mutex> io_lock(io_mutex_);
+    segments_.assign(kept.begin(), kept.end());
+    last_checkpoint_written_ = checkpoint;
+    next_checkpoint_ms_ = 0;
+    next_maintenance_ms_.store(0);
+    unsynced_ = false;
+    last_sync_ms_ = NowMs();
+    if (!OpenActiveSegmentLocked(next)) {
+      segments_.clear();
+      return false;
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> retry_lock(retry_mutex_);
+    retry_lsns_.clear();
+    retry_states_.clear();
+    next_retry_ms_ = 0;
+    retry_pending_.store(0);
+  }
+
+  {
+    std::lock_guard<std::mutex> replay_lock(replay_mutex_);
+    replay_segments_ = std::move(kept);
+    replay_index_ = 0;
+    replay_offset_ = sizeof(SegmentHeader);
+    replay_consumed_ = 0;
+    replay_checkpoint_ = checkpoint;
+    replay_pending_.store(live.size(), std::memory_order_release);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.clear();
+    next_lsn_ = next;
+    committed_lsn_ = next - 1;
+    failed_from_ = 0;
+    session_start_lsn_ = next;
+  }
+  recovered_.store(live.size());
+  enabled_.store(true, std::memory_order_release);
+
+  static const char *const POLICY_NAMES[] = {"always", "interval", "none"};
+  LogManager::getInstance().Info(
+      "📝 파이프라인 WAL 활성화: {} (fsync {}, 세그먼트 {}MB, 한도 {}MB, "
+      "재생 대상 {}개)",
+      options_.directory,
+      POLICY_NAMES[static_cast<size_t>(options_.fsync_policy)],
+      options_.segment_bytes / (1024 * 1024),
+      options_.max_bytes / (1024 * 1024), live.size());
+  return true;
+}
+
+void PipelineWal::Close() {
+  {
+    // 이미 LSN을 받은 레코드는 모두 파일에 쓴 뒤 닫음
+    std::unique_lock<std::mutex> lock(mutex_);
+    enabled_.store(false, std::memory_order_release);
+    while (leader_active_ || !pending_.empty()) {
+      if (leader_active_)
+        commit_cv_.wait(lock);
+      else
+        LeadCommit(lock);
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> replay_lock(replay_mutex_);
+    replay_segments_.clear();
+    replay_index_ = 0;
+    replay_pending_.store(0);
+  }
+
+  std::lock_guard<std::mutex> io_lock(io_mutex_);
+  if (!active_file_ && segments_.empty())
+    return;
+
+  SyncActiveLocked();
+  if (active_file_) {
+    std::fclose(active_file_);
+    active_file_ = nullptr;
+  }
+
+  const uint64_t checkpoint = CheckpointLsn();
+  if (WriteCheckpointFile(checkpoint))
+    DropSegmentsBefore(checkpoint);
+  const size_t remaining = segments_.size();
+  segments_.clear();
+
+  LogManager::getInstance().Info(
+      "📝 파이프라인 WAL 종료 (체크포인트 LSN {}, 남은 세그먼트 {}개)",
+      checkpoint, remaining);
+}
+
+// =============================================================================
+// 기록 (그룹 커밋)
+// =============================================================================
+
+bool PipelineWal::OpenActiveSegmentLocked(uint64_t first_lsn) {
+  const std::string path = SegmentPath(first_lsn);
+  std::FILE *file = std::fopen(path.c_str(), "wb");
+  if (!file) {
+    LogManager::getInstance().Error("WAL 세그먼트 생성 실패: {}", path);
+    return false;
+  }
+
+  SegmentHeader header{};
+  header.magic = SEGMENT_MAGIC;
+  header.version = SEGMENT_VERSION;
+  header.first_lsn = first_lsn;
+  if (std::fwrite(&header, sizeof(header), 1, file) != 1 ||
+      std::fflush(file) != 0) {
+    std::fclose(file);
+    LogManager::getInstance().Error("WAL 세그먼트 헤더 기록 실패: {}", path);
+    return false;
+  }
+
+  active_file_ = file;
+  Segment segment;
+  segment.first_lsn = first_lsn;
+  segment.last_lsn = first_lsn - 1;
+  segment.path = path;
+  segment.bytes = sizeof(header);
+  segments_.push_back(std::move(segment));
+  return true;
+}
+
+bool PipelineWal::SyncActiveLocked() {
+  if (!active_file_ || !unsynced_)
+    return true;
+  const bool ok = SyncFile(active_file_);
+  fsyncs_.fetch_add(1, std::memory_order_relaxed);
+  unsynced_ = false;
+  last_sync_ms_ = NowMs();
+  if (!ok)
+    write_errors_.fetch_add(1, std::memory_order_relaxed);
+  return ok;
+}
+
+bool PipelineWal::WriteGroupLocked(const std::string &buffer,
+                                   uint64_t first_lsn, uint64_t last_lsn) {
+  // 현재 세그먼트가 차면 동기화 후 다음 세그먼트로 (그룹은 쪼개지 않음)
+  if (active_file_ && !segments_.empty()) {
+    const Segment &active = segments_.back();
+    if (active.last_lsn >= active.first_lsn &&
+        active.bytes + buffer.size() > options_.segment_bytes) {
+      SyncActiveLocked();
+      std::fclose(active_file_);
+      active_file_ = nullptr;
+    }
+  }
+  if (!active_file_ && !OpenActiveSegmentLocked(first_lsn)) {
+    write_errors_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  if (std::fwrite(buffer.data(), 1, buffer.size(), active_file_) !=
+          buffer.size() ||
+      std::fflush(active_file_) != 0) {
+    write_errors_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  Segment &active = segments_.back();
+  active.bytes += buffer.size();
+  active.last_lsn = last_lsn;
+  unsynced_ = true;
+  group_commits_.fetch_add(1, std::memory_order_relaxed);
+
+  switch (options_.fsync_policy) {
+  case WalFsyncPolicy::ALWAYS:
+    return SyncActiveLocked();
+  case WalFsyncPolicy::INTERVAL:
+    // 부하가 계속되면 Maintain을 기다리지 않고 리더가 주기를 지킴
+    if (NowMs() - last_sync_ms_ >= options_.fsync_interval_ms)
+      SyncActiveLocked();
+    return true;
+  case WalFsyncPolicy::NONE:
+    return true;
+  }
+  return true;
+}
+
+void PipelineWal::LeadCommit(std::unique_lock<std::mutex> &lock) {
+  leader_active_ = true;
+  std::string buffer;
+  buffer.swap(pending_);
+  const uint64_t first_lsn = pending_first_lsn_;
+  const uint64_t last_lsn = next_lsn_ - 1;
+  const bool failed = failed_from_ != 0;
+  lock.unlock();
+
+  bool ok = false;
+  if (!failed) {
+    std::lock_guard<std::mutex> io_lock(io_mutex_);
+    ok = WriteGroupLocked(buffer, first_lsn, last_lsn);
+  }
+
+  lock.lock();
+  if (!ok && failed_from_ == 0) {
+    // 디스크 오류: 이후 기록 중단 (수집은 WAL 없이 계속)
+    failed_from_ = first_lsn;
+    enabled_.store(false, std::memory_order_release);
+    LogManager::getInstance().Error(
+        "❌ WAL 기록 실패 → WAL 비활성화 (LSN {}부터 미기록)", first_lsn);
+  }
+  committed_lsn_ = last_lsn;
+  leader_active_ = false;
+  commit_cv_.notify_all();
+}
+
+uint64_t PipelineWal::Append(const Structs::DeviceDataMessage &message,
+                             uint8_t lane) {
+  if (!IsEnabled())
+    return 0;
+
+  // 인코딩은 락 밖에서 (헤더 자리는 비워 둠)
+  std::string record(sizeof(RecordHeader), '\0');
+  DeviceMessageCodec::Encode(message, lane, record);
+  const size_t payload_size = record.size() - sizeof(RecordHeader);
+  if (payload_size > MAX_RECORD_BYTES)
+    return 0;
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (!IsEnabled())
+    return 0;
+
+  const uint64_t lsn = next_lsn_++;
+  RecordHeader header{};
+  header.length = static_cast<uint32_t>(payload_size);
+  header.lsn = lsn;
+  header.checksum =
+      RecordChecksum(lsn, record.data() + sizeof(RecordHeader), payload_size);
+  std::memcpy(&record[0], &header, sizeof(header));
+
+  if (pending_.empty())
+    pending_first_lsn_ = lsn;
+  pending_.append(record);
+  {
+    // 처리용 참조 1 (LSN 순서대로 추가되므로 refs_는 연속)
+    std::lock_guard<std::mutex> tracker_lock(tracker_mutex_);
+    refs_.push_back(1);
+  }
+  appended_.fetch_add(1, std::memory_order_relaxed);
+
+  // 그룹 커밋: 리더가 없으면 직접 쓰고, 있으면 그 리더의 다음 차례를 기다림
+  while (committed_lsn_ < lsn) {
+    if (leader_active_)
+      commit_cv_.wait(lock);
+    else
+      LeadCommit(lock);
+  }
+
+  if (failed_from_ != 0 && lsn >= failed_from_) {
+    lock.unlock();
+    Release(lsn, true); // 기록되지 않았으므로 추적 해제
+    return 0;
+  }
+  return lsn;
+}
+
+// =============================================================================
+// 참조 추적 / 체크포인트
+// =============================================================================
+
+void PipelineWal::AdvanceBaseLocked() {
+  while (!refs_.empty() && refs_.front() == 0) {
+    refs_.pop_front();
+    ++base_lsn_;
+  }
+}
+
+void PipelineWal::Retain(uint64_t lsn) {
+  if (lsn == 0)
+    return;
+  std::lock_guard<std::mutex> lock(tracker_mutex_);
+  if (lsn >= base_lsn_ && lsn - base_lsn_ < refs_.size())
+    ++refs_[lsn - base_lsn_];
+}
+
+void PipelineWal::Retain(const std::vector<uint64_t> &lsns) {
+  std::lock_guard<std::mutex> lock(tracker_mutex_);
+  for (uint64_t lsn : lsns) {
+    if (lsn != 0 && lsn >= base_lsn_ && lsn - base_lsn_ < refs_.size())
+      ++refs_[lsn - base_lsn_];
+  }
+}
+
+void PipelineWal::Release(uint64_t lsn, bool persisted) {
+  if (lsn == 0)
+    return;
+  if (!persisted) {
+    Release(std::vector<uint64_t>{lsn}, false);
+    return;
+  }
+  std::lock_guard<std::mutex> lock(tracker_mutex_);
+  if (lsn < base_lsn_ || lsn - base_lsn_ >= refs_.size())
+    return; // 용량 한도로 이미 폐기됨
+  uint32_t &refs = refs_[lsn - base_lsn_];
+  if (refs > 0)
+    --refs;
+  AdvanceBaseLocked();
+}
+
+void PipelineWal::Release(const std::vector<uint64_t> &lsns, bool persisted) {
+  if (!persisted) {
+    // 참조는 남긴 채 재시도 목록으로 (Retry가 다시 투입)
+    if (!IsEnabled())
+      return;
+    std::lock_guard<std::mutex> lock(retry_mutex_);
+    for (uint64_t lsn : lsns) {
+      if (lsn == 0)
+        continue;
+      retry_lsns_.push_back(lsn);
+      unpersisted_.fetch_add(1, std::memory_order_relaxed);
+    }
+    retry_pending_.store(retry_lsns_.size(), std::memory_order_release);
+    return;
+  }
+  std::lock_guard<std::mutex> lock(tracker_mutex_);
+  for (uint64_t lsn : lsns) {
+    if (lsn == 0 || lsn < base_lsn_ || lsn - base_lsn_ >= refs_.size())
+      continue;
+    uint32_t &refs = refs_[lsn - base_lsn_];
+    if (refs > 0)
+      --refs;
+  }
+  AdvanceBaseLocked();
+}
+
+uint64_t PipelineWal::CheckpointLsn() const {
+  std::lock_guard<std::mutex> lock(tracker_mutex_);
+  return base_lsn_;
+}
+
+void PipelineWal::DropSegmentsBefore(uint64_t checkpoint) {
+  std::error_code ec;
+  while (!segments_.empty()) {
+    const Segment &front = segments_.front();
+    const bool active = active_file_ && segments_.size() == 1;
+    if (active || front.last_lsn >= checkpoint)
+      break;
+    std::filesystem::remove(front.path, ec);
+    segments_.pop_front();
+  }
+}
+
+void PipelineWal::EnforceSizeLimit() {
+  uint64_t total = 0;
+  for (const auto &segment : segments_)
+    total += segment.bytes;
+
+  std::error_code ec;
+  while (total > options_.max_bytes && segments_.size() > 1) {
+    const Segment front = segments_.front();
+    size_t dropped = 0;
+    {
+      // 저장이 계속 실패하는 동안 디스크를 지키기 위해 미완료분을 포기
+      std::lock_guard<std::mutex> lock(tracker_mutex_);
+      while (!refs_.empty() && base_lsn_ <= front.last_lsn) {
+        if (refs_.front() > 0)
+          ++dropped;
+        refs_.pop_front();
+        ++base_lsn_;
+      }
+      AdvanceBaseLocked();
+    }
+    truncated_.fetch_add(dropped, std::memory_order_relaxed);
+    std::filesystem::remove(front.path, ec);
+    segments_.pop_front();
+    total -= front.bytes;
+    LogManager::getInstance().Warn(
+        "⚠️ WAL 용량 한도 초과: 세그먼트 폐기 {} (미완료 {}개 포기)",
+        front.path, dropped);
+  }
+}
+
+void PipelineWal::Maintain() {
+  if (!IsEnabled())
+    return;
+
+  const int64_t now = NowMs();
+  if (now < next_maintenance_ms_.load(std::memory_order_relaxed))
+    return;
+  std::unique_lock<std::mutex> io_lock(io_mutex_, std::try_to_lock);
+  if (!io_lock.owns_lock())
+    return;
+
+  int interval_ms = options_.checkpoint_interval_ms;
+  if (options_.fsync_policy == WalFsyncPolicy::INTERVAL)
+    interval_ms = std::min(interval_ms, options_.fsync_interval_ms);
+  next_maintenance_ms_.store(now + interval_ms, std::memory_order_relaxed);
+
+  // 유입이 멈춰도 마지막 그룹까지 주기 안에 fsync
+  if (options_.fsync_policy == WalFsyncPolicy::INTERVAL &&
+      now - last_sync_ms_ >= options_.fsync_interval_ms)
+    SyncActiveLocked();
+
+  if (now < next_checkpoint_ms_)
+    return;
+  next_checkpoint_ms_ = now + options_.checkpoint_interval_ms;
+
+  const uint64_t checkpoint = CheckpointLsn();
+  if (checkpoint != last_checkpoint_written_ &&
+      WriteCheckpointFile(checkpoint)) {
+    last_checkpoint_written_ = checkpoint;
+    DropSegmentsBefore(checkpoint);
+  }
+  EnforceSizeLimit();
+}
+
+// =============================================================================
+// 재생
+// =============================================================================
+
+size_t PipelineWal::Replay(const ReplaySink &sink, size_t max_items) {
+  if (!HasReplay() || max_items == 0)
+    return 0;
+
+  std::unique_lock<std::mutex> replay_lock(replay_mutex_, std::try_to_lock);
+  if (!replay_lock.owns_lock())
+    return 0;
+
+  size_t delivered = 0;
+  bool sink_full = false;
+  std::string payload;
+  while (!sink_full && delivered < max_items &&
+         replay_index_ < replay_segments_.size()) {
+    const Segment &segment = replay_segments_[replay_index_];
+
+    // 세그먼트가 용량 한도로 지워졌으면 다음으로
+    std::FILE *file = std::fopen(segment.path.c_str(), "rb");
+    bool finished =
+        !file ||
+        std::fseek(file, static_cast<long>(replay_offset_), SEEK_SET) != 0;
+
+    while (!finished && delivered < max_items) {
+      RecordHeader header{};
+      if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+          header.length == 0 || header.length > MAX_RECORD_BYTES ||
+          header.lsn > segment.last_lsn) {
+        finished = true; // 복구 시 확인한 범위의 끝
+        break;
+      }
+      payload.resize(header.length);
+      if (std::fread(&payload[0], 1, header.length, file) != header.length) {
+        finished = true;
+        break;
+      }
+      const uint64_t next_offset =
+          replay_offset_ + sizeof(header) + header.length;
+      if (header.lsn < replay_checkpoint_) {
+        replay_offset_ = next_offset;
+        continue;
+      }
+
+      Structs::DeviceDataMessage message;
+      uint8_t lane = 0;
+      if (RecordChecksum(header.lsn, payload.data(), payload.size()) !=
+              header.checksum ||
+          !DeviceMessageCodec::Decode(
+              reinterpret_cast<const uint8_t *>(payload.data()),
+              payload.size(), message, lane)) {
+        corrupt_.fetch_add(1, std::memory_order_relaxed);
+        Release(header.lsn, true);
+      } else {
+        message.wal_lsn = header.lsn;
+        if (!sink(std::move(message), lane)) {
+          sink_full = true;
+          break;
+        }
+        ++delivered;
+      }
+      replay_offset_ = next_offset;
+      ++replay_consumed_;
+      replay_pending_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    if (file)
+      std::fclose(file);
+    if (!finished)
+      break;
+
+    // 읽지 못한 나머지 (세그먼트 폐기 등)는 대기 수에서 제외
+    if (segment.live > replay_consumed_)
+      replay_pending_.fetch_sub(
+          std::min(segment.live - replay_consumed_, replay_pending_.load()),
+          std::memory_order_acq_rel);
+    ++replay_index_;
+    replay_offset_ = sizeof(SegmentHeader);
+    replay_consumed_ = 0;
+  }
+
+  if (replay_index_ >= replay_segments_.size() && !replay_segments_.empty()) {
+    replay_segments_.clear();
+    replay_index_ = 0;
+    replay_pending_.store(0, std::memory_order_release);
+    LogManager::getInstance().Info("📝 WAL 재생 완료 (누적 {}개)",
+                                   replayed_.load() + delivered);
+  }
+
+  replayed_.fetch_add(delivered, std::memory_order_relaxed);
+  return delivered;
+}
+
+// =============================================================================
+// 저장 실패 재시도
+// =============================================================================
+
+size_t PipelineWal::Retry(const ReplaySink &sink, size_t max_items) {
+  if (!HasRetry() || max_items == 0)
+    return 0;
+
+  uint64_t base = 0;
+  {
+    std::lock_guard<std::mutex> lock(tracker_mutex_);
+    base = base_lsn_;
+  }
+
+  // 목록은 락 안에서 떼어 내고 파일은 락 밖에서 읽음 (Release 비차단)
+  // 백오프 중인 LSN은 목록에 남겨 다음 호출로 미룸
+  std::vector<uint64_t> lsns;
+  {
+    std::lock_guard<std::mutex> lock(retry_mutex_);
+    const int64_t now = NowMs();
+    if (now < next_retry_ms_)
+      return 0;
+    next_retry_ms_ = now + options_.retry_interval_ms;
+    std::vector<uint64_t> waiting;
+    for (uint64_t lsn : retry_lsns_) {
+      auto it = retry_states_.find(lsn);
+      if (lsn >= base && it != retry_states_.end() && it->second.due_ms > now)
+        waiting.push_back(lsn);
+      else
+        lsns.push_back(lsn);
+    }
+    retry_lsns_.swap(waiting);
+    retry_pending_.store(retry_lsns_.size(), std::memory_order_release);
+    // 체크포인트가 지나간 LSN의 시도 횟수는 더 필요 없음
+    for (auto it = retry_states_.begin(); it != retry_states_.end();)
+      it = it->first < base ? retry_states_.erase(it) : std::next(it);
+  }
+  if (lsns.empty())
+    return 0;
+  std::sort(lsns.begin(), lsns.end());
+
+  std::vector<Segment> segments;
+  {
+    std::lock_guard<std::mutex> io_lock(io_mutex_);
+    segments.assign(segments_.begin(), segments_.end());
+  }
+
+  size_t pos = 0;
+  while (pos < lsns.size() && lsns[pos] < base)
+    ++pos; // 용량 한도로 이미 폐기됨
+
+  size_t delivered = 0;
+  bool stopped = false;
+  std::string payload;
+  for (const auto &segment : segments) {
+    if (stopped || pos >= lsns.size())
+      break;
+    if (segment.last_lsn < lsns[pos])
+      continue;
+
+    std::FILE *file = std::fopen(segment.path.c_str(), "rb");
+    if (!file ||
+        std::fseek(file, static_cast<long>(sizeof(SegmentHeader)), SEEK_SET) !=
+            0) {
+      if (file)
+        std::fclose(file);
+      continue;
+    }
+
+    RecordHeader header{};
+    while (pos < lsns.size() && lsns[pos] <= segment.last_lsn &&
+           std::fread(&header, sizeof(header), 1, file) == 1) {
+      if (header.length == 0 || header.length > MAX_RECORD_BYTES ||
+          header.lsn > segment.last_lsn)
+        break;
+      if (header.lsn < lsns[pos]) {
+        if (std::fseek(file, static_cast<long>(header.length), SEEK_CUR) != 0)
+          break;
+        continue;
+      }
+      while (pos < lsns.size() && lsns[pos] < header.lsn) {
+        // 세그먼트에서 찾지 못한 LSN은 다시 읽을 수 없으므로 추적 해제
+        corrupt_.fetch_add(1, std::memory_order_relaxed);
+        Release(lsns[pos++], true);
+      }
+      if (pos >= lsns.size() || lsns[pos] != header.lsn) {
+        if (std::fseek(file, static_cast<long>(header.length), SEEK_CUR) != 0)
+          break;
+        continue;
+      }
+
+      payload.resize(header.length);
+      if (std::fread(&payload[0], 1, header.length, file) != header.length)
+        break;
+      Structs::DeviceDataMessage message;
+      uint8_t lane = 0;
+      const bool decoded =
+          RecordChecksum(header.lsn, payload.data(), payload.size()) ==
+              header.checksum &&
+          DeviceMessageCodec::Decode(
+              reinterpret_cast<const uint8_t *>(payload.data()),
+              payload.size(), message, lane);
+
+      // 한도를 넘긴 LSN은 저장된 것으로 반환해 체크포인트를 풀어 줌
+      bool give_up = false;
+      if (decoded) {
+        std::lock_guard<std::mutex> lock(retry_mutex_);
+        auto it = retry_states_.find(header.lsn);
+        if (it != retry_states_.end() &&
+            it->second.attempts >= options_.retry_max_attempts) {
+          retry_states_.erase(it);
+          give_up = true;
+        }
+      }
+      if (give_up) {
+        retry_dropped_.fetch_add(1, std::memory_order_relaxed);
+        LogManager::getInstance().Warn(
+            "WAL 재투입 {}회 실패, 메시지 버림 (LSN {}, 디바이스 {})",
+            options_.retry_max_attempts, header.lsn, message.device_id);
+        while (pos < lsns.size() && lsns[pos] == header.lsn)
+          Release(lsns[pos++], true);
+        continue;
+      }
+
+      // 같은 LSN이 여러 번 실패했으면 남은 참조 수만큼 투입
+      bool counted = false;
+      while (pos < lsns.size() && lsns[pos] == header.lsn) {
+        if (!decoded) {
+          corrupt_.fetch_add(1, std::memory_order_relaxed);
+          Release(header.lsn, true);
+          ++pos;
+          continue;
+        }
+        if (delivered >= max_items) {
+          stopped = true;
+          break;
+        }
+        Structs::DeviceDataMessage copy = message;
+        copy.wal_lsn = header.lsn;
+        copy.wal_retry = true;
+        if (!sink(std::move(copy), lane)) {
+          stopped = true;
+          break;
+        }
+        if (!counted) {
+          // 실제로 투입한 경우만 한 번 세고, 다음 투입은 지수 백오프
+          counted = true;
+          std::lock_guard<std::mutex> lock(retry_mutex_);
+          RetryState &state = retry_states_[header.lsn];
+          ++state.attempts;
+          state.due_ms = NowMs() + (static_cast<int64_t>(
+                                        options_.retry_interval_ms)
+                                    << std::min(state.attempts - 1, 6));
+        }
+        ++delivered;
+        ++pos;
+      }
+      if (stopped)
+        break;
+    }
+    std::fclose(file);
+  }
+
+  if (stopped && pos < lsns.size()) {
+    // 큐가 찼거나 한도에 닿음 → 남은 LSN은 다음 호출에서 바로 이어서
+    std::lock_guard<std::mutex> lock(retry_mutex_);
+    retry_lsns_.insert(retry_lsns_.end(), lsns.begin() + pos, lsns.end());
+    retry_pending_.store(retry_lsns_.size(), std::memory_order_release);
+    next_retry_ms_ = 0;
+  }
+
+  retried_.fetch_add(delivered, std::memory_order_relaxed);
+  return delivered;
+}
+
+PipelineWalStats PipelineWal::GetStats() const {
+  PipelineWalStats stats;
+  stats.enabled = IsEnabled();
+  stats.appended = appended_.load();
+  stats.group_commits = group_commits_.load();
+  stats.fsyncs = fsyncs_.load();
+  stats.unpersisted = unpersisted_.load();
+  stats.retried = retried_.load();
+  stats.retry_pending = retry_pending_.load();
+  stats.retry_dropped = retry_dropped_.load();
+  stats.truncated = truncated_.load();
+  stats.recovered = recovered_.load();
+  stats.replayed = replayed_.load();
+  stats.corrupt = corrupt_.load();
+  stats.write_errors = write_errors_.load();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.next_lsn = next_lsn_;
+  }
+  {
+    std::lock_guard<std::mutex> lock(tracker_mutex_);
+    stats.checkpoint_lsn = base_lsn_;
+    stats.in_flight = refs_.size();
+  }
+  {
+    std::lock_guard<std::mutex> lock(io_mutex_);
+    stats.segments = segments_.size();
+    for (const auto &segment : segments_)
+      stats.bytes_on_disk += segment.bytes;
+  }
+  return stats;
+}
+
+} // namespace Pipeline
+} // namespace PulseOne
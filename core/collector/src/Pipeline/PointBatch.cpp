@@ -0,0 +1,186 @@
+// =============================================================================
+// collector/src/Pipeline/PointBatch.cpp - 컬럼형(SoA) 포인트 배치
+// =============================================================================
+
+#include "Pipeline/PointBatch.h"
+#include <cstring>
+#include <type_traits>
+
+namespace PulseOne {
+namespace Pipeline {
+
+namespace {
+
+template <typename T> uint64_t PackScalar(T value) {
+  static_assert(sizeof(T) <= sizeof(uint64_t), "scalar too wide");
+  uint64_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(T));
+  return bits;
+}
+
+template <typename T> T UnpackScalar(uint64_t bits) {
+  T value;
+  std::memcpy(&value, &bits, sizeof(T));
+  return value;
+}
+
+} // namespace
+
+void PointBatch::Reserve(size_t rows) {
+  point_ids_.reserve(rows);
+  values_.reserve(rows);
+  kinds_.reserve(rows);
+  qualities_.reserve(rows);
+  flags_.reserve(rows);
+  timestamps_.reserve(rows);
+}
+
+void PointBatch::Clear() {
+  point_ids_.clear();
+  values_.clear();
+  kinds_.clear();
+  qualities_.clear();
+  flags_.clear();
+  timestamps_.clear();
+  strings_.clear();
+}
+
+void PointBatch::Append(int point_id, const Structs::DataValue &value,
+                        Structs::DataQuality quality,
+                        const Structs::Timestamp &timestamp, uint8_t flags) {
+  uint64_t payload = std::visit(
+      [this](const auto &val) -> uint64_t {
+        using T = std::decay_t<decltype(val)>;
+        if constexpr (std::is_same_v<T, std::string>) {
+          strings_.push_back(val);
+          return static_cast<uint64_t>(strings_.size() - 1);
+        } else {
+          return PackScalar(val);
+        }
+      },
+      value);
+
+  point_ids_.push_back(static_cast<int32_t>(point_id));
+  values_.push_back(payload);
+  kinds_.push_back(static_cast<uint8_t>(value.index()));
+  qualities_.push_back(static_cast<uint8_t>(quality));
+  flags_.push_back(flags);
+  timestamps_.push_back(
+      static_cast<int64_t>(timestamp.time_since_epoch().count()));
+}
+
+void PointBatch::Append(const Structs::TimestampedValue &point) {
+  uint8_t flags = 0;
+  if (point.value_changed)
+    flags |= FLAG_VALUE_CHANGED;
+  if (point.is_virtual_point)
+    flags |= FLAG_VIRTUAL_POINT;
+  if (point.force_rdb_store)
+    flags |= FLAG_FORCE_RDB_STORE;
+  Append(point.point_id, point.value, point.quality, point.timestamp, flags);
+}
+
+PointBatch
+PointBatch::FromLegacy(const std::vector<Structs::TimestampedValue> &points) {
+  PointBatch batch;
+  batch.Reserve(points.size());
+  for (const auto &point : points) {
+    batch.Append(point);
+  }
+  return batch;
+}
+
+double PointBatch::NumericValue(size_t row) const {
+  const uint64_t bits = values_[row];
+  switch (Kind(row)) {
+  case ValueKind::BOOL:
+    return UnpackScalar<bool>(bits) ? 1.0 : 0.0;
+  case ValueKind::INT16:
+    return UnpackScalar<int16_t>(bits);
+  case ValueKind::UINT16:
+    return UnpackScalar<uint16_t>(bits);
+  case ValueKind::INT32:
+    return UnpackScalar<int32_t>(bits);
+  case ValueKind::UINT32:
+    return UnpackScalar<uint32_t>(bits);
+  case ValueKind::INT64:
+    return static_cast<double>(UnpackScalar<int64_t>(bits));
+  case ValueKind::UINT64:
+    return static_cast<double>(UnpackScalar<uint64_t>(bits));
+  case ValueKind::FLOAT:
+    return UnpackScalar<float>(bits);
+  case ValueKind::DOUBLE:
+    return UnpackScalar<double>(bits);
+  case ValueKind::STRING:
+    break;
+  }
+  return 0.0;
+}
+
+const std::string *PointBatch::StringValue(size_t row) const {
+  if (!IsString(row))
+    return nullptr;
+  return &strings_[static_cast<size_t>(values_[row])];
+}
+
+Structs::DataValue PointBatch::Value(size_t row) const {
+  const uint64_t bits = values_[row];
+  switch (Kind(row)) {
+  case ValueKind::BOOL:
+    return UnpackScalar<bool>(bits);
+  case ValueKind::INT16:
+    return UnpackScalar<int16_t>(bits);
+  case ValueKind::UINT16:
+    return UnpackScalar<uint16_t>(bits);
+  case ValueKind::INT32:
+    return UnpackScalar<int32_t>(bits);
+  case ValueKind::UINT32:
+    return UnpackScalar<uint32_t>(bits);
+  case ValueKind::INT64:
+    return UnpackScalar<int64_t>(bits);
+  case ValueKind::UINT64:
+    return UnpackScalar<uint64_t>(bits);
+  case ValueKind::FLOAT:
+    return UnpackScalar<float>(bits);
+  case ValueKind::DOUBLE:
+    return UnpackScalar<double>(bits);
+  case ValueKind::STRING:
+    return strings_[static_cast<size_t>(bits)];
+  }
+  return 0.0;
+}
+
+Structs::TimestampedValue PointBatch::ToLegacy(size_t row) const {
+  Structs::TimestampedValue point;
+  point.point_id = PointId(row);
+  point.value = Value(row);
+  point.quality = Quality(row);
+  point.timestamp = Time(row);
+  point.value_changed = HasFlag(row, FLAG_VALUE_CHANGED);
+  point.is_virtual_point = HasFlag(row, FLAG_VIRTUAL_POINT);
+  point.force_rdb_store = HasFlag(row, FLAG_FORCE_RDB_STORE);
+  return point;
+}
+
+void PointBatch::AppendLegacyTo(
+    std::vector<Structs::TimestampedValue> &out) const {
+  out.reserve(out.size() + Size());
+  for (size_t row = 0; row < Size(); ++row) {
+    out.push_back(ToLegacy(row));
+  }
+}
+
+size_t PointBatch::MemoryUsage() const {
+  size_t bytes = point_ids_.capacity() * sizeof(int32_t) +
+                 values_.capacity() * sizeof(uint64_t) + kinds_.capacity() +
+                 qualities_.capacity() + flags_.capacity() +
+                 timestamps_.capacity() * sizeof(int64_t) +
+                 strings_.capacity() * sizeof(std::string);
+  for (const auto &s : strings_) {
+    bytes += s.capacity();
+  }
+  return bytes;
+}
+
+} // namespace Pipeline
+} // namespace PulseOne
@@ -0,0 +1,117 @@
+// =============================================================================
+// collector/src/Pipeline/PointIndexRegistry.cpp - 포인트 밀집 인덱스 레지스트리
+// =============================================================================
+
+#include "Pipeline/PointIndexRegistry.h"
+#include "Database/RepositoryFactory.h"
+#include "Database/Repositories/DataPointRepository.h"
+#include "Database/Repositories/VirtualPointRepository.h"
+#include "Logging/LogManager.h"
+
+namespace PulseOne {
+namespace Pipeline {
+
+PointIndexRegistry &PointIndexRegistry::getInstance() {
+  static PointIndexRegistry instance;
+  return instance;
+}
+
+PointIndexRegistry::PointIndexRegistry() = default;
+
+uint32_t PointIndexRegistry::IndexOf(int point_id) const {
+  if (point_id >= 0 && point_id < DIRECT_ID_LIMIT) {
+    const auto *slot = direct_.Find(static_cast<uint32_t>(point_id));
+    if (!slot)
+      return INVALID_INDEX;
+    uint32_t stored = slot->load(std::memory_order_acquire);
+    return stored == 0 ? INVALID_INDEX : stored - 1;
+  }
+
+  std::shared_lock<std::shared_mutex> lock(overflow_mutex_);
+  auto it = overflow_.find(point_id);
+  return it == overflow_.end() ? INVALID_INDEX : it->second;
+}
+
+uint32_t PointIndexRegistry::Acquire(int point_id) {
+  uint32_t index = IndexOf(point_id);
+  if (index != INVALID_INDEX)
+    return index;
+
+  std::lock_guard<std::mutex> lock(assign_mutex_);
+  return AssignLocked(point_id);
+}
+
+void PointIndexRegistry::Preload(const std::vector<int> &point_ids) {
+  std::lock_guard<std::mutex> lock(assign_mutex_);
+  for (int point_id : point_ids) {
+    AssignLocked(point_id);
+  }
+}
+
+uint32_t PointIndexRegistry::AssignLocked(int point_id) {
+  // assign_mutex_ 보유 상태: 다른 스레드가 먼저 등록했는지 다시 확인
+  uint32_t existing = IndexOf(point_id);
+  if (existing != INVALID_INDEX)
+    return existing;
+
+  uint32_t index = next_index_.load(std::memory_order_relaxed);
+  if (index >= PointStateArray<std::atomic<int>>::MaxSize()) {
+    return INVALID_INDEX;
+  }
+
+  // 역방향을 먼저 기록한 뒤 정방향을 공개
+  reverse_.At(index).store(point_id, std::memory_order_relaxed);
+
+  if (point_id >= 0 && point_id < DIRECT_ID_LIMIT) {
+    direct_.At(static_cast<uint32_t>(point_id))
+        .store(index + 1, std::memory_order_release);
+  } else {
+    std::unique_lock<std::shared_mutex> lock(overflow_mutex_);
+    overflow_[point_id] = index;
+  }
+
+  next_index_.store(index + 1, std::memory_order_release);
+  return index;
+}
+
+int PointIndexRegistry::PointIdOf(uint32_t index) const {
+  if (index >= Size())
+    return -1;
+  const auto *slot = reverse_.Find(index);
+  return slot ? slot->load(std::memory_order_relaxed) : -1;
+}
+
+size_t PointIndexRegistry::LoadConfiguredPoints() {
+  std::vector<int> point_ids;
+
+  try {
+    auto &factory = Database::RepositoryFactory::getInstance();
+
+    if (auto repo = factory.getDataPointRepository()) {
+      for (const auto &entity : repo->findAll()) {
+        point_ids.push_back(entity.getId());
+      }
+    }
+    if (auto repo = factory.getVirtualPointRepository()) {
+      for (const auto &entity : repo->findAll()) {
+        point_ids.push_back(entity.getId());
+      }
+    }
+  } catch (const std::exception &e) {
+    LogManager::getInstance().Warn(
+        "PointIndexRegistry: 설정 포인트 로드 실패 (지연 등록으로 진행): " +
+        std::string(e.what()));
+  }
+
+  const size_t before = Size();
+  Preload(point_ids);
+  const size_t added = Size() - before;
+
+  LogManager::getInstance().Info("PointIndexRegistry: " +
+                                 std::to_string(added) + "개 포인트 등록 (총 " +
+                                 std::to_string(Size()) + "개)");
+  return added;
+}
+
+} // namespace Pipeline
+} // namespace PulseOne
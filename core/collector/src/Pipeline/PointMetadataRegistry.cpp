@@ -0,0 +1,204 @@
+// =============================================================================
+// collector/src/Pipeline/PointMetadataRegistry.cpp - 포인트 메타데이터 레지스트리
+// =============================================================================
+
+#include "Pipeline/PointMetadataRegistry.h"
+#include "Database/Entities/DataPointEntity.h"
+#include "Database/RepositoryFactory.h"
+#include "Database/Repositories/DataPointRepository.h"
+#include "Database/Repositories/DeviceRepository.h"
+#include "Database/Repositories/VirtualPointRepository.h"
+#include "Logging/LogManager.h"
+
+namespace PulseOne {
+namespace Pipeline {
+
+namespace {
+
+std::shared_ptr<const PointMetadata>
+MakeMetadata(const Database::Entities::DataPointEntity &entity,
+             const std::string &device_name) {
+  auto meta = std::make_shared<PointMetadata>();
+  meta->point_id = entity.getId();
+  meta->device_id = entity.getDeviceId();
+  meta->name = entity.getName();
+  meta->unit = entity.getUnit();
+  meta->device_name = device_name;
+  meta->data_type = entity.getDataType();
+  meta->scaling_factor = entity.getScalingFactor();
+  meta->scaling_offset = entity.getScalingOffset();
+  meta->log_enabled = entity.isLogEnabled();
+  meta->log_interval_ms = entity.getLogInterval();
+  meta->tags = entity.getTags();
+  return meta;
+}
+
+} // namespace
+
+PointMetadataRegistry &PointMetadataRegistry::getInstance() {
+  static PointMetadataRegistry instance;
+  return instance;
+}
+
+PointMetadataRegistry::PointMetadataRegistry()
+    : snapshot_(std::make_shared<const Snapshot>()) {}
+
+std::shared_ptr<const PointMetadata>
+PointMetadataRegistry::Find(int point_id, bool is_virtual) const {
+  auto snapshot = GetSnapshot();
+  const PointMap &map = snapshot->MapFor(is_virtual);
+  auto it = map.find(point_id);
+  return it == map.end() ? nullptr : it->second;
+}
+
+std::string PointMetadataRegistry::NameOf(int point_id,
+                                          bool is_virtual) const {
+  auto snapshot = GetSnapshot();
+  const PointMetadata *meta = snapshot->Find(point_id, is_virtual);
+  if (meta && !meta->name.empty())
+    return meta->name;
+  return "point_" + std::to_string(point_id);
+}
+
+std::string PointMetadataRegistry::UnitOf(int point_id,
+                                          bool is_virtual) const {
+  auto snapshot = GetSnapshot();
+  const PointMetadata *meta = snapshot->Find(point_id, is_virtual);
+  return meta ? meta->unit : std::string();
+}
+
+void PointMetadataRegistry::PublishLocked(PointMap &&points,
+                                          PointMap &&virtual_points) {
+  auto next = std::make_shared<Snapshot>();
+  next->points = std::move(points);
+  next->virtual_points = std::move(virtual_points);
+  next->generation = generation_.load(std::memory_order_relaxed) + 1;
+  const uint64_t generation = next->generation;
+  std::atomic_store_explicit(&snapshot_,
+                             std::shared_ptr<const Snapshot>(std::move(next)),
+                             std::memory_order_release);
+  generation_.store(generation, std::memory_order_release);
+}
+
+std::string PointMetadataRegistry::DeviceNameOf(int device_id) {
+  auto repo = Database::RepositoryFactory::getInstance().getDeviceRepository();
+  if (repo) {
+    if (auto device = repo->findById(device_id)) {
+      return device->getName();
+    }
+  }
+  return "device_" + std::to_string(device_id);
+}
+
+size_t PointMetadataRegistry::LoadAll() {
+  PointMap points;
+  PointMap virtual_points;
+
+  try {
+    auto &factory = Database::RepositoryFactory::getInstance();
+
+    std::unordered_map<int, std::string> device_names;
+    if (auto repo = factory.getDeviceRepository()) {
+      for (const auto &device : repo->findAll()) {
+        device_names[device.getId()] = device.getName();
+      }
+    }
+
+    if (auto repo = factory.getDataPointRepository()) {
+      for (const auto &entity : repo->findAll()) {
+        auto it = device_names.find(entity.getDeviceId());
+        points[entity.getId()] = MakeMetadata(
+            entity, it != device_names.end()
+                        ? it->second
+                        : "device_" + std::to_string(entity.getDeviceId()));
+      }
+    }
+
+    if (auto repo = factory.getVirtualPointRepository()) {
+      for (const auto &entity : repo->findAll()) {
+        auto meta = std::make_shared<PointMetadata>();
+        meta->point_id = entity.getId();
+        meta->device_id = entity.getDeviceId().value_or(0);
+        meta->is_virtual = true;
+        meta->name = entity.getName();
+        meta->unit = entity.getUnit();
+        if (meta->device_id > 0) {
+          auto it = device_names.find(meta->device_id);
+          if (it != device_names.end())
+            meta->device_name = it->second;
+        }
+        if (!entity.getTags().empty())
+          meta->tags.push_back(entity.getTags());
+        virtual_points[meta->point_id] = std::move(meta);
+      }
+    }
+  } catch (const std::exception &e) {
+    LogManager::getInstance().Warn(
+        "PointMetadataRegistry: 메타데이터 로드 실패 (기존 스냅샷 유지): " +
+        std::string(e.what()));
+    return 0;
+  }
+
+  const size_t count = points.size() + virtual_points.size();
+  {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    PublishLocked(std::move(points), std::move(virtual_points));
+  }
+
+  LogManager::getInstance().Info("PointMetadataRegistry: " +
+                                 std::to_string(count) +
+                                 "개 포인트 메타데이터 로드");
+  return count;
+}
+
+size_t PointMetadataRegistry::RefreshDevice(int device_id) {
+  std::vector<Database::Entities::DataPointEntity> entities;
+  std::string device_name;
+
+  try {
+    auto repo =
+        Database::RepositoryFactory::getInstance().getDataPointRepository();
+    if (!repo)
+      return 0;
+    entities = repo->findByDeviceId(device_id);
+    device_name = DeviceNameOf(device_id);
+  } catch (const std::exception &e) {
+    LogManager::getInstance().Warn("PointMetadataRegistry: 디바이스 " +
+                                   std::to_string(device_id) +
+                                   " 메타데이터 갱신 실패: " + e.what());
+    return 0;
+  }
+
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  // 항목은 shared_ptr로 공유되므로 맵 복사는 포인터 복사뿐.
+  // 가상포인트 맵은 그대로 공유
+  auto current = GetSnapshot();
+  PointMap points = current->points;
+  PointMap virtual_points = current->virtual_points;
+  for (auto it = points.begin(); it != points.end();) {
+    if (it->second->device_id == device_id) {
+      it = points.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  for (const auto &entity : entities) {
+    points[entity.getId()] = MakeMetadata(entity, device_name);
+  }
+  PublishLocked(std::move(points), std::move(virtual_points));
+  return entities.size();
+}
+
+void PointMetadataRegistry::Upsert(PointMetadata metadata) {
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  auto current = GetSnapshot();
+  PointMap points = current->points;
+  PointMap virtual_points = current->virtual_points;
+  const int point_id = metadata.point_id;
+  PointMap &target = metadata.is_virtual ? virtual_points : points;
+  target[point_id] = std::make_shared<const PointMetadata>(std::move(metadata));
+  PublishLocked(std::move(points), std::move(virtual_points));
+}
+
+} // namespace Pipeline
+} // namespace PulseOne
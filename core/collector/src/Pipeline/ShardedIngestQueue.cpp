@@ -0,0 +1,343 @@
+// =============================================================================
+// collector/src/Pipeline/ShardedIngestQueue.cpp - 락프리 샤드 수집 큐 구현
+// =============================================================================
+
+#include "Pipeline/ShardedIngestQueue.h"
+#include <algorithm>
+#include <functional>
+
+namespace PulseOne {
+namespace Pipeline {
+
+ShardedIngestQueue::ShardedIngestQueue(size_t capacity, size_t shard_count,
+                                       size_t lane_count)
+    : capacity_(std::max<size_t>(capacity, 1)),
+      shard_count_(std::max<size_t>(shard_count, 1)) {
+  if (lane_count == 0)
+    lane_count = 1;
+
+  // 샤드 하나가 전체 용량을 감당하지 않도록 균등 분배 (해시 편차 여유 2배)
+  size_t per_shard =
+      std::min(std::max<size_t>((capacity_ * 2) / shard_count_, 2), capacity_);
+
+  lanes_.reserve(lane_count);
+  for (size_t l = 0; l < lane_count; ++l) {
+    auto lane = std::make_unique<Lane>();
+    lane->admission_limit = capacity_;
+    lane->shards.reserve(shard_count_);
+    for (size_t i = 0; i < shard_count_; ++i) {
+      lane->shards.push_back(
+          std::make_unique<BoundedRingBuffer<NodePtr>>(per_shard));
+    }
+    lanes_.push_back(std::move(lane));
+  }
+
+  shard_pending_.reset(new std::atomic<size_t>[shard_count_]);
+  wait_slots_.reserve(shard_count_);
+  for (size_t i = 0; i < shard_count_; ++i) {
+    shard_pending_[i].store(0, std::memory_order_relaxed);
+    wait_slots_.push_back(std::make_unique<WaitSlot>());
+  }
+}
+
+size_t ShardedIngestQueue::SetConsumerAffinity(size_t consumer_count) {
+  consumer_count = std::min(consumer_count, shard_count_);
+  affinity_consumers_.store(consumer_count);
+  // 모드 전환 시 기존 대기자가 잘못된 슬롯에 남지 않도록 모두 깨움
+  for (auto &slot : wait_slots_) {
+    std::lock_guard<std::mutex> lock(slot->mutex);
+    slot->cv.notify_all();
+  }
+  return consumer_count;
+}
+
+ShardedIngestQueue::ShardView
+ShardedIngestQueue::ViewFor(size_t consumer_index) const {
+  ShardView view;
+  size_t consumers = affinity_consumers_.load(std::memory_order_relaxed);
+  if (consumers > 0) {
+    view.first = consumer_index % consumers;
+    view.stride = consumers;
+  }
+  return view;
+}
+
+size_t ShardedIngestQueue::PendingIn(const ShardView &view) const {
+  if (view.stride == 1)
+    return size_.load();
+  size_t pending = 0;
+  for (size_t s = view.first; s < shard_count_; s += view.stride) {
+    pending += shard_pending_[s].load();
+  }
+  return pending;
+}
+
+void ShardedIngestQueue::NotifyOwner(size_t shard) {
+  size_t consumers = affinity_consumers_.load(std::memory_order_relaxed);
+  auto &slot = *wait_slots_[consumers > 0 ? shard % consumers : 0];
+  if (slot.waiters.load() > 0) {
+    std::lock_guard<std::mutex> lock(slot.mutex);
+    slot.cv.notify_one();
+  }
+}
+
+void ShardedIngestQueue::ConfigureLane(size_t lane, uint32_t weight,
+                                       size_t admission_limit) {
+  if (lane >= lanes_.size())
+    return;
+  lanes_[lane]->weight = std::max<uint32_t>(weight, 1);
+  lanes_[lane]->admission_limit =
+      std::min(std::max<size_t>(admission_limit, 1), capacity_);
+}
+
+void ShardedIngestQueue::SetLaneWaitHistogram(size_t lane,
+                                              LatencyHistogram *histogram) {
+  if (lane < lanes_.size())
+    lanes_[lane]->wait_histogram = histogram;
+}
+
+size_t ShardedIngestQueue::ShardFor(const std::string &device_id) const {
+  return std::hash<std::string>{}(device_id) % shard_count_;
+}
+
+bool ShardedIngestQueue::Push(Structs::DeviceDataMessage &&message,
+                              size_t lane_index) {
+  if (closed_.load(std::memory_order_acquire)) {
+    return false;
+  }
+
+  auto &lane = *lanes_[std::min(lane_index, lanes_.size() - 1)];
+
+  // 레인 허용 한도 + 전체 용량 예약
+  if (lane.size.fetch_add(1) >= lane.admission_limit) {
+    lane.size.fetch_sub(1);
+    lane.dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  if (size_.fetch_add(1) >= capacity_) {
+    size_.fetch_sub(1);
+    lane.size.fetch_sub(1);
+    lane.dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  const size_t shard_index = ShardFor(message.device_id);
+  auto &shard = *lane.shards[shard_index];
+  auto node = std::make_unique<Node>();
+  node->message = std::move(message);
+  node->enqueued_at = std::chrono::steady_clock::now();
+  shard_pending_[shard_index].fetch_add(1);
+  if (!shard.TryPush(std::move(node))) {
+    // 샤드 포화: 호출자가 원본을 유지하도록 되돌림
+    message = std::move(node->message);
+    shard_pending_[shard_index].fetch_sub(1);
+    size_.fetch_sub(1);
+    lane.size.fetch_sub(1);
+    lane.dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  lane.pushed.fetch_add(1, std::memory_order_relaxed);
+
+  NotifyOwner(shard_index);
+  return true;
+}
+
+size_t
+ShardedIngestQueue::DrainLane(Lane &lane, const ShardView &view,
+                              std::vector<Structs::DeviceDataMessage> &out,
+                              size_t max_items) {
+  if (max_items == 0 || lane.size.load(std::memory_order_relaxed) == 0)
+    return 0;
+
+  const size_t owned =
+      (shard_count_ - view.first + view.stride - 1) / view.stride;
+  const size_t start = lane.next_shard.fetch_add(1, std::memory_order_relaxed);
+  const auto now = std::chrono::steady_clock::now();
+  size_t taken = 0;
+  uint64_t wait_sum_us = 0;
+  uint64_t wait_max_us = 0;
+  NodePtr node;
+
+  // 한 바퀴 동안 아무것도 못 꺼내면 종료
+  bool progressed = true;
+  while (taken < max_items && progressed) {
+    progressed = false;
+    for (size_t i = 0; i < owned && taken < max_items; ++i) {
+      const size_t shard_index =
+          view.first + ((start + i) % owned) * view.stride;
+      if (lane.shards[shard_index]->TryPop(node)) {
+        shard_pending_[shard_index].fetch_sub(1);
+        uint64_t wait_us = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                now - node->enqueued_at)
+                .count());
+        wait_sum_us += wait_us;
+        wait_max_us = std::max(wait_max_us, wait_us);
+        if (lane.wait_histogram)
+          lane.wait_histogram->Record(wait_us);
+        out.push_back(std::move(node->message));
+        node.reset();
+        ++taken;
+        progressed = true;
+      }
+    }
+  }
+
+  if (taken > 0) {
+    lane.size.fetch_sub(taken);
+    lane.popped.fetch_add(taken, std::memory_order_relaxed);
+    lane.total_wait_us.fetch_add(wait_sum_us, std::memory_order_relaxed);
+    uint64_t prev = lane.max_wait_us.load(std::memory_order_relaxed);
+    while (wait_max_us > prev &&
+           !lane.max_wait_us.compare_exchange_weak(prev, wait_max_us)) {
+    }
+  }
+  return taken;
+}
+
+size_t ShardedIngestQueue::DrainInto(
+    const ShardView &view, std::vector<Structs::DeviceDataMessage> &out,
+    size_t max_items) {
+  size_t taken = 0;
+
+  if (lanes_.size() > 1 && policy_.load() == LaneDequeuePolicy::WEIGHTED) {
+    // 1차: 비어 있지 않은 레인끼리 가중치 비율로 몫 배분
+    uint64_t total_weight = 0;
+    for (const auto &lane : lanes_) {
+      if (lane->size.load(std::memory_order_relaxed) > 0)
+        total_weight += lane->weight;
+    }
+    if (total_weight > 0) {
+      for (auto &lane : lanes_) {
+        if (taken >= max_items)
+          break;
+        if (lane->size.load(std::memory_order_relaxed) == 0)
+          continue;
+        size_t quota = std::max<size_t>(
+            static_cast<size_t>(max_items * lane->weight / total_weight), 1);
+        taken +=
+            DrainLane(*lane, view, out, std::min(quota, max_items - taken));
+      }
+    }
+  }
+
+  // STRICT (또는 WEIGHTED 2차): 남은 자리를 상위 레인부터 채움
+  for (auto &lane : lanes_) {
+    if (taken >= max_items)
+      break;
+    taken += DrainLane(*lane, view, out, max_items - taken);
+  }
+
+  if (taken > 0) {
+    size_.fetch_sub(taken);
+  }
+  return taken;
+}
+
+size_t
+ShardedIngestQueue::PopBatch(std::vector<Structs::DeviceDataMessage> &out,
+                             size_t max_items,
+                             std::chrono::milliseconds timeout) {
+  return PopBatchFor(0, out, max_items, timeout);
+}
+
+size_t
+ShardedIngestQueue::DrainAll(std::vector<Structs::DeviceDataMessage> &out,
+                             size_t max_items) {
+  return max_items == 0 ? 0 : DrainInto(ShardView{}, out, max_items);
+}
+
+size_t
+ShardedIngestQueue::PopBatchFor(size_t consumer_index,
+                                std::vector<Structs::DeviceDataMessage> &out,
+                                size_t max_items,
+                                std::chrono::milliseconds timeout) {
+  if (max_items == 0)
+    return 0;
+
+  const ShardView view = ViewFor(consumer_index);
+  size_t taken = DrainInto(view, out, max_items);
+  if (taken > 0 || timeout.count() <= 0) {
+    return taken;
+  }
+
+  auto &slot = *wait_slots_[view.stride > 1 ? view.first : 0];
+  slot.waiters.fetch_add(1);
+  {
+    std::unique_lock<std::mutex> lock(slot.mutex);
+    slot.cv.wait_for(lock, timeout, [this, &view] {
+      return PendingIn(view) > 0 || closed_.load(std::memory_order_acquire);
+    });
+  }
+  slot.waiters.fetch_sub(1);
+
+  return DrainInto(view, out, max_items);
+}
+
+void ShardedIngestQueue::Close() {
+  closed_.store(true, std::memory_order_release);
+  for (auto &slot : wait_slots_) {
+    std::lock_guard<std::mutex> lock(slot->mutex);
+    slot->cv.notify_all();
+  }
+}
+
+void ShardedIngestQueue::Open() {
+  closed_.store(false, std::memory_order_release);
+}
+
+size_t ShardedIngestQueue::Clear() {
+  size_t cleared = 0;
+  NodePtr node;
+  for (auto &lane : lanes_) {
+    size_t lane_cleared = 0;
+    for (size_t i = 0; i < shard_count_; ++i) {
+      while (lane->shards[i]->TryPop(node)) {
+        node.reset();
+        shard_pending_[i].fetch_sub(1);
+        ++lane_cleared;
+      }
+    }
+    if (lane_cleared > 0) {
+      lane->size.fetch_sub(lane_cleared);
+      cleared += lane_cleared;
+    }
+  }
+  if (cleared > 0) {
+    size_.fetch_sub(cleared);
+  }
+  return cleared;
+}
+
+IngestLaneStats ShardedIngestQueue::GetLaneStats(size_t lane_index) const {
+  IngestLaneStats stats;
+  if (lane_index >= lanes_.size())
+    return stats;
+
+  const auto &lane = *lanes_[lane_index];
+  stats.depth = lane.size.load(std::memory_order_relaxed);
+  stats.admission_limit = lane.admission_limit;
+  stats.weight = lane.weight;
+  stats.pushed = lane.pushed.load(std::memory_order_relaxed);
+  stats.popped = lane.popped.load(std::memory_order_relaxed);
+  stats.dropped = lane.dropped.load(std::memory_order_relaxed);
+  if (stats.popped > 0) {
+    stats.avg_wait_ms =
+        static_cast<double>(lane.total_wait_us.load()) / stats.popped / 1000.0;
+  }
+  stats.max_wait_ms = static_cast<double>(lane.max_wait_us.load()) / 1000.0;
+  return stats;
+}
+
+void ShardedIngestQueue::ResetLaneStats() {
+  for (auto &lane : lanes_) {
+    lane->pushed = 0;
+    lane->popped = 0;
+    lane->dropped = 0;
+    lane->total_wait_us = 0;
+    lane->max_wait_us = 0;
+  }
+}
+
+} // namespace Pipeline
+} // namespace PulseOne
@@ -26,12 +26,12 @@ bool AlarmStage::Process(PipelineContext &context) {
     LogManager::getInstance().log(
         "alarm", PulseOne::Enums::LogLevel::DEBUG,
         "AlarmStage: Processing for Tenant " +
-            std::to_string(context.enriched_message.tenant_id) + ", Device " +
-            context.enriched_message.device_id + ", Points: " +
-            std::to_string(context.enriched_message.points.size()));
+            std::to_string(context.message.tenant_id) + ", Device " +
+            context.message.device_id + ", Points: " +
+            std::to_string(context.message.points.size()));
 
     auto alarm_events =
-        alarm_manager.evaluateForMessage(context.enriched_message);
+        alarm_manager.evaluateForMessage(context.message);
 
     if (!alarm_events.empty()) {
       LogManager::getInstance().Info("AlarmStage: Generated " +
@@ -51,4 +51,69 @@ bool AlarmStage::Process(PipelineContext &context) {
   return true;
 }
 
+void AlarmStage::ProcessBatch(std::vector<PipelineContext> &batch) {
+  auto &alarm_manager = PulseOne::Alarm::AlarmManager::getInstance();
+  if (!alarm_manager.isInitialized()) {
+    LogManager::getInstance().Error("AlarmStage: AlarmManager not initialized");
+    return;
+  }
+
+  std::vector<PipelineContext *> targets;
+  std::vector<const Structs::DeviceDataMessage *> messages;
+  targets.reserve(batch.size());
+  messages.reserve(batch.size());
+  for (auto &context : batch) {
+    if (context.halted || !context.should_evaluate_alarms)
+      continue;
+    targets.push_back(&context);
+    messages.push_back(&context.message);
+  }
+  if (messages.empty())
+    return;
+
+  std::vector<std::vector<PulseOne::Alarm::AlarmEvent>> results;
+  try {
+    results = alarm_manager.evaluateForMessages(messages);
+  } catch (const std::exception &e) {
+    // 배치 평가 실패 - 메시지별로 다시 평가해 문제 메시지만 건너뜀
+    LogManager::getInstance().Error("AlarmStage batch Error, retrying per "
+                                    "message: " +
+                                    std::string(e.what()));
+    results.assign(messages.size(), {});
+    for (size_t i = 0; i < messages.size(); ++i) {
+      try {
+        auto one = alarm_manager.evaluateForMessages({messages[i]});
+        if (!one.empty())
+          results[i] = std::move(one.front());
+      } catch (const std::exception &one_error) {
+        targets[i]->error_message =
+            "AlarmStage Error: " + std::string(one_error.what());
+        LogManager::getInstance().Error(targets[i]->error_message +
+                                        " (device=" + messages[i]->device_id +
+                                        ")");
+      }
+    }
+  }
+
+  try {
+    size_t total = 0;
+    for (size_t i = 0; i < targets.size() && i < results.size(); ++i) {
+      if (results[i].empty())
+        continue;
+      targets[i]->stats.alarms_triggered = results[i].size();
+      targets[i]->alarm_events = std::move(results[i]);
+      total += targets[i]->alarm_events.size();
+    }
+    if (total > 0) {
+      LogManager::getInstance().Info("AlarmStage: Generated " +
+                                     std::to_string(total) +
+                                     " alarm events for batch of " +
+                                     std::to_string(messages.size()));
+    }
+  } catch (const std::exception &e) {
+    LogManager::getInstance().Error("AlarmStage Error: " +
+                                    std::string(e.what()));
+  }
+}
+
 } // namespace PulseOne::Pipeline::Stages
@@ -0,0 +1,271 @@
+#include "Pipeline/Stages/DeadbandStage.h"
+#include "Database/Repositories/DataPointRepository.h"
+#include "Database/RepositoryFactory.h"
+#include "Logging/LogManager.h"
+#include "Pipeline/PipelineContext.h"
+#include "Pipeline/PointMetadataRegistry.h"
+#include "Utils/ConfigManager.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace PulseOne::Pipeline::Stages {
+
+namespace {
+
+int64_t SteadyNowMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// bool and string values have no meaningful distance, so they are compared by
+// hash instead
+bool ToNumeric(const Structs::DataValue &value, double &out) {
+  return std::visit(
+      [&out](const auto &val) -> bool {
+        using T = std::decay_t<decltype(val)>;
+        if constexpr (std::is_same_v<T, std::string> ||
+                      std::is_same_v<T, bool>) {
+          return false;
+        } else {
+          out = static_cast<double>(val);
+          return true;
+        }
+      },
+      value);
+}
+
+size_t HashValue(const Structs::DataValue &value) {
+  return std::visit(
+      [](const auto &val) -> size_t {
+        using T = std::decay_t<decltype(val)>;
+        return std::hash<T>{}(val);
+      },
+      value);
+}
+
+} // namespace
+
+DeadbandStage::DeadbandStage() { LoadConfiguration(); }
+
+DeadbandStage::~DeadbandStage() {
+  std::lock_guard<std::mutex> lock(reload_mutex_);
+  if (reload_task_.valid())
+    reload_task_.wait();
+}
+
+size_t DeadbandStage::LoadConfiguration() {
+  // Taken before reading so a change during the load triggers another one
+  loaded_generation_.store(PointMetadataRegistry::getInstance().Generation());
+
+  auto &config = ConfigManager::getInstance();
+  const bool enabled = config.getBool("PIPELINE_DEADBAND_ENABLED", false);
+  const double percent =
+      std::max(config.getDouble("PIPELINE_DEADBAND_PERCENT", 0.0), 0.0);
+  const int64_t default_heartbeat_ms =
+      static_cast<int64_t>(
+          std::max(config.getInt("PIPELINE_DEADBAND_HEARTBEAT_SEC", 60), 0)) *
+      1000;
+
+  if (!enabled) {
+    enabled_.store(false);
+    LogManager::getInstance().Info("DeadbandStage: disabled");
+    return 0;
+  }
+
+  // Built completely before it is published, so no thread ever sees a
+  // half-loaded table. Points that were deleted or had logging turned off
+  // are simply absent from the new table.
+  auto table = std::make_shared<ConfigTable>();
+  table->percent_deadband = percent;
+  size_t configured = 0;
+  try {
+    auto repo =
+        Database::RepositoryFactory::getInstance().getDataPointRepository();
+    if (!repo)
+      throw std::runtime_error("DataPoint repository unavailable");
+
+    auto &registry = PointIndexRegistry::getInstance();
+    const auto entities = repo->findAll();
+    for (const auto &entity : entities) {
+      if (!entity.isLogEnabled())
+        continue;
+      const uint32_t index = registry.Acquire(entity.getId());
+      if (index == PointIndexRegistry::INVALID_INDEX)
+        continue;
+      if (index >= table->points.size())
+        table->points.resize(index + 1);
+
+      const double span = entity.getMaxValue() - entity.getMinValue();
+      auto &point = table->points[index];
+      point.configured = true;
+      point.exact_change_only = entity.isAlarmEnabled();
+      point.absolute_deadband = std::max(entity.getLogDeadband(), 0.0);
+      point.span = std::isfinite(span) && span > 0.0 ? span : 0.0;
+      point.heartbeat_ms = entity.getLogInterval() > 0
+                               ? static_cast<int64_t>(entity.getLogInterval())
+                               : default_heartbeat_ms;
+      ++configured;
+    }
+  } catch (const std::exception &e) {
+    const bool has_previous = GetConfig() != nullptr;
+    LogManager::getInstance().Warn(
+        "DeadbandStage: failed to load data point settings, " +
+        std::string(has_previous ? "keeping previous settings: "
+                                 : "passing all samples through: ") +
+        e.what());
+    if (!has_previous)
+      enabled_.store(false);
+    return 0;
+  }
+
+  std::atomic_store_explicit(&config_,
+                             std::shared_ptr<const ConfigTable>(std::move(table)),
+                             std::memory_order_release);
+  enabled_.store(true);
+  LogManager::getInstance().Info(
+      "DeadbandStage: " + std::to_string(configured) +
+      " points filtered (percent=" + std::to_string(percent) +
+      ", heartbeat=" + std::to_string(default_heartbeat_ms / 1000) + "s)");
+  return configured;
+}
+
+bool DeadbandStage::ShouldReport(const ConfigTable &config,
+                                 const Structs::TimestampedValue &point,
+                                 int64_t now_ms) {
+  if (point.is_virtual_point)
+    return true;
+
+  const uint32_t index = PointIndexRegistry::getInstance().IndexOf(point.point_id);
+  if (index == PointIndexRegistry::INVALID_INDEX)
+    return true;
+  const PointConfig *settings = config.Find(index);
+  if (!settings)
+    return true;
+
+  double numeric = 0.0;
+  const bool is_numeric = ToNumeric(point.value, numeric);
+  const size_t hash = is_numeric ? 0 : HashValue(point.value);
+  const auto quality = static_cast<uint8_t>(point.quality);
+
+  std::lock_guard<std::mutex> lock(StripeFor(index));
+  auto &state = states_.At(index);
+
+  bool report = !state.has_last || quality != state.last_quality ||
+                is_numeric != state.last_numeric;
+  if (!report) {
+    if (!is_numeric) {
+      report = hash != state.last_hash;
+    } else if (std::isnan(numeric) || std::isnan(state.last_value)) {
+      report = std::isnan(numeric) != std::isnan(state.last_value);
+    } else {
+      double deadband = 0.0;
+      if (!settings->exact_change_only) {
+        const double base =
+            settings->span > 0.0 ? settings->span : std::fabs(state.last_value);
+        deadband = std::max(settings->absolute_deadband,
+                            base * config.percent_deadband / 100.0);
+      }
+      const double delta = std::fabs(numeric - state.last_value);
+      report = deadband > 0.0 ? delta > deadband : delta != 0.0;
+    }
+  }
+
+  if (!report && settings->heartbeat_ms > 0 &&
+      now_ms - state.last_report_ms >= settings->heartbeat_ms) {
+    report = true;
+    heartbeats_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  if (report) {
+    state.has_last = true;
+    state.last_numeric = is_numeric;
+    state.last_value = numeric;
+    state.last_hash = hash;
+    state.last_quality = quality;
+    state.last_report_ms = now_ms;
+  }
+  return report;
+}
+
+size_t DeadbandStage::FilterContext(const ConfigTable &config,
+                                    PipelineContext &context, int64_t now_ms) {
+  const size_t before = context.OriginalPoints().size();
+  const size_t removed = context.RemoveOriginalPointsIf(
+      [this, &config, now_ms](const Structs::TimestampedValue &point) {
+        return !ShouldReport(config, point, now_ms);
+      });
+  context.stats.points_suppressed += static_cast<int>(removed);
+  passed_.fetch_add(before - removed, std::memory_order_relaxed);
+  suppressed_.fetch_add(removed, std::memory_order_relaxed);
+  return removed;
+}
+
+bool DeadbandStage::Process(PipelineContext &context) {
+  ReloadIfChanged();
+  const auto config = GetConfig();
+  if (!IsEnabled() || !config)
+    return true;
+
+  try {
+    FilterContext(*config, context, SteadyNowMs());
+  } catch (const std::exception &e) {
+    LogManager::getInstance().Error("DeadbandStage Error: " +
+                                    std::string(e.what()));
+  }
+  return true;
+}
+
+void DeadbandStage::ReloadIfChanged() {
+  if (PointMetadataRegistry::getInstance().Generation() ==
+      loaded_generation_.load())
+    return;
+  std::unique_lock<std::mutex> lock(reload_mutex_, std::try_to_lock);
+  if (!lock.owns_lock())
+    return;
+  // One reload in flight at a time; a bump during it is picked up next call
+  if (reload_task_.valid() &&
+      reload_task_.wait_for(std::chrono::seconds(0)) !=
+          std::future_status::ready)
+    return;
+  if (PointMetadataRegistry::getInstance().Generation() ==
+      loaded_generation_.load())
+    return;
+  reload_task_ =
+      std::async(std::launch::async, [this] { return LoadConfiguration(); });
+}
+
+void DeadbandStage::ProcessBatch(std::vector<PipelineContext> &batch) {
+  ReloadIfChanged();
+  // One snapshot for the whole batch; a reload publishes a new table without
+  // touching this one
+  const auto config = GetConfig();
+  if (!IsEnabled() || !config)
+    return;
+
+  const int64_t now_ms = SteadyNowMs();
+  size_t removed = 0;
+  for (auto &context : batch) {
+    if (context.halted)
+      continue;
+    try {
+      removed += FilterContext(*config, context, now_ms);
+    } catch (const std::exception &e) {
+      LogManager::getInstance().Error("DeadbandStage Error: " +
+                                      std::string(e.what()));
+    }
+  }
+
+  if (removed > 0) {
+    LogManager::getInstance().log(
+        "DeadbandStage", Enums::LogLevel::DEBUG_LEVEL,
+        "Suppressed " + std::to_string(removed) +
+            " unchanged samples in batch of " + std::to_string(batch.size()) +
+            " messages");
+  }
+}
+
+} // namespace PulseOne::Pipeline::Stages
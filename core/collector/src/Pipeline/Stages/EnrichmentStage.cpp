@@ -26,12 +26,9 @@ bool EnrichmentStage::Process(PipelineContext& context) {
             return true;
         }
 
-        // Enrich the message
-        for (const auto& vp : vp_results) {
-            context.enriched_message.points.push_back(vp);
-        }
-        
-        context.stats.virtual_points_added = vp_results.size();
+        // Enrich the message (append-only, originals are not copied)
+        const size_t vp_count = vp_results.size();
+        context.AppendVirtualPoints(std::move(vp_results));
         
         // Asynchronous Queueing for Virtual Point Batch Writer (persistence/logging side effect)
         // Original code did this in CalculateVirtualPoints.
@@ -44,7 +41,7 @@ bool EnrichmentStage::Process(PipelineContext& context) {
         // Let's stick to simple calculation here.
         
         LogManager::getInstance().log("EnrichmentStage", Enums::LogLevel::DEBUG_LEVEL, 
-            "Enriched message with " + std::to_string(vp_results.size()) + " virtual points.");
+            "Enriched message with " + std::to_string(vp_count) + " virtual points.");
 
     } catch (const std::exception& e) {
         context.error_message = "Enrichment Error: " + std::string(e.what());
@@ -54,4 +51,35 @@ bool EnrichmentStage::Process(PipelineContext& context) {
     return true;
 }
 
+void EnrichmentStage::ProcessBatch(std::vector<PipelineContext>& batch) {
+    auto& vp_engine = VirtualPoint::VirtualPointEngine::getInstance();
+    if (!vp_engine.isInitialized()) {
+        return;
+    }
+
+    size_t total_added = 0;
+    for (auto& context : batch) {
+        if (context.halted) {
+            continue;
+        }
+        try {
+            auto vp_results = vp_engine.calculateForMessage(context.message);
+            if (vp_results.empty()) {
+                continue;
+            }
+            total_added += vp_results.size();
+            context.AppendVirtualPoints(std::move(vp_results));
+        } catch (const std::exception& e) {
+            context.error_message = "Enrichment Error: " + std::string(e.what());
+            LogManager::getInstance().Error(context.error_message);
+        }
+    }
+
+    if (total_added > 0) {
+        LogManager::getInstance().log("EnrichmentStage", Enums::LogLevel::DEBUG_LEVEL,
+            "Enriched batch of " + std::to_string(batch.size()) + " messages with " +
+            std::to_string(total_added) + " virtual points.");
+    }
+}
+
 } // namespace PulseOne::Pipeline::Stages
@@ -3,9 +3,13 @@
 #include "Logging/LogManager.h"
 #include "Pipeline/IPersistenceQueue.h"
 #include "Pipeline/PipelineContext.h"
+#include "Pipeline/PipelineMetrics.h"
 #include "Storage/BackendFormat.h" // Added for AlarmEventData
 #include "Storage/RedisDataWriter.h"
+#include <algorithm>
+#include <chrono>
 #include <nlohmann/json.hpp>
+#include <unordered_map>
 
 using json = nlohmann::json;
 
@@ -25,95 +29,47 @@ bool PersistenceStage::Process(PipelineContext &context) {
     if (redis_writer_) {
       LogManager::getInstance().Info(
           "[Persistence] Saving Message - DeviceID: " +
-          context.enriched_message.device_id + ", Points: " +
-          std::to_string(context.enriched_message.points.size()));
-      if (!context.enriched_message.points.empty()) {
+          context.message.device_id + ", Points: " +
+          std::to_string(context.message.points.size()));
+      if (!context.message.points.empty()) {
         LogManager::getInstance().Info(
             "[Persistence] First Point Value: " +
             PulseOne::Utils::DataVariantToString(
-                context.enriched_message.points[0].value));
+                context.message.points[0].value));
       }
 
-      size_t saved = redis_writer_->SaveDeviceMessage(context.enriched_message);
+      auto write_start = std::chrono::steady_clock::now();
+      size_t saved = redis_writer_->SaveDeviceMessage(context.message);
+      PipelineMetrics::getInstance().Record(
+          PipelineMetrics::REDIS_WRITE, "device_message",
+          std::chrono::steady_clock::now() - write_start);
       if (saved > 0)
         context.stats.persisted_to_redis = true;
 
       // Save Virtual Points specifically (for E2E and individual access)
-      for (const auto &point : context.enriched_message.points) {
-        if (point.is_virtual_point) {
-          redis_writer_->StoreVirtualPointToRedis(point);
-        }
+      for (const auto &point : context.VirtualPoints()) {
+        redis_writer_->StoreVirtualPointToRedis(point);
       }
 
       // Save Alarms to Redis
-      for (const auto &alarm : context.alarm_events) {
-        PulseOne::Storage::BackendFormat::AlarmEventData alarm_data;
-        alarm_data.rule_id = alarm.rule_id;
-        alarm_data.tenant_id = alarm.tenant_id;
-        alarm_data.site_id = alarm.site_id; // Added site_id population
-        alarm_data.device_id =
-            alarm.device_id; // AlarmEngine이 std::to_string(device_id)로 세팅
-        alarm_data.point_id = alarm.point_id;
-        alarm_data.state = alarm.getStateString();
-        alarm_data.severity = alarm.getSeverityString();
-        alarm_data.message = alarm.message;
-        alarm_data.trigger_value = alarm.getTriggerValueString();
-        alarm_data.timestamp =
-            std::chrono::duration_cast<std::chrono::milliseconds>(
-                alarm.timestamp.time_since_epoch())
-                .count();
-        alarm_data.source_name = alarm.source_name;
-        alarm_data.location = alarm.location;
-        alarm_data.extra_info =
-            alarm.extra_info; // 🔥 메타데이터(file_ref 등) 전파
-
-        if (alarm.extra_info.contains("file_ref")) {
-          LogManager::getInstance().Info(
-              "[v3.2.0 Debug] Metadata 'file_ref' detected: " +
-              alarm.extra_info["file_ref"].get<std::string>());
-        }
-
-        LogManager::getInstance().Info(
-            "[v3.2.0 Debug] [Persistence] Publishing Alarm Event: " +
-            alarm_data.message +
-            " [Extra Keys: " + alarm_data.extra_info.dump() + "]");
-
-        redis_writer_->PublishAlarmEvent(alarm_data);
-      }
+      PublishAlarms(context);
 
       // ✅ Fix: Save Worker Status to Redis (for Green/Red lamp in UI)
-      std::string worker_status = "error";
-      if (context.enriched_message.device_status ==
-          PulseOne::Enums::DeviceStatus::ONLINE) {
-        worker_status = "running";
-      } else if (context.enriched_message.device_status ==
-                 PulseOne::Enums::DeviceStatus::OFFLINE) {
-        worker_status = "stopped";
-      }
-
-      json metadata;
-      metadata["protocol"] = context.enriched_message.protocol;
-      metadata["last_updated"] =
-          std::chrono::duration_cast<std::chrono::milliseconds>(
-              context.enriched_message.timestamp.time_since_epoch())
-              .count();
-
-      redis_writer_->SaveWorkerStatus(context.enriched_message.device_id,
-                                      worker_status, metadata);
+      SaveWorkerStatus(context.message);
     }
 
     // 2. Queue for RDB and InfluxDB (Asynchronous)
     if (persistence_queue_) {
       // RDB Task
-      persistence_queue_->QueueRDBTask(context.enriched_message,
-                                       context.enriched_message.points);
+      persistence_queue_->QueueRDBTask(context.message,
+                                       context.message.points);
 
       // InfluxDB Task
-      persistence_queue_->QueueInfluxTask(context.enriched_message,
-                                          context.enriched_message.points);
+      persistence_queue_->QueueInfluxTask(context.message,
+                                          context.message.points);
 
       // Comm Stats Task
-      persistence_queue_->QueueCommStatsTask(context.enriched_message);
+      persistence_queue_->QueueCommStatsTask(context.message);
     }
 
     return true;
@@ -125,4 +81,188 @@ bool PersistenceStage::Process(PipelineContext &context) {
   }
 }
 
+void PersistenceStage::PublishAlarms(const PipelineContext &context) {
+  for (const auto &alarm : context.alarm_events) {
+    PulseOne::Storage::BackendFormat::AlarmEventData alarm_data;
+    alarm_data.rule_id = alarm.rule_id;
+    alarm_data.tenant_id = alarm.tenant_id;
+    alarm_data.site_id = alarm.site_id; // Added site_id population
+    alarm_data.device_id =
+        alarm.device_id; // AlarmEngine이 std::to_string(device_id)로 세팅
+    alarm_data.point_id = alarm.point_id;
+    alarm_data.state = alarm.getStateString();
+    alarm_data.severity = alarm.getSeverityString();
+    alarm_data.message = alarm.message;
+    alarm_data.trigger_value = alarm.getTriggerValueString();
+    alarm_data.timestamp =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            alarm.timestamp.time_since_epoch())
+            .count();
+    alarm_data.source_name = alarm.source_name;
+    alarm_data.location = alarm.location;
+    alarm_data.extra_info =
+        alarm.extra_info; // 🔥 메타데이터(file_ref 등) 전파
+
+    if (alarm.extra_info.contains("file_ref")) {
+      LogManager::getInstance().Info(
+          "[v3.2.0 Debug] Metadata 'file_ref' detected: " +
+          alarm.extra_info["file_ref"].get<std::string>());
+    }
+
+    LogManager::getInstance().Info(
+        "[v3.2.0 Debug] [Persistence] Publishing Alarm Event: " +
+        alarm_data.message +
+        " [Extra Keys: " + alarm_data.extra_info.dump() + "]");
+
+    redis_writer_->PublishAlarmEvent(alarm_data);
+  }
+}
+
+void PersistenceStage::SaveWorkerStatus(
+    const Structs::DeviceDataMessage &message) {
+  std::string worker_status = "error";
+  if (message.device_status == PulseOne::Enums::DeviceStatus::ONLINE) {
+    worker_status = "running";
+  } else if (message.device_status == PulseOne::Enums::DeviceStatus::OFFLINE) {
+    worker_status = "stopped";
+  }
+
+  json metadata;
+  metadata["protocol"] = message.protocol;
+  metadata["last_updated"] =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          message.timestamp.time_since_epoch())
+          .count();
+
+  redis_writer_->SaveWorkerStatus(message.device_id, worker_status, metadata);
+}
+
+void PersistenceStage::FailContext(PipelineContext &context,
+                                   const std::string &step,
+                                   const std::exception &e) {
+  context.error_message = "Persistence " + step + " Error: " +
+                          std::string(e.what());
+  context.halted = true;
+  context.failed = true;
+  LogManager::getInstance().log("PersistenceStage", LogLevel::LOG_ERROR,
+                                context.error_message + " (device=" +
+                                    context.message.device_id + ")");
+}
+
+void PersistenceStage::ProcessBatch(std::vector<PipelineContext> &batch) {
+  std::vector<PipelineContext *> targets;
+  std::vector<const Structs::DeviceDataMessage *> messages;
+  targets.reserve(batch.size());
+  messages.reserve(batch.size());
+  for (auto &context : batch) {
+    if (context.halted || !context.should_persist)
+      continue;
+    targets.push_back(&context);
+    messages.push_back(&context.message);
+  }
+  if (messages.empty())
+    return;
+
+  // 1. Redis (Synchronous) - one lock for the whole batch, later values of
+  // the same point overwrite earlier ones so only the last is written
+  if (redis_writer_) {
+    auto write_start = std::chrono::steady_clock::now();
+    size_t saved = 0;
+    try {
+      saved = redis_writer_->SaveDeviceMessages(messages);
+      if (saved > 0) {
+        for (auto *context : targets)
+          context->stats.persisted_to_redis = true;
+      }
+    } catch (const std::exception &e) {
+      // 배치 쓰기 실패 - 메시지별로 다시 써서 문제 메시지만 걸러냄
+      LogManager::getInstance().log("PersistenceStage", LogLevel::WARN,
+                                    "Redis 배치 저장 실패, 메시지별 재시도: " +
+                                        std::string(e.what()));
+      for (size_t i = 0; i < targets.size(); ++i) {
+        try {
+          const size_t one = redis_writer_->SaveDeviceMessages({messages[i]});
+          saved += one;
+          if (one > 0)
+            targets[i]->stats.persisted_to_redis = true;
+        } catch (const std::exception &one_error) {
+          FailContext(*targets[i], "Redis", one_error);
+        }
+      }
+    }
+    PipelineMetrics::getInstance().Record(
+        PipelineMetrics::REDIS_WRITE, "device_batch",
+        std::chrono::steady_clock::now() - write_start);
+
+    // 알람/가상포인트/상태는 캐시 부가정보 - 실패해도 저장은 계속
+    std::unordered_map<int, const Structs::TimestampedValue *> latest_vps;
+    std::unordered_map<std::string, const Structs::DeviceDataMessage *>
+        latest_status;
+    for (auto *context : targets) {
+      if (context->failed)
+        continue;
+      for (const auto &point : context->VirtualPoints()) {
+        latest_vps[point.point_id] = &point;
+      }
+      latest_status[context->message.device_id] = &context->message;
+      try {
+        PublishAlarms(*context);
+      } catch (const std::exception &e) {
+        LogManager::getInstance().log(
+            "PersistenceStage", LogLevel::LOG_ERROR,
+            "알람 발행 실패 (device=" + context->message.device_id +
+                "): " + std::string(e.what()));
+      }
+    }
+    try {
+      for (const auto &[point_id, point] : latest_vps) {
+        redis_writer_->StoreVirtualPointToRedis(*point);
+      }
+      for (const auto &[device_id, message] : latest_status) {
+        SaveWorkerStatus(*message);
+      }
+    } catch (const std::exception &e) {
+      LogManager::getInstance().log("PersistenceStage", LogLevel::LOG_ERROR,
+                                    "가상포인트/상태 캐시 저장 실패: " +
+                                        std::string(e.what()));
+    }
+
+    LogManager::getInstance().log(
+        "PersistenceStage", LogLevel::DEBUG_LEVEL,
+        "[Persistence] Saved batch - Messages: " +
+            std::to_string(messages.size()) +
+            ", Redis keys: " + std::to_string(saved));
+  }
+
+  // 2. Queue for RDB and InfluxDB (Asynchronous) - single enqueue
+  if (persistence_queue_) {
+    targets.erase(std::remove_if(targets.begin(), targets.end(),
+                                 [](const PipelineContext *context) {
+                                   return context->failed;
+                                 }),
+                  targets.end());
+    messages.clear();
+    for (auto *context : targets)
+      messages.push_back(&context->message);
+    if (messages.empty())
+      return;
+
+    try {
+      persistence_queue_->QueueBatch(messages);
+    } catch (const std::exception &e) {
+      // 태스크 생성 중 실패는 큐에 넣기 전이므로 메시지별로 다시 넣어도 중복 없음
+      LogManager::getInstance().log("PersistenceStage", LogLevel::WARN,
+                                    "저장 큐 배치 투입 실패, 메시지별 재시도: " +
+                                        std::string(e.what()));
+      for (size_t i = 0; i < targets.size(); ++i) {
+        try {
+          persistence_queue_->QueueBatch({messages[i]});
+        } catch (const std::exception &one_error) {
+          FailContext(*targets[i], "Queue", one_error);
+        }
+      }
+    }
+  }
+}
+
 } // namespace PulseOne::Pipeline::Stages
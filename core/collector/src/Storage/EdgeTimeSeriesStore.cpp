@@ -0,0 +1,867 @@
+// =============================================================================
+// collector/src/Storage/EdgeTimeSeriesStore.cpp - 내장 엣지 시계열 저장소
+// =============================================================================
+
+#include "Storage/EdgeTimeSeriesStore.h"
+#include "Logging/LogManager.h"
+#include "Utils/ConfigManager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace PulseOne {
+namespace Storage {
+
+namespace {
+
+constexpr uint32_t CHUNK_MAGIC = 0x43535450; // "PTSC"
+constexpr uint32_t INDEX_MAGIC = 0x49535450; // "PTSI"
+constexpr uint32_t INDEX_VERSION = 1;
+constexpr uint32_t MAX_PAYLOAD_BYTES = 16 * 1024 * 1024;
+
+struct ChunkHeader {
+  uint32_t magic;
+  int32_t point_id;
+  uint32_t count;
+  uint32_t bit_count;
+  int64_t t_min;
+  int64_t t_max;
+  uint32_t payload_len;
+  uint32_t checksum;
+};
+static_assert(sizeof(ChunkHeader) == 40, "chunk header layout");
+
+struct IndexHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t count;
+  uint32_t checksum;
+  uint32_t reserved;
+};
+static_assert(sizeof(IndexHeader) == 24, "index header layout");
+
+uint32_t Fnv1a(const void *data, size_t size, uint32_t hash = 2166136261u) {
+  const auto *p = static_cast<const uint8_t *>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= p[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+int64_t AlignDown(int64_t ms, int64_t width) {
+  int64_t start = ms - ms % width;
+  if (ms < 0 && ms % width != 0)
+    start -= width;
+  return start;
+}
+
+std::string PartitionFileName(int64_t start_ms, const char *ext) {
+  char name[48];
+  std::snprintf(name, sizeof(name), "p%lld.%s",
+                static_cast<long long>(start_ms), ext);
+  return name;
+}
+
+uint64_t FileSize(const std::string &path) {
+  std::error_code ec;
+  const uint64_t size = std::filesystem::file_size(path, ec);
+  return ec ? 0 : size;
+}
+
+} // namespace
+
+// =============================================================================
+// 설정
+// =============================================================================
+
+EdgeTsdbOptions EdgeTsdbOptions::FromConfig() {
+  auto &config = ConfigManager::getInstance();
+  EdgeTsdbOptions options;
+
+  options.enabled = config.getBool("EDGE_TSDB_ENABLED", false);
+  options.directory = config.getOrDefault("EDGE_TSDB_DIR", "./data/tsdb");
+  options.partition_minutes =
+      std::clamp(config.getInt("EDGE_TSDB_PARTITION_MINUTES", 60), 1, 24 * 60);
+  options.chunk_max_samples = static_cast<uint32_t>(
+      std::clamp(config.getInt("EDGE_TSDB_CHUNK_SAMPLES", 512), 16, 65535));
+  options.chunk_max_age_s =
+      std::max(config.getInt("EDGE_TSDB_CHUNK_MAX_AGE_SEC", 600), 1);
+  options.late_grace_s =
+      std::max(config.getInt("EDGE_TSDB_LATE_GRACE_SEC", 300), 0);
+  options.max_future_s =
+      std::max(config.getInt("EDGE_TSDB_MAX_FUTURE_SEC", 300), 0);
+  options.max_open_bytes =
+      static_cast<uint64_t>(
+          std::max(config.getInt("EDGE_TSDB_MAX_OPEN_MB", 32), 1)) *
+      1024 * 1024;
+  options.write_buffer_bytes =
+      static_cast<uint64_t>(
+          std::max(config.getInt("EDGE_TSDB_WRITE_BUFFER_KB", 256), 4)) *
+      1024;
+  options.retention_hours =
+      std::max(config.getInt("EDGE_TSDB_RETENTION_HOURS", 24 * 30), 0);
+  options.max_disk_bytes =
+      static_cast<uint64_t>(
+          std::max(config.getInt("EDGE_TSDB_MAX_DISK_MB", 2048), 0)) *
+      1024 * 1024;
+  options.maintenance_interval_s =
+      std::max(config.getInt("EDGE_TSDB_MAINTENANCE_SEC", 5), 1);
+  return options;
+}
+
+// =============================================================================
+// 수명 주기
+// =============================================================================
+
+EdgeTimeSeriesStore &EdgeTimeSeriesStore::getInstance() {
+  static EdgeTimeSeriesStore instance;
+  return instance;
+}
+
+EdgeTimeSeriesStore::~EdgeTimeSeriesStore() { Close(); }
+
+int64_t EdgeTimeSeriesStore::PartitionWidthMs() const {
+  return static_cast<int64_t>(options_.partition_minutes) * 60 * 1000;
+}
+
+int64_t EdgeTimeSeriesStore::PartitionStart(int64_t timestamp_ms) const {
+  return AlignDown(timestamp_ms, PartitionWidthMs());
+}
+
+std::string EdgeTimeSeriesStore::DataPath(int64_t start_ms) const {
+  return (std::filesystem::path(options_.directory) /
+          PartitionFileName(start_ms, "dat"))
+      .string();
+}
+
+std::string EdgeTimeSeriesStore::IndexPath(int64_t start_ms) const {
+  return (std::filesystem::path(options_.directory) /
+          PartitionFileName(start_ms, "idx"))
+      .string();
+}
+
+bool EdgeTimeSeriesStore::Open(const EdgeTsdbOptions &options) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (enabled_.load())
+    return true;
+
+  options_ = options;
+  std::error_code ec;
+  std::filesystem::create_directories(options_.directory, ec);
+  if (ec) {
+    LogManager::getInstance().Error("EdgeTSDB: 디렉토리 생성 실패 " +
+                                    options_.directory + " - " + ec.message());
+    return false;
+  }
+
+  // p<시작ms>.dat 목록 (시작 시각 순)
+  std::vector<int64_t> starts;
+  for (const auto &entry :
+       std::filesystem::directory_iterator(options_.directory, ec)) {
+    const std::string name = entry.path().filename().string();
+    if (name.size() < 6 || name[0] != 'p' ||
+        name.compare(name.size() - 4, 4, ".dat") != 0)
+      continue;
+    try {
+      size_t used = 0;
+      const std::string digits = name.substr(1, name.size() - 5);
+      const long long start = std::stoll(digits, &used);
+      if (used == digits.size())
+        starts.push_back(start);
+    } catch (...) {
+    }
+  }
+  std::sort(starts.begin(), starts.end());
+
+  partitions_.clear();
+  for (int64_t start : starts) {
+    if (!CheckIndexFile(IndexPath(start))) {
+      // 비정상 종료로 색인이 없거나 깨짐 → 데이터 파일로 재구성
+      std::vector<IndexEntry> entries;
+      if (!RebuildIndex(start, entries) ||
+          !WriteIndexFile(IndexPath(start), entries)) {
+        LogManager::getInstance().Warn("EdgeTSDB: 파티션 복구 실패 " +
+                                       DataPath(start));
+        continue;
+      }
+    }
+    partitions_.push_back(
+        {start, FileSize(DataPath(start)) + FileSize(IndexPath(start))});
+  }
+
+  writable_.clear();
+  open_bytes_ = 0;
+  next_maintenance_ms_ = 0;
+  enabled_.store(true, std::memory_order_release);
+
+  LogManager::getInstance().Info(
+      "EdgeTSDB: 열림 " + options_.directory + " (파티션 " +
+      std::to_string(partitions_.size()) + "개, 폭 " +
+      std::to_string(options_.partition_minutes) + "분)");
+  return true;
+}
+
+void EdgeTimeSeriesStore::Close() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // 파일 열기 실패로 비활성화된 뒤에도 남은 파티션은 닫는다
+  if (!enabled_.load() && writable_.empty())
+    return;
+  while (!writable_.empty())
+    ClosePartitionLocked(writable_.size() - 1);
+  open_chunks_.Reset();
+  open_bytes_ = 0;
+  enabled_.store(false, std::memory_order_release);
+}
+
+// =============================================================================
+// 쓰기 (Persistence 스레드)
+// =============================================================================
+
+void EdgeTimeSeriesStore::Append(int point_id, int64_t timestamp_ms,
+                                 double value) {
+  if (!enabled_.load(std::memory_order_acquire))
+    return;
+
+  // 시계가 크게 앞선 디바이스의 샘플은 파티션을 열지 못하게 버림
+  const int64_t now_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count();
+  if (timestamp_ms >
+      now_ms + static_cast<int64_t>(options_.max_future_s) * 1000) {
+    future_samples_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  const uint32_t index =
+      Pipeline::PointIndexRegistry::getInstance().Acquire(point_id);
+  if (index == Pipeline::PointIndexRegistry::INVALID_INDEX)
+    return;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!enabled_.load(std::memory_order_relaxed))
+    return; // 락을 기다리는 동안 Close()
+  const int64_t partition = PartitionStart(timestamp_ms);
+
+  if (!FindWritableLocked(partition)) {
+    // 구간 끝 + 유예가 지난 파티션에는 더 쓰지 않음 (Maintain이 닫음)
+    if (partition + PartitionWidthMs() +
+            static_cast<int64_t>(options_.late_grace_s) * 1000 <=
+        now_ms) {
+      late_samples_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    if (!OpenPartitionLocked(partition))
+      return;
+  }
+
+  OpenChunk &chunk = open_chunks_.At(index);
+  if (chunk.has_last && timestamp_ms <= chunk.last_ts) {
+    out_of_order_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  // 청크는 한 파티션 안의 샘플만 담는다
+  if (!chunk.encoder.Empty() && chunk.partition_start != partition)
+    SealLocked(chunk);
+
+  const size_t before = chunk.encoder.Bytes().size();
+  chunk.point_id = point_id;
+  chunk.partition_start = partition;
+  chunk.encoder.Append(timestamp_ms, value);
+  chunk.has_last = true;
+  chunk.last_ts = timestamp_ms;
+  open_bytes_ += chunk.encoder.Bytes().size() - before;
+  samples_.fetch_add(1, std::memory_order_relaxed);
+
+  if (chunk.encoder.Count() >= options_.chunk_max_samples)
+    SealLocked(chunk);
+
+  if (open_bytes_ > options_.max_open_bytes) {
+    SealAllLocked();
+    pressure_seals_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+EdgeTimeSeriesStore::WritablePartition *
+EdgeTimeSeriesStore::FindWritableLocked(int64_t start_ms) {
+  for (auto &partition : writable_) {
+    if (partition.start_ms == start_ms)
+      return &partition;
+  }
+  return nullptr;
+}
+
+EdgeTimeSeriesStore::WritablePartition *
+EdgeTimeSeriesStore::OpenPartitionLocked(int64_t start_ms) {
+  WritablePartition partition;
+  partition.start_ms = start_ms;
+
+  // 재시작 직후 같은 파티션이면 이어서 쓴다 (색인은 메모리로 다시 올림)
+  auto closed = std::find_if(
+      partitions_.begin(), partitions_.end(),
+      [start_ms](const Partition &p) { return p.start_ms == start_ms; });
+  if (closed != partitions_.end()) {
+    if (!ReadIndexFile(IndexPath(start_ms), partition.index) &&
+        !RebuildIndex(start_ms, partition.index)) {
+      late_samples_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    std::error_code ec;
+    std::filesystem::remove(IndexPath(start_ms), ec);
+    partitions_.erase(closed);
+  }
+
+  const std::string path = DataPath(start_ms);
+  partition.file = std::fopen(path.c_str(), "ab");
+  if (!partition.file) {
+    // 디스크/권한 문제 → 샘플마다 재시도하지 않도록 비활성화
+    LogManager::getInstance().Error("EdgeTSDB: 파티션 파일 열기 실패, 비활성화 " +
+                                    path);
+    enabled_.store(false, std::memory_order_release);
+    return nullptr;
+  }
+  partition.file_bytes = FileSize(path);
+
+  auto position = std::find_if(
+      writable_.begin(), writable_.end(),
+      [start_ms](const WritablePartition &p) { return p.start_ms > start_ms; });
+  return &*writable_.insert(position, std::move(partition));
+}
+
+void EdgeTimeSeriesStore::ClosePartitionLocked(size_t position) {
+  const int64_t start = writable_[position].start_ms;
+  SealPartitionLocked(start);
+
+  WritablePartition &partition = writable_[position];
+  FlushBuffer(partition);
+  if (partition.file) {
+    std::fclose(partition.file);
+    partition.file = nullptr;
+  }
+  if (!WriteIndexFile(IndexPath(start), partition.index)) {
+    // 다음 Open에서 데이터 파일로 재구성됨
+    LogManager::getInstance().Warn("EdgeTSDB: 색인 쓰기 실패 " +
+                                   IndexPath(start));
+  }
+  writable_.erase(writable_.begin() + static_cast<std::ptrdiff_t>(position));
+
+  auto closed = std::find_if(
+      partitions_.begin(), partitions_.end(),
+      [start](const Partition &p) { return p.start_ms > start; });
+  partitions_.insert(
+      closed, {start, FileSize(DataPath(start)) + FileSize(IndexPath(start))});
+}
+
+void EdgeTimeSeriesStore::SealLocked(OpenChunk &chunk) {
+  GorillaEncoder &encoder = chunk.encoder;
+  if (encoder.Empty())
+    return;
+
+  const std::string &payload = encoder.Bytes();
+  WritablePartition *partition = FindWritableLocked(chunk.partition_start);
+  if (!partition) {
+    // 파티션을 닫을 때 소속 청크를 먼저 봉인하므로 오지 않는 경로
+    LogManager::getInstance().Warn("EdgeTSDB: 쓰기 중이 아닌 파티션의 청크 " +
+                                   std::to_string(encoder.Count()) +
+                                   "개 샘플 버림");
+    open_bytes_ -= std::min<uint64_t>(open_bytes_, payload.size());
+    encoder.Clear();
+    return;
+  }
+
+  ChunkHeader header{};
+  header.magic = CHUNK_MAGIC;
+  header.point_id = chunk.point_id;
+  header.count = encoder.Count();
+  header.bit_count = static_cast<uint32_t>(encoder.BitCount());
+  header.t_min = encoder.FirstTimestamp();
+  header.t_max = encoder.LastTimestamp();
+  header.payload_len = static_cast<uint32_t>(payload.size());
+  header.checksum = Fnv1a(payload.data(), payload.size());
+
+  IndexEntry entry;
+  entry.point_id = header.point_id;
+  entry.count = header.count;
+  entry.t_min = header.t_min;
+  entry.t_max = header.t_max;
+  entry.offset = partition->file_bytes;
+  partition->index.push_back(entry);
+
+  partition->write_buffer.append(reinterpret_cast<const char *>(&header),
+                                 sizeof(header));
+  partition->write_buffer.append(payload);
+  partition->file_bytes += sizeof(header) + payload.size();
+
+  open_bytes_ -= std::min<uint64_t>(open_bytes_, payload.size());
+  encoder.Clear();
+  chunks_sealed_.fetch_add(1, std::memory_order_relaxed);
+
+  if (partition->write_buffer.size() >= options_.write_buffer_bytes)
+    FlushBuffer(*partition);
+}
+
+void EdgeTimeSeriesStore::SealPartitionLocked(int64_t start_ms) {
+  const size_t count = Pipeline::PointIndexRegistry::getInstance().Size();
+  for (uint32_t index = 0; index < count; ++index) {
+    OpenChunk *chunk = open_chunks_.Find(index);
+    if (chunk && !chunk->encoder.Empty() &&
+        chunk->partition_start == start_ms)
+      SealLocked(*chunk);
+  }
+}
+
+void EdgeTimeSeriesStore::SealAllLocked() {
+  const size_t count = Pipeline::PointIndexRegistry::getInstance().Size();
+  for (uint32_t index = 0; index < count; ++index) {
+    OpenChunk *chunk = open_chunks_.Find(index);
+    if (chunk && !chunk->encoder.Empty())
+      SealLocked(*chunk);
+  }
+  open_bytes_ = 0;
+}
+
+void EdgeTimeSeriesStore::FlushBuffer(WritablePartition &partition) {
+  if (partition.write_buffer.empty() || !partition.file)
+    return;
+  const size_t written =
+      std::fwrite(partition.write_buffer.data(), 1,
+                  partition.write_buffer.size(), partition.file);
+  std::fflush(partition.file);
+  if (written != partition.write_buffer.size()) {
+    LogManager::getInstance().Error(
+        "EdgeTSDB: 파티션 쓰기 실패 (" + std::to_string(written) + "/" +
+        std::to_string(partition.write_buffer.size()) + " bytes)");
+  }
+  partition.write_buffer.clear();
+}
+
+void EdgeTimeSeriesStore::FlushAllLocked() const {
+  for (auto &partition : writable_)
+    FlushBuffer(partition);
+}
+
+void EdgeTimeSeriesStore::Maintain(int64_t now_ms) {
+  if (!enabled_.load(std::memory_order_acquire))
+    return;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (now_ms < next_maintenance_ms_)
+    return;
+  next_maintenance_ms_ =
+      now_ms + static_cast<int64_t>(options_.maintenance_interval_s) * 1000;
+
+  // 구간 끝 + 유예가 지난 파티션을 닫고 색인 기록 (벽시계 기준)
+  const int64_t grace_ms = static_cast<int64_t>(options_.late_grace_s) * 1000;
+  for (size_t i = 0; i < writable_.size();) {
+    if (now_ms >= writable_[i].start_ms + PartitionWidthMs() + grace_ms)
+      ClosePartitionLocked(i);
+    else
+      ++i;
+  }
+
+  const int64_t max_age_ms =
+      static_cast<int64_t>(options_.chunk_max_age_s) * 1000;
+  const size_t count = Pipeline::PointIndexRegistry::getInstance().Size();
+  for (uint32_t index = 0; index < count; ++index) {
+    OpenChunk *chunk = open_chunks_.Find(index);
+    if (chunk && !chunk->encoder.Empty() &&
+        now_ms - chunk->encoder.FirstTimestamp() >= max_age_ms) {
+      SealLocked(*chunk);
+    }
+  }
+  FlushAllLocked();
+
+  ApplyRetentionLocked(now_ms);
+}
+
+void EdgeTimeSeriesStore::ApplyRetentionLocked(int64_t now_ms) {
+  auto drop_oldest = [this]() {
+    const int64_t start = partitions_.front().start_ms;
+    std::error_code ec;
+    std::filesystem::remove(DataPath(start), ec);
+    std::filesystem::remove(IndexPath(start), ec);
+    partitions_.erase(partitions_.begin());
+    partitions_dropped_.fetch_add(1, std::memory_order_relaxed);
+  };
+
+  if (options_.retention_hours > 0) {
+    const int64_t cutoff =
+        now_ms - static_cast<int64_t>(options_.retention_hours) * 3600 * 1000;
+    while (!partitions_.empty() &&
+           partitions_.front().start_ms + PartitionWidthMs() <= cutoff) {
+      drop_oldest();
+    }
+  }
+
+  if (options_.max_disk_bytes > 0) {
+    uint64_t total = 0;
+    for (const auto &partition : writable_)
+      total += partition.file_bytes;
+    for (const auto &partition : partitions_)
+      total += partition.bytes;
+    while (!partitions_.empty() && total > options_.max_disk_bytes) {
+      total -= std::min(total, partitions_.front().bytes);
+      drop_oldest();
+    }
+  }
+}
+
+// =============================================================================
+// 색인 파일
+// =============================================================================
+
+bool EdgeTimeSeriesStore::RebuildIndex(int64_t start_ms,
+                                       std::vector<IndexEntry> &entries) {
+  const std::string path = DataPath(start_ms);
+  std::ifstream in(path, std::ios::binary);
+  if (!in)
+    return false;
+
+  entries.clear();
+  std::string payload;
+  uint64_t offset = 0;
+  const uint64_t file_size = FileSize(path);
+
+  while (offset + sizeof(ChunkHeader) <= file_size) {
+    ChunkHeader header{};
+    if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)))
+      break;
+    if (header.magic != CHUNK_MAGIC || header.payload_len > MAX_PAYLOAD_BYTES ||
+        offset + sizeof(header) + header.payload_len > file_size)
+      break;
+    payload.resize(header.payload_len);
+    if (!in.read(&payload[0], header.payload_len) ||
+        Fnv1a(payload.data(), payload.size()) != header.checksum)
+      break;
+
+    IndexEntry entry;
+    entry.point_id = header.point_id;
+    entry.count = header.count;
+    entry.t_min = header.t_min;
+    entry.t_max = header.t_max;
+    entry.offset = offset;
+    entries.push_back(entry);
+    offset += sizeof(header) + header.payload_len;
+  }
+
+  if (offset < file_size) {
+    // 마지막 온전한 청크 뒤(쓰다 만 꼬리)를 잘라냄
+    in.close();
+    corrupt_chunks_.fetch_add(1, std::memory_order_relaxed);
+    std::error_code ec;
+    std::filesystem::resize_file(path, offset, ec);
+    LogManager::getInstance().Warn(
+        "EdgeTSDB: " + path + " 손상된 꼬리 " +
+        std::to_string(file_size - offset) + " bytes 제거");
+  }
+  return true;
+}
+
+bool EdgeTimeSeriesStore::WriteIndexFile(const std::string &path,
+                                         std::vector<IndexEntry> &entries) {
+  std::sort(entries.begin(), entries.end(),
+            [](const IndexEntry &a, const IndexEntry &b) {
+              return a.point_id != b.point_id ? a.point_id < b.point_id
+                                              : a.t_min < b.t_min;
+            });
+
+  IndexHeader header{};
+  header.magic = INDEX_MAGIC;
+  header.version = INDEX_VERSION;
+  header.count = entries.size();
+  header.checksum =
+      Fnv1a(entries.data(), entries.size() * sizeof(IndexEntry));
+
+  // 임시 파일에 쓴 뒤 이름 변경 (중간에 죽어도 반쪽 색인이 남지 않음)
+  const std::string tmp = path + ".tmp";
+  {
+    std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+    if (!out)
+      return false;
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(entries.data()),
+              static_cast<std::streamsize>(entries.size() *
+                                           sizeof(IndexEntry)));
+    if (!out)
+      return false;
+  }
+  std::error_code ec;
+  std::filesystem::rename(tmp, path, ec);
+  return !ec;
+}
+
+bool EdgeTimeSeriesStore::CheckIndexFile(const std::string &path) {
+  std::ifstream in(path, std::ios::binary);
+  IndexHeader header{};
+  if (!in || !in.read(reinterpret_cast<char *>(&header), sizeof(header)))
+    return false;
+  return header.magic == INDEX_MAGIC && header.version == INDEX_VERSION &&
+         FileSize(path) == sizeof(header) + header.count * sizeof(IndexEntry);
+}
+
+bool EdgeTimeSeriesStore::ReadIndexFile(const std::string &path,
+                                        std::vector<IndexEntry> &entries) {
+  if (!CheckIndexFile(path))
+    return false;
+  std::ifstream in(path, std::ios::binary);
+  IndexHeader header{};
+  in.read(reinterpret_cast<char *>(&header), sizeof(header));
+  entries.resize(header.count);
+  if (!in.read(reinterpret_cast<char *>(entries.data()),
+               static_cast<std::streamsize>(header.count *
+                                            sizeof(IndexEntry))) ||
+      Fnv1a(entries.data(), entries.size() * sizeof(IndexEntry)) !=
+          header.checksum) {
+    entries.clear();
+    return false;
+  }
+  // 이어 쓰기 동안 청크는 시간 순으로 추가되므로 원래 순서로 되돌림
+  std::sort(entries.begin(), entries.end(),
+            [](const IndexEntry &a, const IndexEntry &b) {
+              return a.offset < b.offset;
+            });
+  return true;
+}
+
+bool EdgeTimeSeriesStore::FindInIndexFile(const std::string &path,
+                                          int point_id, int64_t from_ms,
+                                          int64_t to_ms,
+                                          std::vector<IndexEntry> &out) {
+  std::ifstream in(path, std::ios::binary);
+  IndexHeader header{};
+  if (!in || !in.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+      header.magic != INDEX_MAGIC)
+    return false;
+
+  auto read_at = [&in](uint64_t i, IndexEntry &entry) {
+    in.seekg(static_cast<std::streamoff>(sizeof(IndexHeader) +
+                                         i * sizeof(IndexEntry)));
+    return static_cast<bool>(
+        in.read(reinterpret_cast<char *>(&entry), sizeof(entry)));
+  };
+
+  // point_id 하한 이진 탐색
+  uint64_t lo = 0;
+  uint64_t hi = header.count;
+  IndexEntry entry;
+  while (lo < hi) {
+    const uint64_t mid = lo + (hi - lo) / 2;
+    if (!read_at(mid, entry))
+      return false;
+    if (entry.point_id < point_id)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  for (uint64_t i = lo; i < header.count; ++i) {
+    if (!read_at(i, entry) || entry.point_id != point_id || entry.t_min > to_ms)
+      break;
+    if (entry.t_max >= from_ms)
+      out.push_back(entry);
+  }
+  return true;
+}
+
+// =============================================================================
+// 조회 (REST 스레드)
+// =============================================================================
+
+bool EdgeTimeSeriesStore::ScanChunk(const char *data, uint64_t bit_count,
+                                    uint32_t count, int64_t from_ms,
+                                    int64_t to_ms,
+                                    const SampleVisitor &visitor) {
+  GorillaDecoder decoder(data, bit_count, count);
+  int64_t ts = 0;
+  double value = 0.0;
+  while (decoder.Next(ts, value)) {
+    if (ts < from_ms)
+      continue;
+    if (ts > to_ms)
+      break;
+    if (!visitor(ts, value))
+      return false;
+  }
+  return true;
+}
+
+bool EdgeTimeSeriesStore::ScanChunks(const std::string &data_path,
+                                     const std::vector<IndexEntry> &entries,
+                                     int64_t from_ms, int64_t to_ms,
+                                     const SampleVisitor &visitor) {
+  if (entries.empty())
+    return true;
+  std::ifstream in(data_path, std::ios::binary);
+  if (!in)
+    return true; // 보존 정책으로 방금 지워진 파티션
+
+  std::string payload;
+  for (const auto &entry : entries) {
+    ChunkHeader header{};
+    in.seekg(static_cast<std::streamoff>(entry.offset));
+    if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+        header.magic != CHUNK_MAGIC || header.point_id != entry.point_id ||
+        header.payload_len > MAX_PAYLOAD_BYTES) {
+      in.clear();
+      continue;
+    }
+    payload.resize(header.payload_len);
+    if (!in.read(&payload[0], header.payload_len) ||
+        Fnv1a(payload.data(), payload.size()) != header.checksum) {
+      in.clear();
+      continue;
+    }
+    if (!ScanChunk(payload.data(), header.bit_count, header.count, from_ms,
+                   to_ms, visitor))
+      return false;
+  }
+  return true;
+}
+
+void EdgeTimeSeriesStore::Scan(int point_id, int64_t from_ms, int64_t to_ms,
+                               const SampleVisitor &visitor) const {
+  if (!enabled_.load(std::memory_order_acquire) || from_ms > to_ms)
+    return;
+
+  // 락 안에서는 대상 목록과 열린 청크 사본만 만들고 파일은 락 밖에서 읽음
+  struct Target {
+    int64_t start_ms = 0;
+    bool writable = false;
+    std::vector<IndexEntry> hits; // 쓰기 중 파티션만 (닫힌 파티션은 색인 파일)
+  };
+  std::vector<Target> targets;
+  ChunkCopy open_copy;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const int64_t width = PartitionWidthMs();
+    for (const auto &partition : partitions_) {
+      if (partition.start_ms <= to_ms && partition.start_ms + width > from_ms)
+        targets.push_back({partition.start_ms, false, {}});
+    }
+
+    for (auto &partition : writable_) {
+      if (partition.start_ms > to_ms || partition.start_ms + width <= from_ms)
+        continue;
+      FlushBuffer(partition);
+      Target target{partition.start_ms, true, {}};
+      for (const auto &entry : partition.index) {
+        if (entry.point_id == point_id && entry.t_max >= from_ms &&
+            entry.t_min <= to_ms)
+          target.hits.push_back(entry);
+      }
+      targets.push_back(std::move(target));
+    }
+    // 파티션 구간은 겹치지 않으므로 시작 시각 순 = 시간 순
+    std::sort(targets.begin(), targets.end(),
+              [](const Target &a, const Target &b) {
+                return a.start_ms < b.start_ms;
+              });
+
+    const uint32_t index =
+        Pipeline::PointIndexRegistry::getInstance().IndexOf(point_id);
+    if (index != Pipeline::PointIndexRegistry::INVALID_INDEX) {
+      const OpenChunk *chunk = open_chunks_.Find(index);
+      if (chunk && !chunk->encoder.Empty() &&
+          chunk->encoder.LastTimestamp() >= from_ms &&
+          chunk->encoder.FirstTimestamp() <= to_ms) {
+        open_copy.bytes = chunk->encoder.Bytes();
+        open_copy.bit_count = chunk->encoder.BitCount();
+        open_copy.count = chunk->encoder.Count();
+      }
+    }
+  }
+
+  for (auto &target : targets) {
+    if (!target.writable &&
+        !FindInIndexFile(IndexPath(target.start_ms), point_id, from_ms, to_ms,
+                         target.hits))
+      continue;
+    if (!ScanChunks(DataPath(target.start_ms), target.hits, from_ms, to_ms,
+                    visitor))
+      return;
+  }
+  // 열린 청크는 해당 포인트의 가장 최근 샘플
+  if (open_copy.count > 0) {
+    ScanChunk(open_copy.bytes.data(), open_copy.bit_count, open_copy.count,
+              from_ms, to_ms, visitor);
+  }
+}
+
+std::vector<EdgeTsdbSample>
+EdgeTimeSeriesStore::Query(int point_id, int64_t from_ms, int64_t to_ms,
+                           size_t limit) const {
+  std::vector<EdgeTsdbSample> samples;
+  if (limit == 0)
+    return samples;
+  Scan(point_id, from_ms, to_ms,
+       [&samples, limit](int64_t ts, double value) {
+         samples.push_back({ts, value});
+         return samples.size() < limit;
+       });
+  return samples;
+}
+
+std::vector<EdgeTsdbBucket>
+EdgeTimeSeriesStore::Aggregate(int point_id, int64_t from_ms, int64_t to_ms,
+                               int64_t bucket_ms) const {
+  std::vector<EdgeTsdbBucket> buckets;
+  if (bucket_ms <= 0)
+    return buckets;
+
+  double sum = 0.0;
+  Scan(point_id, from_ms, to_ms,
+       [&](int64_t ts, double value) {
+         const int64_t start = AlignDown(ts, bucket_ms);
+         if (buckets.empty() || buckets.back().start_ms != start) {
+           if (!buckets.empty())
+             buckets.back().mean = sum / buckets.back().count;
+           EdgeTsdbBucket bucket;
+           bucket.start_ms = start;
+           bucket.min = value;
+           bucket.max = value;
+           buckets.push_back(bucket);
+           sum = 0.0;
+         }
+         EdgeTsdbBucket &bucket = buckets.back();
+         bucket.min = std::min(bucket.min, value);
+         bucket.max = std::max(bucket.max, value);
+         bucket.last = value;
+         ++bucket.count;
+         sum += value;
+         return true;
+       });
+  if (!buckets.empty())
+    buckets.back().mean = sum / buckets.back().count;
+  return buckets;
+}
+
+EdgeTsdbStats EdgeTimeSeriesStore::GetStats() const {
+  EdgeTsdbStats stats;
+  stats.enabled = enabled_.load(std::memory_order_acquire);
+  stats.samples = samples_.load(std::memory_order_relaxed);
+  stats.out_of_order = out_of_order_.load(std::memory_order_relaxed);
+  stats.late_samples = late_samples_.load(std::memory_order_relaxed);
+  stats.future_samples = future_samples_.load(std::memory_order_relaxed);
+  stats.chunks_sealed = chunks_sealed_.load(std::memory_order_relaxed);
+  stats.pressure_seals = pressure_seals_.load(std::memory_order_relaxed);
+  stats.partitions_dropped =
+      partitions_dropped_.load(std::memory_order_relaxed);
+  stats.corrupt_chunks = corrupt_chunks_.load(std::memory_order_relaxed);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats.open_bytes = open_bytes_;
+  stats.disk_bytes = 0;
+  for (const auto &partition : writable_)
+    stats.disk_bytes += partition.file_bytes;
+  for (const auto &partition : partitions_)
+    stats.disk_bytes += partition.bytes;
+  stats.partitions = partitions_.size() + writable_.size();
+  return stats;
+}
+
+} // namespace Storage
+} // namespace PulseOne
@@ -0,0 +1,252 @@
+// =============================================================================
+// collector/src/Storage/GorillaCodec.cpp - Gorilla 방식 시계열 압축
+// =============================================================================
+
+#include "Storage/GorillaCodec.h"
+
+#include <cstring>
+
+namespace PulseOne {
+namespace Storage {
+
+namespace {
+
+uint64_t DoubleBits(double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+double BitsDouble(uint64_t bits) {
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+int LeadingZeros(uint64_t v) {
+  int n = 0;
+  for (uint64_t mask = uint64_t(1) << 63; mask && !(v & mask); mask >>= 1)
+    ++n;
+  return n;
+}
+
+int TrailingZeros(uint64_t v) {
+  int n = 0;
+  for (; n < 64 && !(v & 1); v >>= 1)
+    ++n;
+  return n;
+}
+
+} // namespace
+
+// =============================================================================
+// 인코더
+// =============================================================================
+
+void GorillaEncoder::WriteBits(uint64_t value, int bits) {
+  // MSB부터 기록. 바이트 경계까지 채우고 남은 비트는 다음 바이트로
+  while (bits > 0) {
+    const int used = static_cast<int>(bit_count_ & 7);
+    if (used == 0)
+      bytes_.push_back('\0');
+    const int room = 8 - used;
+    const int take = bits < room ? bits : room;
+    const uint8_t chunk = static_cast<uint8_t>(
+        (value >> (bits - take)) & ((1u << take) - 1));
+    bytes_.back() = static_cast<char>(static_cast<uint8_t>(bytes_.back()) |
+                                      (chunk << (room - take)));
+    bits -= take;
+    bit_count_ += take;
+  }
+}
+
+void GorillaEncoder::Append(int64_t timestamp_ms, double value) {
+  const uint64_t bits = DoubleBits(value);
+
+  if (count_ == 0) {
+    WriteBits(static_cast<uint64_t>(timestamp_ms), 64);
+    WriteBits(bits, 64);
+    first_ts_ = timestamp_ms;
+    prev_ts_ = timestamp_ms;
+    prev_delta_ = 0;
+    prev_value_ = bits;
+    prev_leading_ = -1;
+    count_ = 1;
+    return;
+  }
+
+  // 타임스탬프: delta-of-delta
+  const int64_t delta = timestamp_ms - prev_ts_;
+  const int64_t dod = delta - prev_delta_;
+  if (dod == 0) {
+    WriteBits(0b0, 1);
+  } else if (dod >= -63 && dod <= 64) {
+    WriteBits(0b10, 2);
+    WriteBits(static_cast<uint64_t>(dod + 63), 7);
+  } else if (dod >= -255 && dod <= 256) {
+    WriteBits(0b110, 3);
+    WriteBits(static_cast<uint64_t>(dod + 255), 9);
+  } else if (dod >= -2047 && dod <= 2048) {
+    WriteBits(0b1110, 4);
+    WriteBits(static_cast<uint64_t>(dod + 2047), 12);
+  } else {
+    WriteBits(0b1111, 4);
+    WriteBits(static_cast<uint64_t>(dod), 64);
+  }
+  prev_delta_ = delta;
+  prev_ts_ = timestamp_ms;
+
+  // 값: XOR
+  const uint64_t x = bits ^ prev_value_;
+  if (x == 0) {
+    WriteBits(0b0, 1);
+  } else {
+    int leading = LeadingZeros(x);
+    const int trailing = TrailingZeros(x);
+    if (leading > 31)
+      leading = 31; // 5비트 필드 상한
+
+    if (prev_leading_ >= 0 && leading >= prev_leading_ &&
+        trailing >= prev_trailing_) {
+      const int meaningful = 64 - prev_leading_ - prev_trailing_;
+      WriteBits(0b10, 2);
+      WriteBits(x >> prev_trailing_, meaningful);
+    } else {
+      const int meaningful = 64 - leading - trailing;
+      WriteBits(0b11, 2);
+      WriteBits(static_cast<uint64_t>(leading), 5);
+      WriteBits(static_cast<uint64_t>(meaningful - 1), 6);
+      WriteBits(x >> trailing, meaningful);
+      prev_leading_ = leading;
+      prev_trailing_ = trailing;
+    }
+  }
+  prev_value_ = bits;
+  ++count_;
+}
+
+void GorillaEncoder::Clear() {
+  std::string().swap(bytes_);
+  bit_count_ = 0;
+  count_ = 0;
+  first_ts_ = 0;
+  prev_ts_ = 0;
+  prev_delta_ = 0;
+  prev_value_ = 0;
+  prev_leading_ = -1;
+  prev_trailing_ = 0;
+}
+
+// =============================================================================
+// 디코더
+// =============================================================================
+
+bool GorillaDecoder::ReadBit(bool &out) {
+  if (pos_ >= bit_count_)
+    return false;
+  out = (data_[pos_ >> 3] >> (7 - (pos_ & 7))) & 1;
+  ++pos_;
+  return true;
+}
+
+bool GorillaDecoder::ReadBits(int bits, uint64_t &out) {
+  if (pos_ + static_cast<uint64_t>(bits) > bit_count_)
+    return false;
+  out = 0;
+  while (bits > 0) {
+    const int offset = static_cast<int>(pos_ & 7);
+    const int room = 8 - offset;
+    const int take = bits < room ? bits : room;
+    const uint8_t byte = data_[pos_ >> 3];
+    const uint64_t chunk = (byte >> (room - take)) & ((1u << take) - 1);
+    out = (out << take) | chunk;
+    bits -= take;
+    pos_ += take;
+  }
+  return true;
+}
+
+bool GorillaDecoder::Next(int64_t &timestamp_ms, double &value) {
+  if (remaining_ == 0)
+    return false;
+
+  uint64_t raw = 0;
+  if (first_) {
+    if (!ReadBits(64, raw))
+      return false;
+    prev_ts_ = static_cast<int64_t>(raw);
+    if (!ReadBits(64, prev_value_))
+      return false;
+    first_ = false;
+  } else {
+    // 타임스탬프 접두어: 연속된 1의 개수 (최대 4)
+    int ones = 0;
+    bool bit = false;
+    while (ones < 4) {
+      if (!ReadBit(bit))
+        return false;
+      if (!bit)
+        break;
+      ++ones;
+    }
+
+    int64_t dod = 0;
+    switch (ones) {
+    case 0:
+      break;
+    case 1:
+      if (!ReadBits(7, raw))
+        return false;
+      dod = static_cast<int64_t>(raw) - 63;
+      break;
+    case 2:
+      if (!ReadBits(9, raw))
+        return false;
+      dod = static_cast<int64_t>(raw) - 255;
+      break;
+    case 3:
+      if (!ReadBits(12, raw))
+        return false;
+      dod = static_cast<int64_t>(raw) - 2047;
+      break;
+    default:
+      if (!ReadBits(64, raw))
+        return false;
+      dod = static_cast<int64_t>(raw);
+      break;
+    }
+    prev_delta_ += dod;
+    prev_ts_ += prev_delta_;
+
+    // 값
+    if (!ReadBit(bit))
+      return false;
+    if (bit) {
+      bool fresh = false;
+      if (!ReadBit(fresh))
+        return false;
+      if (fresh) {
+        uint64_t leading = 0;
+        uint64_t meaningful = 0;
+        if (!ReadBits(5, leading) || !ReadBits(6, meaningful))
+          return false;
+        prev_leading_ = static_cast<int>(leading);
+        prev_trailing_ = 64 - prev_leading_ - static_cast<int>(meaningful + 1);
+        if (prev_trailing_ < 0)
+          return false;
+      }
+      const int meaningful = 64 - prev_leading_ - prev_trailing_;
+      if (!ReadBits(meaningful, raw))
+        return false;
+      prev_value_ ^= raw << prev_trailing_;
+    }
+  }
+
+  timestamp_ms = prev_ts_;
+  value = BitsDouble(prev_value_);
+  --remaining_;
+  return true;
+}
+
+} // namespace Storage
+} // namespace PulseOne
@@ -0,0 +1,854 @@
+// =============================================================================
+// collector/src/Storage/InfluxWriter.cpp - 비동기 InfluxDB 배치 라이터 구현
+// =============================================================================
+
+#include "Storage/InfluxWriter.h"
+#include "Logging/LogManager.h"
+#include "Pipeline/PipelineManager.h"
+#include "Pipeline/PipelineMetrics.h"
+#include "Utils/ConfigManager.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <nlohmann/json.hpp>
+#include <unordered_map>
+
+#if defined(HAS_ZLIB) && HAS_ZLIB
+#include <zlib.h>
+#endif
+
+namespace PulseOne {
+namespace Storage {
+
+namespace {
+
+constexpr size_t SPOOL_RECORD_HEADER = 13; // 길이 u32 + 체크섬 u32 + 정밀도 u8 + 줄 수 u32
+constexpr size_t SPOOL_REPLAY_BATCH = 8;   // 루프 1회당 재전송할 스풀 레코드 수
+
+uint32_t Fnv1a(const char *data, size_t size) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= static_cast<uint8_t>(data[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+std::string UrlEncode(const std::string &value) {
+  static const char *hex = "0123456789ABCDEF";
+  std::string out;
+  out.reserve(value.size());
+  for (unsigned char c : value) {
+    if (std::isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
+      out += static_cast<char>(c);
+    } else {
+      out += '%';
+      out += hex[c >> 4];
+      out += hex[c & 0x0F];
+    }
+  }
+  return out;
+}
+
+template <typename T> void PutPod(std::string &out, T value) {
+  out.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+} // namespace
+
+// =============================================================================
+// 설정 / 정밀도
+// =============================================================================
+
+InfluxWriterOptions InfluxWriterOptions::FromConfig() {
+  auto &config = ConfigManager::getInstance();
+  InfluxWriterOptions options;
+
+  options.precision = InfluxWriter::ParsePrecision(
+      config.getOrDefault("INFLUX_WRITER_PRECISION", "ms"),
+      InfluxPrecision::MILLIS);
+  options.batch_max_lines = static_cast<size_t>(
+      std::max(config.getInt("INFLUX_WRITER_BATCH_LINES", 5000), 1));
+  options.batch_max_bytes = static_cast<size_t>(std::max(
+                                config.getInt("INFLUX_WRITER_BATCH_KB", 1024),
+                                1)) *
+                            1024;
+  options.flush_interval_ms =
+      std::max(config.getInt("INFLUX_WRITER_FLUSH_MS", 1000), 10);
+  options.gzip = config.getBool("INFLUX_WRITER_GZIP", true);
+  options.max_retries =
+      std::max(config.getInt("INFLUX_WRITER_MAX_RETRIES", 4), 0);
+  options.retry_base_ms =
+      std::max(config.getInt("INFLUX_WRITER_RETRY_BASE_MS", 200), 1);
+  options.retry_max_ms =
+      std::max(config.getInt("INFLUX_WRITER_RETRY_MAX_MS", 10000),
+               options.retry_base_ms);
+  options.queue_max_lines = static_cast<size_t>(
+      std::max(config.getInt("INFLUX_WRITER_QUEUE_LINES", 200000), 1));
+  options.timeout_sec =
+      std::max(config.getInt("INFLUX_WRITER_TIMEOUT_SEC", 10), 1);
+
+  if (config.getBool("INFLUX_WRITER_SPOOL_ENABLED", false)) {
+    options.spool_dir = config.getOrDefault("INFLUX_WRITER_SPOOL_DIR", "");
+    if (options.spool_dir.empty()) {
+      options.spool_dir = config.getDataDirectory() + "/influx_spool";
+    }
+  }
+  options.spool_max_bytes =
+      static_cast<uint64_t>(
+          std::max(config.getInt("INFLUX_WRITER_SPOOL_MAX_MB", 512), 1)) *
+      1024 * 1024;
+  return options;
+}
+
+int64_t InfluxWriter::ToTimestamp(std::chrono::system_clock::time_point time,
+                                  InfluxPrecision precision) {
+  const auto since_epoch = time.time_since_epoch();
+  switch (precision) {
+  case InfluxPrecision::SECONDS:
+    return std::chrono::duration_cast<std::chrono::seconds>(since_epoch)
+        .count();
+  case InfluxPrecision::MICROS:
+    return std::chrono::duration_cast<std::chrono::microseconds>(since_epoch)
+        .count();
+  case InfluxPrecision::NANOS:
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(since_epoch)
+        .count();
+  case InfluxPrecision::MILLIS:
+  default:
+    return std::chrono::duration_cast<std::chrono::milliseconds>(since_epoch)
+        .count();
+  }
+}
+
+const char *InfluxWriter::PrecisionName(InfluxPrecision precision) {
+  switch (precision) {
+  case InfluxPrecision::SECONDS:
+    return "s";
+  case InfluxPrecision::MICROS:
+    return "us";
+  case InfluxPrecision::NANOS:
+    return "ns";
+  case InfluxPrecision::MILLIS:
+  default:
+    return "ms";
+  }
+}
+
+InfluxPrecision InfluxWriter::ParsePrecision(const std::string &name,
+                                             InfluxPrecision fallback) {
+  if (name == "s")
+    return InfluxPrecision::SECONDS;
+  if (name == "ms")
+    return InfluxPrecision::MILLIS;
+  if (name == "us")
+    return InfluxPrecision::MICROS;
+  if (name == "ns")
+    return InfluxPrecision::NANOS;
+  return fallback;
+}
+
+std::string InfluxWriter::GzipCompress(const std::string &data) {
+#if defined(HAS_ZLIB) && HAS_ZLIB
+  z_stream stream;
+  std::memset(&stream, 0, sizeof(stream));
+  // windowBits 15 + 16 = gzip 헤더, 속도 우선 (라인 프로토콜은 압축률이 높음)
+  if (deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK) {
+    return std::string();
+  }
+
+  std::string out;
+  out.resize(deflateBound(&stream, static_cast<uLong>(data.size())));
+  stream.next_in =
+      reinterpret_cast<Bytef *>(const_cast<char *>(data.data()));
+  stream.avail_in = static_cast<uInt>(data.size());
+  stream.next_out = reinterpret_cast<Bytef *>(&out[0]);
+  stream.avail_out = static_cast<uInt>(out.size());
+
+  const int result = deflate(&stream, Z_FINISH);
+  const size_t produced = stream.total_out;
+  deflateEnd(&stream);
+  if (result != Z_STREAM_END) {
+    return std::string();
+  }
+  out.resize(produced);
+  return out;
+#else
+  (void)data;
+  return std::string();
+#endif
+}
+
+// =============================================================================
+// 생명주기
+// =============================================================================
+
+InfluxWriter::InfluxWriter() : jitter_rng_(std::random_device{}()) {}
+
+InfluxWriter::~InfluxWriter() { Stop(); }
+
+bool InfluxWriter::Start(const InfluxWriterOptions &options) {
+  if (IsRunning())
+    return true;
+
+  options_ = options;
+#if !(defined(HAS_ZLIB) && HAS_ZLIB)
+  options_.gzip = false;
+#endif
+
+  Client::HttpRequestOptions http_options;
+  http_options.timeout_sec = options_.timeout_sec;
+  http_options.connect_timeout_sec = std::min(options_.timeout_sec, 5);
+  http_options.bearer_token = options_.token;
+  http_client_ =
+      std::make_unique<Client::HttpClient>(options_.url, http_options);
+  write_path_prefix_ = "/api/v2/write?org=" + UrlEncode(options_.org) +
+                       "&bucket=" + UrlEncode(options_.bucket) + "&precision=";
+  delete_path_ = "/api/v2/delete?org=" + UrlEncode(options_.org) +
+                 "&bucket=" + UrlEncode(options_.bucket);
+
+  spool_enabled_ = !options_.spool_dir.empty() && OpenSpool();
+
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    stop_requested_ = false;
+  }
+  // 첫 전송이 실패하면 그때 오프라인으로 전환
+  online_.store(true);
+  running_.store(true, std::memory_order_release);
+  writer_thread_ = std::thread(&InfluxWriter::WriterLoop, this);
+
+  LogManager::getInstance().Info(
+      "📈 InfluxWriter 시작: {} (precision={}, batch={}줄/{}KB, flush={}ms, "
+      "gzip={}, spool={})",
+      options_.url, PrecisionName(options_.precision), options_.batch_max_lines,
+      options_.batch_max_bytes / 1024, options_.flush_interval_ms,
+      options_.gzip ? "on" : "off",
+      spool_enabled_ ? options_.spool_dir : std::string("off"));
+  return true;
+}
+
+void InfluxWriter::Stop() {
+  if (!running_.exchange(false))
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    stop_requested_ = true;
+  }
+  queue_cv_.notify_all();
+  if (writer_thread_.joinable()) {
+    writer_thread_.join();
+  }
+  CloseSpool();
+
+  LogManager::getInstance().Info(
+      "📈 InfluxWriter 종료 (전송 {}줄, 스풀 대기 {}바이트)", written_.load(),
+      spool_size_.load());
+}
+
+// =============================================================================
+// 큐
+// =============================================================================
+
+// 호출자가 queue_mutex_를 잡고 호출. 배치 기준을 채웠으면 true
+bool InfluxWriter::PushBlock(std::string &&text, size_t lines,
+                             std::vector<uint64_t> &&wal_lsns) {
+  queue_lines_ += lines;
+  queue_bytes_ += text.size();
+  queue_.push_back(Block{std::move(text), lines, std::move(wal_lsns)});
+  return queue_lines_ >= options_.batch_max_lines ||
+         queue_bytes_ >= options_.batch_max_bytes;
+}
+
+bool InfluxWriter::Enqueue(std::string line) {
+  if (!IsRunning() || line.empty())
+    return false;
+  if (line.back() != '\n')
+    line += '\n';
+
+  bool notify = false;
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    if (queue_lines_ >= options_.queue_max_lines) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    notify = PushBlock(std::move(line), 1, {});
+  }
+  queued_.fetch_add(1, std::memory_order_relaxed);
+  if (notify)
+    queue_cv_.notify_one();
+  return true;
+}
+
+size_t InfluxWriter::Enqueue(std::vector<std::string> &&lines) {
+  if (!IsRunning() || lines.empty())
+    return 0;
+
+  size_t accepted = 0;
+  size_t rejected = 0;
+  bool notify = false;
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    for (auto &line : lines) {
+      if (line.empty())
+        continue;
+      if (queue_lines_ >= options_.queue_max_lines) {
+        ++rejected;
+        continue;
+      }
+      if (line.back() != '\n')
+        line += '\n';
+      notify = PushBlock(std::move(line), 1, {}) || notify;
+      ++accepted;
+    }
+  }
+  lines.clear();
+
+  queued_.fetch_add(accepted, std::memory_order_relaxed);
+  if (rejected > 0)
+    dropped_.fetch_add(rejected, std::memory_order_relaxed);
+  if (notify)
+    queue_cv_.notify_one();
+  return accepted;
+}
+
+size_t InfluxWriter::EnqueueBlock(std::string &&block, size_t lines,
+                                  std::vector<uint64_t> &&wal_lsns) {
+  if (!IsRunning() || block.empty() || lines == 0) {
+    ReleaseWal(wal_lsns, false);
+    return 0;
+  }
+
+  bool notify = false;
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    if (queue_lines_ + lines > options_.queue_max_lines) {
+      dropped_.fetch_add(lines, std::memory_order_relaxed);
+      ReleaseWal(wal_lsns, false);
+      return 0;
+    }
+    notify = PushBlock(std::move(block), lines, std::move(wal_lsns));
+  }
+  queued_.fetch_add(lines, std::memory_order_relaxed);
+  if (notify)
+    queue_cv_.notify_one();
+  return lines;
+}
+
+size_t InfluxWriter::TakeBatch(std::string &body,
+                               std::vector<uint64_t> &wal_lsns,
+                               bool &stopping) {
+  std::unique_lock<std::mutex> lock(queue_mutex_);
+  queue_cv_.wait_for(
+      lock, std::chrono::milliseconds(options_.flush_interval_ms), [this] {
+        return stop_requested_ || queue_lines_ >= options_.batch_max_lines ||
+               queue_bytes_ >= options_.batch_max_bytes;
+      });
+  stopping = stop_requested_;
+
+  body.clear();
+  wal_lsns.clear();
+  size_t lines = 0;
+  while (!queue_.empty() && lines < options_.batch_max_lines &&
+         body.size() < options_.batch_max_bytes) {
+    Block &front = queue_.front();
+    queue_bytes_ -= std::min(queue_bytes_, front.text.size());
+    if (body.empty()) {
+      body = std::move(front.text); // 블록 하나면 복사 없이 그대로 전송
+    } else {
+      body += front.text;
+    }
+    lines += front.lines;
+    queue_lines_ -= front.lines;
+    wal_lsns.insert(wal_lsns.end(), front.wal_lsns.begin(),
+                    front.wal_lsns.end());
+    queue_.pop_front();
+  }
+  return lines;
+}
+
+// =============================================================================
+// 라이터 스레드
+// =============================================================================
+
+void InfluxWriter::WriterLoop() {
+  std::string body;
+  std::vector<uint64_t> wal_lsns;
+  while (true) {
+    bool stopping = false;
+    const size_t lines = TakeBatch(body, wal_lsns, stopping);
+    if (lines > 0)
+      SendOrSpool(body, lines, wal_lsns, stopping);
+    if (stopping) {
+      if (lines > 0)
+        continue; // 종료 전 큐를 모두 비움
+      break;
+    }
+
+    // 삭제/스풀 재생은 큐 상태와 무관하게 매 반복 정해진 양만큼 진행
+    // (실시간 배치 하나당 스풀 최대 SPOOL_REPLAY_BATCH개). 큐가 빌 때까지
+    // 미루면 평상시 부하에서는 영영 돌지 않아 스풀이 한도까지 참.
+    if (IsOnline())
+      RunPendingDeletes();
+
+    if (spool_enabled_ && spool_size_.load() > 0) {
+      if (IsOnline()) {
+        ReplaySpool(SPOOL_REPLAY_BATCH);
+      } else if (std::chrono::steady_clock::now() >= next_probe_) {
+        ReplaySpool(1); // 재연결 시험
+      }
+    }
+  }
+}
+
+void InfluxWriter::ReleaseWal(const std::vector<uint64_t> &wal_lsns,
+                              bool persisted) {
+  if (!wal_lsns.empty())
+    Pipeline::PipelineManager::getInstance().GetWal().Release(wal_lsns,
+                                                              persisted);
+}
+
+// WAL 참조는 Influx가 받았거나 스풀에 기록된 뒤에만 persisted로 반환
+void InfluxWriter::SendOrSpool(const std::string &body, size_t lines,
+                               const std::vector<uint64_t> &wal_lsns,
+                               bool final_attempt) {
+  bytes_raw_.fetch_add(body.size(), std::memory_order_relaxed);
+
+  // 오프라인이면 재연결 시험 시각 전까지는 바로 스풀로
+  if (!IsOnline() && std::chrono::steady_clock::now() < next_probe_) {
+    const bool spooled = SpoolAppend(body, lines, options_.precision);
+    if (!spooled)
+      dropped_.fetch_add(lines, std::memory_order_relaxed);
+    ReleaseWal(wal_lsns, spooled);
+    return;
+  }
+
+  // 오프라인 중 시험 전송이나 종료 직전에는 재시도로 시간을 끌지 않음
+  const int retries = (IsOnline() && !final_attempt) ? options_.max_retries : 0;
+  const SendResult result = SendWithRetry(body, options_.precision, retries);
+
+  switch (result) {
+  case SendResult::OK:
+    written_.fetch_add(lines, std::memory_order_relaxed);
+    MarkOnline();
+    ReleaseWal(wal_lsns, true);
+    return;
+  case SendResult::REJECTED:
+    // 재시도/재생해도 같은 응답이므로 WAL에도 남기지 않음
+    dropped_.fetch_add(lines, std::memory_order_relaxed);
+    ReleaseWal(wal_lsns, true);
+    return;
+  case SendResult::RETRYABLE:
+  case SendResult::STOPPED:
+    break;
+  }
+
+  failed_batches_.fetch_add(1, std::memory_order_relaxed);
+  MarkOffline();
+  const bool spooled = SpoolAppend(body, lines, options_.precision);
+  if (!spooled)
+    dropped_.fetch_add(lines, std::memory_order_relaxed);
+  ReleaseWal(wal_lsns, spooled);
+}
+
+void InfluxWriter::RequestDelete(const std::string &measurement,
+                                 std::chrono::system_clock::time_point before) {
+  if (!IsRunning() || measurement.empty())
+    return;
+
+  std::lock_guard<std::mutex> lock(queue_mutex_);
+  for (auto &pending : pending_deletes_) {
+    if (pending.first == measurement) {
+      pending.second = before;
+      return;
+    }
+  }
+  pending_deletes_.emplace_back(measurement, before);
+}
+
+void InfluxWriter::RunPendingDeletes() {
+  std::vector<std::pair<std::string, std::chrono::system_clock::time_point>>
+      deletes;
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    deletes.swap(pending_deletes_);
+  }
+
+  for (const auto &[measurement, before] : deletes) {
+    const std::time_t stop_time = std::chrono::system_clock::to_time_t(before);
+    std::tm tm_utc{};
+#ifdef _WIN32
+    gmtime_s(&tm_utc, &stop_time);
+#else
+    gmtime_r(&stop_time, &tm_utc);
+#endif
+    char stop_iso[32];
+    std::strftime(stop_iso, sizeof(stop_iso), "%Y-%m-%dT%H:%M:%SZ", &tm_utc);
+
+    std::string predicate = "_measurement=\"";
+    for (char c : measurement) {
+      if (c == '"' || c == '\\')
+        predicate += '\\';
+      predicate += c;
+    }
+    predicate += '"';
+
+    nlohmann::json request;
+    request["start"] = "1970-01-01T00:00:00Z";
+    request["stop"] = stop_iso;
+    request["predicate"] = predicate;
+
+    requests_.fetch_add(1, std::memory_order_relaxed);
+    auto response =
+        http_client_->post(delete_path_, request.dump(), "application/json");
+    if (response.isSuccess()) {
+      deletes_.fetch_add(1, std::memory_order_relaxed);
+      LogManager::getInstance().log(
+          "database", LogLevel::DEBUG_LEVEL,
+          "InfluxWriter 보존 기간 정리: " + measurement + " < " + stop_iso);
+    } else {
+      LogManager::getInstance().log(
+          "database", LogLevel::WARN,
+          "InfluxWriter 보존 기간 삭제 실패 (" + measurement + ", Status: " +
+              std::to_string(response.status_code) + ")");
+    }
+  }
+}
+
+InfluxWriter::SendResult InfluxWriter::Post(const std::string &body,
+                                            InfluxPrecision precision) {
+  std::unordered_map<std::string, std::string> headers;
+  std::string compressed;
+  if (options_.gzip && body.size() >= options_.gzip_min_bytes) {
+    compressed = GzipCompress(body);
+    if (!compressed.empty())
+      headers["Content-Encoding"] = "gzip";
+  }
+  const std::string &payload = compressed.empty() ? body : compressed;
+
+  requests_.fetch_add(1, std::memory_order_relaxed);
+  bytes_sent_.fetch_add(payload.size(), std::memory_order_relaxed);
+
+  const auto start = std::chrono::steady_clock::now();
+  auto response =
+      http_client_->post(write_path_prefix_ + PrecisionName(precision), payload,
+                         "text/plain; charset=utf-8", headers);
+  Pipeline::PipelineMetrics::getInstance().Record(
+      Pipeline::PipelineMetrics::INFLUX_FLUSH, "batch",
+      std::chrono::steady_clock::now() - start);
+
+  if (response.isSuccess())
+    return SendResult::OK;
+
+  const int status = response.status_code;
+  if (status == 0 || status == 408 || status == 429 || status >= 500) {
+    LogManager::getInstance().log(
+        "database", LogLevel::DEBUG_LEVEL,
+        "InfluxWriter 전송 실패 (재시도 가능): " + response.error_message +
+            " (Status: " + std::to_string(status) + ")");
+    return SendResult::RETRYABLE;
+  }
+
+  LogManager::getInstance().log(
+      "database", LogLevel::LOG_ERROR,
+      "InfluxWriter 배치 거부 (Status: " + std::to_string(status) +
+          "): " + response.body.substr(0, 256));
+  return SendResult::REJECTED;
+}
+
+InfluxWriter::SendResult
+InfluxWriter::SendWithRetry(const std::string &body, InfluxPrecision precision,
+                            int max_retries) {
+  for (int attempt = 0;; ++attempt) {
+    const SendResult result = Post(body, precision);
+    if (result != SendResult::RETRYABLE || attempt >= max_retries)
+      return result;
+
+    retries_.fetch_add(1, std::memory_order_relaxed);
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+    if (queue_cv_.wait_for(lock, std::chrono::milliseconds(BackoffMs(attempt)),
+                           [this] { return stop_requested_; })) {
+      return SendResult::STOPPED;
+    }
+  }
+}
+
+int InfluxWriter::BackoffMs(int attempt) {
+  // 지수 백오프 + equal jitter: [cap/2, cap]
+  const int64_t cap = std::min<int64_t>(
+      options_.retry_max_ms,
+      static_cast<int64_t>(options_.retry_base_ms) << std::min(attempt, 20));
+  std::uniform_int_distribution<int64_t> dist(0, cap / 2);
+  return static_cast<int>(cap - cap / 2 + dist(jitter_rng_));
+}
+
+void InfluxWriter::MarkOffline() {
+  next_probe_ = std::chrono::steady_clock::now() +
+                std::chrono::milliseconds(options_.retry_max_ms);
+  if (online_.exchange(false)) {
+    LogManager::getInstance().Warn(
+        "⚠️ InfluxDB 응답 없음 - 오프라인 전환 ({})",
+        spool_enabled_ ? "스풀 파일에 보관" : "스풀 비활성, 데이터 드롭");
+  }
+}
+
+void InfluxWriter::MarkOnline() {
+  if (!online_.exchange(true)) {
+    LogManager::getInstance().Info("✅ InfluxDB 재연결 - 스풀 {}바이트 재전송",
+                                   spool_size_.load());
+  }
+}
+
+// =============================================================================
+// 스풀 파일
+// =============================================================================
+
+bool InfluxWriter::OpenSpool() {
+  std::error_code ec;
+  std::filesystem::create_directories(options_.spool_dir, ec);
+  if (ec) {
+    LogManager::getInstance().Warn("InfluxWriter 스풀 디렉토리 생성 실패: {} ({})",
+                                   options_.spool_dir, ec.message());
+    return false;
+  }
+
+  const std::filesystem::path dir(options_.spool_dir);
+  spool_path_ = (dir / "influx_spool.dat").string();
+  spool_offset_path_ = (dir / "influx_spool.pos").string();
+
+  uint64_t file_size = std::filesystem::file_size(spool_path_, ec);
+  if (ec)
+    file_size = 0;
+
+  spool_read_offset_ = 0;
+  std::ifstream pos(spool_offset_path_, std::ios::binary);
+  if (pos) {
+    pos.read(reinterpret_cast<char *>(&spool_read_offset_),
+             sizeof(spool_read_offset_));
+    if (!pos)
+      spool_read_offset_ = 0;
+  }
+  if (spool_read_offset_ > file_size)
+    spool_read_offset_ = 0;
+
+  // 비정상 종료로 찢어진 꼬리는 잘라내야 이어 쓴 레코드와 경계가 맞음
+  const uint64_t valid_end =
+      ScanSpool(spool_path_, spool_read_offset_, file_size);
+  if (valid_end < file_size) {
+    std::filesystem::resize_file(spool_path_, valid_end, ec);
+    LogManager::getInstance().Warn(
+        "InfluxWriter 스풀 손상된 꼬리 {}바이트 제거: {}",
+        file_size - valid_end, spool_path_);
+    if (ec) {
+      LogManager::getInstance().Warn("InfluxWriter 스풀 정리 실패: {} ({})",
+                                     spool_path_, ec.message());
+      return false;
+    }
+    file_size = valid_end;
+  }
+
+  spool_out_.open(spool_path_, std::ios::binary | std::ios::app);
+  if (!spool_out_) {
+    LogManager::getInstance().Warn("InfluxWriter 스풀 파일 열기 실패: {}",
+                                   spool_path_);
+    return false;
+  }
+  spool_size_.store(file_size - spool_read_offset_);
+
+  if (spool_size_.load() > 0) {
+    LogManager::getInstance().Info(
+        "💾 InfluxWriter 스풀 복구: {}바이트 재전송 대기", spool_size_.load());
+  }
+  return true;
+}
+
+uint64_t InfluxWriter::ScanSpool(const std::string &path, uint64_t offset,
+                                 uint64_t file_size) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in || !in.seekg(static_cast<std::streamoff>(offset)))
+    return offset;
+
+  std::string body;
+  while (offset + SPOOL_RECORD_HEADER <= file_size) {
+    char header[SPOOL_RECORD_HEADER];
+    if (!in.read(header, sizeof(header)))
+      break;
+
+    uint32_t len = 0, checksum = 0;
+    uint8_t precision = 0;
+    std::memcpy(&len, header, 4);
+    std::memcpy(&checksum, header + 4, 4);
+    std::memcpy(&precision, header + 8, 1);
+    if (len == 0 || precision > 3 ||
+        offset + SPOOL_RECORD_HEADER + len > file_size)
+      break;
+    body.resize(len);
+    if (!in.read(&body[0], len) || Fnv1a(body.data(), body.size()) != checksum)
+      break;
+    offset += SPOOL_RECORD_HEADER + len;
+  }
+  return offset;
+}
+
+void InfluxWriter::CloseSpool() {
+  if (!spool_enabled_)
+    return;
+  spool_out_.flush();
+  spool_out_.close();
+  spool_enabled_ = false;
+}
+
+bool InfluxWriter::SpoolAppend(const std::string &body, size_t lines,
+                               InfluxPrecision precision) {
+  if (!spool_enabled_)
+    return false;
+
+  const uint64_t record_size = SPOOL_RECORD_HEADER + body.size();
+  if (spool_read_offset_ + spool_size_.load() + record_size >
+      options_.spool_max_bytes) {
+    return false;
+  }
+
+  std::string header;
+  header.reserve(SPOOL_RECORD_HEADER);
+  PutPod(header, static_cast<uint32_t>(body.size()));
+  PutPod(header, Fnv1a(body.data(), body.size()));
+  PutPod(header, static_cast<uint8_t>(precision));
+  PutPod(header, static_cast<uint32_t>(lines));
+
+  spool_out_.write(header.data(), static_cast<std::streamsize>(header.size()));
+  spool_out_.write(body.data(), static_cast<std::streamsize>(body.size()));
+  spool_out_.flush();
+  if (!spool_out_) {
+    // 일부만 써졌을 수 있음 → 마지막 온전한 레코드까지 되돌려 경계 유지
+    spool_out_.clear();
+    spool_out_.close();
+    std::error_code ec;
+    std::filesystem::resize_file(
+        spool_path_, spool_read_offset_ + spool_size_.load(), ec);
+    spool_out_.open(spool_path_, std::ios::binary | std::ios::app);
+    return false;
+  }
+
+  spool_size_.fetch_add(record_size);
+  spooled_.fetch_add(lines, std::memory_order_relaxed);
+  return true;
+}
+
+void InfluxWriter::ReplaySpool(size_t max_records) {
+  std::ifstream in(spool_path_, std::ios::binary);
+  if (!in)
+    return;
+  in.seekg(static_cast<std::streamoff>(spool_read_offset_));
+
+  std::string body;
+  for (size_t i = 0; i < max_records && spool_size_.load() > 0; ++i) {
+    char header[SPOOL_RECORD_HEADER];
+    if (spool_size_.load() < SPOOL_RECORD_HEADER ||
+        !in.read(header, sizeof(header))) {
+      // 헤더보다 짧은 조각은 끝까지 재전송할 수 없으므로 버림
+      LogManager::getInstance().Warn(
+          "InfluxWriter 스풀 끝 조각 {}바이트 폐기", spool_size_.load());
+      ResetSpool();
+      return;
+    }
+
+    uint32_t len = 0, checksum = 0, lines = 0;
+    uint8_t precision = 0;
+    std::memcpy(&len, header, 4);
+    std::memcpy(&checksum, header + 4, 4);
+    std::memcpy(&precision, header + 8, 1);
+    std::memcpy(&lines, header + 9, 4);
+
+    body.resize(len);
+    if (len > spool_size_.load() - SPOOL_RECORD_HEADER ||
+        !in.read(&body[0], len) ||
+        Fnv1a(body.data(), body.size()) != checksum) {
+      // 중간이 깨지면 레코드 경계를 찾을 수 없으므로 나머지를 버림
+      LogManager::getInstance().Warn(
+          "InfluxWriter 스풀 손상 - 남은 {}바이트 폐기", spool_size_.load());
+      ResetSpool();
+      return;
+    }
+
+    const SendResult result = SendWithRetry(
+        body, static_cast<InfluxPrecision>(std::min<uint8_t>(precision, 3)), 0);
+    if (result == SendResult::RETRYABLE || result == SendResult::STOPPED) {
+      MarkOffline();
+      return;
+    }
+    if (result == SendResult::OK) {
+      written_.fetch_add(lines, std::memory_order_relaxed);
+      replayed_.fetch_add(lines, std::memory_order_relaxed);
+      MarkOnline();
+    } else {
+      dropped_.fetch_add(lines, std::memory_order_relaxed);
+    }
+
+    const uint64_t record_size = SPOOL_RECORD_HEADER + len;
+    spool_read_offset_ += record_size;
+    spool_size_.fetch_sub(std::min(spool_size_.load(), record_size));
+    StoreSpoolReadOffset();
+  }
+
+  if (spool_size_.load() == 0) {
+    LogManager::getInstance().Info("💾 InfluxWriter 스풀 재전송 완료 (누적 {}줄)",
+                                   replayed_.load());
+    ResetSpool();
+  }
+}
+
+void InfluxWriter::StoreSpoolReadOffset() {
+  std::ofstream pos(spool_offset_path_, std::ios::binary | std::ios::trunc);
+  pos.write(reinterpret_cast<const char *>(&spool_read_offset_),
+            sizeof(spool_read_offset_));
+}
+
+void InfluxWriter::ResetSpool() {
+  spool_out_.close();
+  spool_out_.open(spool_path_,
+                  std::ios::binary | std::ios::out | std::ios::trunc);
+  spool_out_.close();
+  spool_out_.open(spool_path_, std::ios::binary | std::ios::app);
+
+  std::error_code ec;
+  std::filesystem::remove(spool_offset_path_, ec);
+  spool_read_offset_ = 0;
+  spool_size_.store(0);
+}
+
+// =============================================================================
+// 통계
+// =============================================================================
+
+InfluxWriterStats InfluxWriter::GetStats() const {
+  InfluxWriterStats stats;
+  stats.running = IsRunning();
+  stats.online = IsOnline();
+  stats.queued = queued_.load();
+  stats.written = written_.load();
+  stats.dropped = dropped_.load();
+  stats.requests = requests_.load();
+  stats.retries = retries_.load();
+  stats.failed_batches = failed_batches_.load();
+  stats.spooled = spooled_.load();
+  stats.replayed = replayed_.load();
+  stats.bytes_raw = bytes_raw_.load();
+  stats.bytes_sent = bytes_sent_.load();
+  stats.spool_bytes = spool_size_.load();
+  stats.deletes = deletes_.load();
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    stats.queue_depth = queue_lines_;
+  }
+  return stats;
+}
+
+} // namespace Storage
+} // namespace PulseOne
@@ -10,12 +10,20 @@
 //=============================================================================
 
 #include "Storage/RedisDataWriter.h"
+#include "Client/LineProtocolEncoder.h"
 #include "Client/RedisClientImpl.h"
 #include "Common/Enums.h"
 #include "Common/Utils.h"
+#include "Data/RedisDataTypes.h"
+#include "Pipeline/PointMetadataRegistry.h"
+#include "Utils/ConfigManager.h"
+#include <algorithm>
+#include <cctype>
 #include <chrono>
+#include <cstdio>
 #include <iomanip>
 #include <sstream>
+#include <unordered_set>
 
 using LogLevel = PulseOne::Enums::LogLevel;
 using json = nlohmann::json;
@@ -23,6 +31,91 @@ using json = nlohmann::json;
 namespace PulseOne {
 namespace Storage {
 
+namespace {
+
+// point:device 인덱스 재기록 주기 (Redis 재시작/FLUSH 후 자가 복구)
+constexpr auto kPointIndexRefresh = std::chrono::minutes(10);
+
+using Shared::Data::RedisKeyFamily;
+using Shared::Data::RedisValueCodec;
+using Shared::Data::ValueEncoding;
+
+// 바이너리 인코딩용 값 (메타데이터 제외)
+Shared::Data::PointValueRecord
+ToPointRecord(const Structs::TimestampedValue &point) {
+  Shared::Data::PointValueRecord record;
+  record.point_id = point.point_id;
+  record.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+                         point.timestamp.time_since_epoch())
+                         .count();
+  record.quality = static_cast<int>(point.quality);
+  record.changed = point.value_changed;
+  std::visit(
+      [&record](const auto &v) {
+        using T = std::decay_t<decltype(v)>;
+        if constexpr (std::is_same_v<T, bool>) {
+          record.type = 'b';
+          record.int_value = v ? 1 : 0;
+        } else if constexpr (std::is_integral_v<T>) {
+          record.type = 'i';
+          record.int_value = static_cast<int64_t>(v);
+        } else if constexpr (std::is_floating_point_v<T>) {
+          record.type = 'd';
+          record.double_value = static_cast<double>(v);
+        } else if constexpr (std::is_same_v<T, std::string>) {
+          record.type = 's';
+          record.string_value = v;
+        } else {
+          record.type = 's';
+        }
+      },
+      point.value);
+  return record;
+}
+
+// 해시 필드 값 (Shared::Data::CompactPointValue 형식)
+std::string EncodeCompactValue(const Structs::TimestampedValue &point) {
+  char type = 'd';
+  std::string value = std::visit(
+      [&type](const auto &v) -> std::string {
+        using T = std::decay_t<decltype(v)>;
+        if constexpr (std::is_same_v<T, bool>) {
+          type = 'b';
+          return v ? "1" : "0";
+        } else if constexpr (std::is_integral_v<T>) {
+          type = 'i';
+          return std::to_string(v);
+        } else if constexpr (std::is_floating_point_v<T>) {
+          // 왕복 가능한 최단 표현 (Influx 라인과 같은 인코더, %.15g는 17자리
+          // 값을 잘라 다시 읽으면 달라짐). NaN/Inf만 기존 표기로
+          std::string text;
+          if (!Client::LineProtocolEncoder::AppendDouble(
+                  text, static_cast<double>(v))) {
+            char buf[16];
+            std::snprintf(buf, sizeof(buf), "%g", static_cast<double>(v));
+            text = buf;
+          }
+          return text;
+        } else if constexpr (std::is_same_v<T, std::string>) {
+          type = 's';
+          return v;
+        } else {
+          type = 's';
+          return std::string();
+        }
+      },
+      point.value);
+
+  return Shared::Data::CompactPointValue::Encode(
+      type, static_cast<int>(point.quality),
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          point.timestamp.time_since_epoch())
+          .count(),
+      value);
+}
+
+} // namespace
+
 // =============================================================================
 // 생성자 및 초기화
 // =============================================================================
@@ -30,6 +123,45 @@ namespace Storage {
 RedisDataWriter::RedisDataWriter(std::shared_ptr<RedisClient> redis_client)
     : redis_client_(redis_client) {
 
+  // 한 번에 보낼 최대 명령 수 (응답 버퍼/지연 상한)
+  pipeline_max_commands_ = static_cast<size_t>(std::max(
+      1, ConfigManager::getInstance().getInt("REDIS_PIPELINE_MAX_COMMANDS",
+                                             1000)));
+  pipeline_.reserve(pipeline_max_commands_);
+
+  const std::string layout =
+      ConfigManager::getInstance().getOrDefault("REDIS_STORAGE_LAYOUT",
+                                                "legacy");
+  if (layout == "hash") {
+    storage_layout_ = StorageLayout::DEVICE_HASH;
+  } else if (layout == "both") {
+    storage_layout_ = StorageLayout::BOTH;
+  } else if (layout != "legacy") {
+    LogManager::getInstance().log("redis_writer", LogLevel::WARN,
+                                  "알 수 없는 REDIS_STORAGE_LAYOUT: " + layout +
+                                      " - legacy 사용");
+  }
+
+  // 바이너리로 쓸 키 패밀리 (쉼표 구분, "all"은 전체)
+  std::stringstream families(
+      ConfigManager::getInstance().getOrDefault("REDIS_BINARY_FAMILIES", ""));
+  std::string name;
+  while (std::getline(families, name, ',')) {
+    name.erase(std::remove_if(name.begin(), name.end(), ::isspace),
+               name.end());
+    if (name.empty())
+      continue;
+    if (name == "all") {
+      family_encoding_.fill(ValueEncoding::MSGPACK);
+    } else if (auto family = Shared::Data::KeyFamilyFromName(name)) {
+      family_encoding_[static_cast<size_t>(*family)] = ValueEncoding::MSGPACK;
+    } else {
+      LogManager::getInstance().log("redis_writer", LogLevel::WARN,
+                                    "알 수 없는 REDIS_BINARY_FAMILIES 항목: " +
+                                        name);
+    }
+  }
+
   // Redis 클라이언트 자동 생성
   if (!redis_client_) {
     try {
@@ -44,6 +176,20 @@ RedisDataWriter::RedisDataWriter(std::shared_ptr<RedisClient> redis_client)
     }
   }
 
+  // 비동기 전송: 파이프라인 버퍼를 이벤트 루프 연결 하나로 보낸다
+  auto async_options = RedisAsyncOptions::FromConfig();
+  if (async_options.enabled) {
+    async_submit_wait_ = std::chrono::milliseconds(std::max(
+        0, ConfigManager::getInstance().getInt("REDIS_ASYNC_SUBMIT_WAIT_MS",
+                                               1000)));
+    async_client_ = std::make_unique<RedisAsyncClient>(async_options);
+    if (!async_client_->Start()) {
+      async_client_.reset();
+      LogManager::getInstance().log("redis_writer", LogLevel::WARN,
+                                    "비동기 Redis 사용 불가 - 동기 전송 사용");
+    }
+  }
+
   LogManager::getInstance().log("redis_writer", LogLevel::INFO,
                                 "RedisDataWriter 생성 완료");
 }
@@ -86,6 +232,25 @@ void RedisDataWriter::EnableFullDataStorage(bool enable) {
   store_full_data_ = enable;
 }
 
+void RedisDataWriter::SetStorageLayout(StorageLayout layout) {
+  std::lock_guard<std::mutex> lock(redis_mutex_);
+  storage_layout_ = layout;
+  LogManager::getInstance().log("redis_writer", LogLevel::INFO,
+                                "저장 레이아웃 변경: " +
+                                    std::to_string(static_cast<int>(layout)));
+}
+
+void RedisDataWriter::SetValueEncoding(RedisKeyFamily family,
+                                       ValueEncoding encoding) {
+  std::lock_guard<std::mutex> lock(redis_mutex_);
+  family_encoding_[static_cast<size_t>(family)] = encoding;
+  next_encoding_advertise_ = {}; // 다음 저장 때 바로 알림
+  LogManager::getInstance().log(
+      "redis_writer", LogLevel::INFO,
+      std::string("값 인코딩 변경: ") + Shared::Data::KeyFamilyName(family) +
+          " = " + Shared::Data::ValueEncodingName(encoding));
+}
+
 // =============================================================================
 // Backend 완전 호환 저장 메서드들 (메인 API)
 // =============================================================================
@@ -98,42 +263,117 @@ RedisDataWriter::SaveDeviceMessage(const Structs::DeviceDataMessage &message) {
   size_t total_saved = 0;
 
   try {
-    std::lock_guard<std::mutex> lock(redis_mutex_);
+    auto device_locks = LockDevices({&message.device_id});
+    std::unique_lock<std::mutex> lock(redis_mutex_);
+    total_saved = SaveMessageLocked(message, nullptr, true);
+    FlushPipelineUnlocked(lock);
+    return total_saved;
 
-    // 1. 경량 모드 저장
-    if (storage_mode_ == StorageMode::LIGHTWEIGHT ||
-        storage_mode_ == StorageMode::HYBRID) {
-      total_saved += SaveLightweightFormat(message);
-    }
+  } catch (const std::exception &e) {
+    HandleError("SaveDeviceMessage", e.what());
+    return 0;
+  }
+}
 
-    // 2. 완전 데이터 저장
-    if (storage_mode_ == StorageMode::FULL_DATA ||
-        storage_mode_ == StorageMode::HYBRID) {
-      total_saved += SaveFullDataFormat(message);
-    }
+size_t RedisDataWriter::SaveDeviceMessages(
+    const std::vector<const Structs::DeviceDataMessage *> &messages) {
+  if (!IsConnected() || messages.empty())
+    return 0;
 
-    // 3. Backend 호환 device:{id}:{name} 패턴
-    if (store_device_pattern_) {
-      total_saved += SaveDevicePatternFormat(message);
+  // 뒤에서부터 훑어 포인트/디바이스별 마지막 값만 표시
+  std::vector<PointMask> masks(messages.size());
+  std::vector<char> last_for_device(messages.size(), 0);
+  std::unordered_set<int> seen_points;
+  std::unordered_set<std::string> seen_devices;
+  for (size_t i = messages.size(); i-- > 0;) {
+    const auto &points = messages[i]->points;
+    masks[i].assign(points.size(), 0);
+    for (size_t p = points.size(); p-- > 0;) {
+      masks[i][p] = seen_points.insert(points[p].point_id).second ? 1 : 0;
     }
+    last_for_device[i] =
+        seen_devices.insert(messages[i]->device_id).second ? 1 : 0;
+  }
+
+  std::vector<const std::string *> device_ids;
+  device_ids.reserve(messages.size());
+  for (const auto *message : messages)
+    device_ids.push_back(&message->device_id);
 
-    // 4. point:{id}:latest 패턴
-    if (store_point_latest_) {
-      total_saved += SavePointLatestFormat(message);
+  size_t total_saved = 0;
+  try {
+    auto device_locks = LockDevices(device_ids);
+    std::unique_lock<std::mutex> lock(redis_mutex_);
+    for (size_t i = 0; i < messages.size(); ++i) {
+      total_saved +=
+          SaveMessageLocked(*messages[i], &masks[i], last_for_device[i] != 0);
     }
+    // 배치 전체가 왕복 1회 (상한 초과분만 추가 왕복)
+    FlushPipelineUnlocked(lock);
+  } catch (const std::exception &e) {
+    HandleError("SaveDeviceMessages", e.what());
+  }
+  return total_saved;
+}
 
-    return total_saved;
+size_t RedisDataWriter::SaveMessageLocked(
+    const Structs::DeviceDataMessage &message, const PointMask *point_mask,
+    bool save_full_data) {
+  size_t total_saved = 0;
+  AdvertiseEncodingLocked();
+
+  // 0. 디바이스 해시 레이아웃
+  if (WritesHashLayout()) {
+    total_saved +=
+        SaveDeviceHashFormat(ExtractDeviceNumber(message.device_id),
+                             message.points, point_mask, save_full_data);
+    if (!WritesLegacyLayout())
+      return total_saved;
+  }
 
-  } catch (const std::exception &e) {
-    HandleError("SaveDeviceMessage", e.what());
-    return 0;
+  // 1. 경량 모드 저장
+  if (storage_mode_ == StorageMode::LIGHTWEIGHT ||
+      storage_mode_ == StorageMode::HYBRID) {
+    total_saved += SaveLightweightFormat(message, point_mask);
+  }
+
+  // 2. 완전 데이터 저장
+  if (save_full_data && (storage_mode_ == StorageMode::FULL_DATA ||
+                         storage_mode_ == StorageMode::HYBRID)) {
+    total_saved += SaveFullDataFormat(message);
   }
+
+  // 3. Backend 호환 device:{id}:{name} 패턴
+  if (store_device_pattern_) {
+    total_saved += SaveDevicePatternFormat(message, point_mask);
+  }
+
+  // 4. point:{id}:latest 패턴
+  if (store_point_latest_) {
+    total_saved += SavePointLatestFormat(message, point_mask);
+  }
+
+  return total_saved;
 }
 
-size_t RedisDataWriter::SaveLightweightFormat(
-    const Structs::DeviceDataMessage &message) {
+size_t
+RedisDataWriter::SaveLightweightFormat(const Structs::DeviceDataMessage &message,
+                                       const PointMask *point_mask) {
   size_t saved = 0;
-  for (const auto &point : message.points) {
+  for (size_t i = 0; i < message.points.size(); ++i) {
+    if (point_mask && !(*point_mask)[i])
+      continue;
+    const auto &point = message.points[i];
+    std::string key = "point:" + std::to_string(point.point_id) + ":light";
+    if (UsesBinary(RedisKeyFamily::POINT_LIGHT)) {
+      QueueSetexLocked(key,
+                       EncodeBinaryPoint(point, std::string(),
+                                         RedisValueCodec::META_NONE),
+                       1800);
+      saved++;
+      continue;
+    }
+
     json light_data;
     light_data["id"] = point.point_id;
     light_data["val"] = ConvertValueToString(point.value);
@@ -142,8 +382,7 @@ size_t RedisDataWriter::SaveLightweightFormat(
                            .count();
     light_data["q"] = static_cast<int>(point.quality);
 
-    std::string key = "point:" + std::to_string(point.point_id) + ":light";
-    redis_client_->setex(key, light_data.dump(), 1800);
+    QueueSetexLocked(key, light_data.dump(), 1800);
     saved++;
   }
   return saved;
@@ -151,6 +390,27 @@ size_t RedisDataWriter::SaveLightweightFormat(
 
 size_t
 RedisDataWriter::SaveFullDataFormat(const Structs::DeviceDataMessage &message) {
+  const std::string device_num = ExtractDeviceNumber(message.device_id);
+
+  if (UsesBinary(RedisKeyFamily::DEVICE_FULL)) {
+    Shared::Data::DeviceSnapshotRecord snapshot;
+    snapshot.device_id = message.device_id;
+    snapshot.protocol = message.protocol;
+    snapshot.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+                             message.timestamp.time_since_epoch())
+                             .count();
+    snapshot.points.reserve(message.points.size());
+    for (const auto &point : message.points)
+      snapshot.points.push_back(ToPointRecord(point));
+
+    std::string payload;
+    RedisValueCodec::EncodeDeviceSnapshot(snapshot, payload);
+    QueueSetexLocked("device:full:" + device_num, payload, 3600);
+    QueueSetexLocked("current_values:" + device_num, std::move(payload), 3600);
+    stats_.binary_payloads.fetch_add(1);
+    return 1;
+  }
+
   json full_data;
   full_data["device_id"] = message.device_id;
   full_data["protocol"] = message.protocol;
@@ -173,50 +433,113 @@ RedisDataWriter::SaveFullDataFormat(const Structs::DeviceDataMessage &message) {
     full_data["points"].push_back(point_data);
   }
 
-  std::string key = "device:full:" + ExtractDeviceNumber(message.device_id);
-  redis_client_->setex(key, full_data.dump(), 3600);
+  std::string payload = full_data.dump();
+  QueueSetexLocked("device:full:" + device_num, payload, 3600);
 
   // 🔧 E2E 스크립트 호환성: current_values:{id} 키에도 동일한 JSON 저장
-  std::string cv_key =
-      "current_values:" + ExtractDeviceNumber(message.device_id);
-  redis_client_->setex(cv_key, full_data.dump(), 3600);
+  QueueSetexLocked("current_values:" + device_num, std::move(payload), 3600);
 
   return 1;
 }
 
 size_t RedisDataWriter::SaveDevicePatternFormat(
-    const Structs::DeviceDataMessage &message) {
+    const Structs::DeviceDataMessage &message, const PointMask *point_mask) {
   size_t saved = 0;
   std::string device_num = ExtractDeviceNumber(message.device_id);
 
-  for (const auto &point : message.points) {
+  for (size_t i = 0; i < message.points.size(); ++i) {
+    if (point_mask && !(*point_mask)[i])
+      continue;
+    const auto &point = message.points[i];
+    if (UsesBinary(RedisKeyFamily::DEVICE_POINT)) {
+      std::string point_name;
+      std::string payload = EncodeBinaryPoint(
+          point, device_num, RedisValueCodec::META_ALL, &point_name);
+      QueueSetexLocked("device:" + device_num + ":" + point_name,
+                       std::move(payload), 3600);
+      saved++;
+      continue;
+    }
+
     auto device_point = ConvertToDevicePointData(point, device_num);
     std::string device_key =
         "device:" + device_num + ":" + device_point.point_name;
-    redis_client_->setex(device_key, device_point.toJson().dump(), 3600);
+    QueueSetexLocked(device_key, device_point.toJson().dump(), 3600);
     saved++;
   }
   return saved;
 }
 
 size_t RedisDataWriter::SavePointLatestFormat(
-    const Structs::DeviceDataMessage &message) {
+    const Structs::DeviceDataMessage &message, const PointMask *point_mask) {
   size_t saved = 0;
   std::string device_num = ExtractDeviceNumber(message.device_id);
 
-  for (const auto &point : message.points) {
-    auto point_latest = ConvertToPointLatestData(point, device_num);
-    std::string point_key =
-        "point:" + std::to_string(point.point_id) + ":latest";
-    redis_client_->setex(point_key, point_latest.toJson().dump(), 3600);
+  for (size_t i = 0; i < message.points.size(); ++i) {
+    if (point_mask && !(*point_mask)[i])
+      continue;
+    const auto &point = message.points[i];
+    const std::string point_prefix =
+        "point:" + std::to_string(point.point_id);
+    std::string payload =
+        UsesBinary(RedisKeyFamily::POINT_LATEST)
+            ? EncodeBinaryPoint(point, device_num,
+                                RedisValueCodec::META_DEVICE_ID)
+            : ConvertToPointLatestData(point, device_num).toJson().dump();
+    QueueSetexLocked(point_prefix + ":latest", payload, 3600);
 
     // 🔧 ScheduledExporter 호환성: :current 키에도 저장
-    std::string current_key =
-        "point:" + std::to_string(point.point_id) + ":current";
-    redis_client_->setex(current_key, point_latest.toJson().dump(), 3600);
+    QueueSetexLocked(point_prefix + ":current", std::move(payload), 3600);
+
+    saved++;
+  }
+  return saved;
+}
+
+size_t RedisDataWriter::SaveDeviceHashFormat(
+    const std::string &device_num,
+    const std::vector<Structs::TimestampedValue> &points,
+    const PointMask *point_mask, bool refresh_expire, int expire_seconds) {
+  const std::string hash_key =
+      Shared::Data::RedisKeyBuilder::DeviceValuesKey(device_num);
+
+  const auto now = std::chrono::steady_clock::now();
+  if (now >= index_reset_at_) {
+    indexed_points_.clear();
+    index_reset_at_ = now + kPointIndexRefresh;
+  }
 
+  RedisClient::StringList hset{"HSET", hash_key};
+  RedisClient::StringList index{
+      "HSET", Shared::Data::RedisKeyBuilder::PointDeviceIndexKey()};
+  size_t saved = 0;
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (point_mask && !(*point_mask)[i])
+      continue;
+    const auto &point = points[i];
+    const std::string field = std::to_string(point.point_id);
+    hset.push_back(field);
+    hset.push_back(UsesBinary(RedisKeyFamily::DEVICE_HASH)
+                       ? EncodeBinaryPoint(point, device_num,
+                                           RedisValueCodec::META_NONE)
+                       : EncodeCompactValue(point));
+    if (indexed_points_.insert(point.point_id).second) {
+      index.push_back(field);
+      index.push_back(device_num);
+    }
     saved++;
   }
+  if (saved == 0)
+    return 0;
+
+  QueueCommandLocked(std::move(hset));
+  // 해시 키 하나에 TTL 한 번 (배치에서는 디바이스의 마지막 메시지만)
+  if (refresh_expire)
+    QueueCommandLocked({"EXPIRE", hash_key, std::to_string(expire_seconds)});
+  if (index.size() > 2)
+    QueueCommandLocked(std::move(index));
+
+  stats_.device_hash_writes.fetch_add(saved);
   return saved;
 }
 
@@ -230,23 +553,42 @@ bool RedisDataWriter::SaveSinglePoint(const Structs::TimestampedValue &point,
     std::lock_guard<std::mutex> lock(redis_mutex_);
 
     std::string device_num = ExtractDeviceNumber(device_id);
-    auto device_point = ConvertToDevicePointData(point, device_num);
-
-    // 1. device:{id}:{name} 키 저장
-    std::string device_key =
-        "device:" + device_num + ":" + device_point.point_name;
-    redis_client_->setex(device_key, device_point.toJson().dump(), 3600);
-
-    // 2. point:{id}:latest 키 저장
-    auto point_latest = ConvertToPointLatestData(point, device_num);
-    std::string point_key =
-        "point:" + std::to_string(point.point_id) + ":latest";
-    redis_client_->setex(point_key, point_latest.toJson().dump(), 3600);
+    std::string device_key = "device:" + device_num + ":";
+    AdvertiseEncodingLocked();
+
+    if (WritesHashLayout())
+      SaveDeviceHashFormat(device_num, {point}, nullptr, true);
+
+    if (WritesLegacyLayout()) {
+      // 1. device:{id}:{name} 키 저장
+      if (UsesBinary(RedisKeyFamily::DEVICE_POINT)) {
+        std::string point_name;
+        std::string device_payload = EncodeBinaryPoint(
+            point, device_num, RedisValueCodec::META_ALL, &point_name);
+        device_key += point_name;
+        QueueSetexLocked(device_key, std::move(device_payload), 3600);
+      } else {
+        auto device_point = ConvertToDevicePointData(point, device_num);
+        device_key += device_point.point_name;
+        QueueSetexLocked(device_key, device_point.toJson().dump(), 3600);
+      }
 
-    // 🔧 ScheduledExporter 호환성: :current 키에도 저장
-    std::string current_key =
-        "point:" + std::to_string(point.point_id) + ":current";
-    redis_client_->setex(current_key, point_latest.toJson().dump(), 3600);
+      // 2. point:{id}:latest 키 저장
+      std::string point_key =
+          "point:" + std::to_string(point.point_id) + ":latest";
+      std::string payload =
+          UsesBinary(RedisKeyFamily::POINT_LATEST)
+              ? EncodeBinaryPoint(point, device_num,
+                                  RedisValueCodec::META_DEVICE_ID)
+              : ConvertToPointLatestData(point, device_num).toJson().dump();
+      QueueSetexLocked(point_key, payload, 3600);
+
+      // 🔧 ScheduledExporter 호환성: :current 키에도 저장
+      std::string current_key =
+          "point:" + std::to_string(point.point_id) + ":current";
+      QueueSetexLocked(current_key, std::move(payload), 3600);
+    }
+    FlushPipelineLocked();
 
     stats_.total_writes.fetch_add(1);
     stats_.successful_writes.fetch_add(1);
@@ -275,40 +617,44 @@ bool RedisDataWriter::PublishAlarmEvent(
 
     std::string json_str = alarm_data.toJson().dump();
 
+    // 아래 명령은 모두 파이프라인으로 모아 왕복 1회로 전송
     // 1. 여러 채널에 발행
-    redis_client_->publish("alarms:all", json_str);
-    redis_client_->publish(
-        "tenant:" + std::to_string(alarm_data.tenant_id) + ":alarms", json_str);
+    QueueCommandLocked({"PUBLISH", "alarms:all", json_str});
+    QueueCommandLocked(
+        {"PUBLISH",
+         "tenant:" + std::to_string(alarm_data.tenant_id) + ":alarms",
+         json_str});
 
     // device_id 처리: "device_001" → "1" 변환 후 publish
     // Gateway selective 모드가 "device:{numeric_id}:alarms"를 구독하므로
     // ExtractDeviceNumber()로 숫자 ID만 추출
     if (!alarm_data.device_id.empty()) {
       std::string device_num = ExtractDeviceNumber(alarm_data.device_id);
-      redis_client_->publish("device:" + device_num + ":alarms", json_str);
+      QueueCommandLocked(
+          {"PUBLISH", "device:" + device_num + ":alarms", json_str});
     }
 
     // 🔧 수정: severity는 std::string 타입 (문자열 비교)
     if (alarm_data.severity == "CRITICAL" ||
         alarm_data.severity == "critical") {
-      redis_client_->publish("alarms:critical", json_str);
+      QueueCommandLocked({"PUBLISH", "alarms:critical", json_str});
     } else if (alarm_data.severity == "HIGH" || alarm_data.severity == "high") {
-      redis_client_->publish("alarms:high", json_str);
+      QueueCommandLocked({"PUBLISH", "alarms:high", json_str});
     }
 
     // 🔧 수정: state는 std::string 타입 (문자열 비교)
     if (alarm_data.state == "active" || alarm_data.state == "ACTIVE") {
       std::string active_key =
           "alarm:active:" + std::to_string(alarm_data.rule_id);
-      redis_client_->setex(active_key, json_str, 7200); // 2시간 TTL
+      QueueSetexLocked(active_key, json_str, 7200); // 2시간 TTL
     } else if (alarm_data.state == "cleared" || alarm_data.state == "CLEARED") {
       std::string active_key =
           "alarm:active:" + std::to_string(alarm_data.rule_id);
-      redis_client_->del(active_key);
+      QueueCommandLocked({"DEL", active_key});
     }
 
     // 2.5 History List 저장 (테스트 및 감사용) - Added
-    redis_client_->lpush("alarm:history", json_str);
+    QueueCommandLocked({"LPUSH", "alarm:history", json_str});
     // redis_client_->ltrim("alarm:history", 0, 999); // Not supported in
     // interface yet
 
@@ -317,8 +663,9 @@ bool RedisDataWriter::PublishAlarmEvent(
     // Redis INCR은 원자 연산이므로 race condition 없이 정확하게 증가.
     // expire()로 자정 이후 자동 만료 (24h TTL 갱신).
     std::string counter_key = "alarms:count:today";
-    redis_client_->incr(counter_key, 1);
-    redis_client_->expire(counter_key, 86400);
+    QueueCommandLocked({"INCR", counter_key});
+    QueueCommandLocked({"EXPIRE", counter_key, "86400"});
+    FlushPipelineLocked();
 
     stats_.total_writes.fetch_add(1);
     stats_.successful_writes.fetch_add(1);
@@ -353,41 +700,65 @@ size_t RedisDataWriter::SaveWorkerInitialData(
 
     std::string device_num = ExtractDeviceNumber(device_id);
     size_t success_count = 0;
+    AdvertiseEncodingLocked();
 
     LogManager::getInstance().log(
         "redis_writer", LogLevel::INFO,
         "Worker 초기화 데이터 저장: " + device_id + " (" +
             std::to_string(current_values.size()) + "개 포인트)");
 
+    if (WritesHashLayout()) {
+      SaveDeviceHashFormat(device_num, current_values, nullptr, true, 7200);
+      if (!WritesLegacyLayout())
+        success_count = current_values.size();
+    }
+
     for (const auto &value : current_values) {
+      if (!WritesLegacyLayout())
+        break;
       try {
-        auto device_point = ConvertToDevicePointData(value, device_num);
+        std::string device_key = "device:" + device_num + ":";
+        if (UsesBinary(RedisKeyFamily::DEVICE_POINT)) {
+          // 바이너리에는 source 필드가 없다 (changed=false로 초기값 표시)
+          auto initial = value;
+          initial.value_changed = false;
+          std::string point_name;
+          std::string device_payload = EncodeBinaryPoint(
+              initial, device_num, RedisValueCodec::META_ALL, &point_name);
+          device_key += point_name;
+          QueueSetexLocked(device_key, std::move(device_payload), 7200);
+        } else {
+          auto device_point = ConvertToDevicePointData(value, device_num);
 
-        // 초기화 소스 표시
-        auto json_data = device_point.toJson();
-        json_data["source"] = "worker_init";
-        json_data["changed"] = false; // 초기값은 변경 아님
+          // 초기화 소스 표시
+          auto json_data = device_point.toJson();
+          json_data["source"] = "worker_init";
+          json_data["changed"] = false; // 초기값은 변경 아님
 
-        std::string device_key =
-            "device:" + device_num + ":" + device_point.point_name;
-        redis_client_->setex(device_key, json_data.dump(), 7200); // 2시간 TTL
+          device_key += device_point.point_name;
+          QueueSetexLocked(device_key, json_data.dump(), 7200); // 2시간 TTL
+        }
 
         // Legacy 키도 저장
-        auto point_latest = ConvertToPointLatestData(value, device_num);
         std::string point_key =
             "point:" + std::to_string(value.point_id) + ":latest";
-        redis_client_->setex(point_key, point_latest.toJson().dump(), 7200);
+        std::string payload =
+            UsesBinary(RedisKeyFamily::POINT_LATEST)
+                ? EncodeBinaryPoint(value, device_num,
+                                    RedisValueCodec::META_DEVICE_ID)
+                : ConvertToPointLatestData(value, device_num).toJson().dump();
+        QueueSetexLocked(point_key, payload, 7200);
 
         // 🔧 ScheduledExporter 호환성: :current 키에도 저장
         std::string current_key =
             "point:" + std::to_string(value.point_id) + ":current";
-        redis_client_->setex(current_key, point_latest.toJson().dump(), 7200);
+        QueueSetexLocked(current_key, std::move(payload), 7200);
 
         success_count++;
 
         LogManager::getInstance().log("redis_writer", LogLevel::DEBUG_LEVEL,
                                       "초기값 저장: " + device_key + " = " +
-                                          device_point.value);
+                                          ConvertValueToString(value.value));
 
       } catch (const std::exception &e) {
         LogManager::getInstance().log("redis_writer", LogLevel::WARN,
@@ -409,12 +780,14 @@ size_t RedisDataWriter::SaveWorkerInitialData(
       init_notification["points_loaded"] = success_count;
       init_notification["total_points"] = current_values.size();
 
-      redis_client_->publish("worker:notifications", init_notification.dump());
+      QueueCommandLocked(
+          {"PUBLISH", "worker:notifications", init_notification.dump()});
     } catch (const std::exception &e) {
       LogManager::getInstance().log("redis_writer", LogLevel::WARN,
                                     "초기화 알림 발송 실패: " +
                                         std::string(e.what()));
     }
+    FlushPipelineLocked();
 
     stats_.total_writes.fetch_add(1);
     stats_.worker_init_writes.fetch_add(success_count);
@@ -460,6 +833,11 @@ size_t RedisDataWriter::SyncWorkerDataPoints(
                                       " (" + std::to_string(points.size()) +
                                       "개 포인트)");
 
+    // 해시 레이아웃만 쓰면 자리표시 키를 만들지 않는다 (레거시 키가 남아
+    // 해시의 실제 값을 가리지 않도록)
+    if (!WritesLegacyLayout())
+      return points.size();
+
     for (const auto &point : points) {
       std::string point_name = point.name;
       if (point_name.empty())
@@ -492,7 +870,7 @@ size_t RedisDataWriter::SyncWorkerDataPoints(
         data.data_type = point.data_type;
         data.unit = point.unit;
 
-        redis_client_->setex(device_key, data.toJson().dump(), 7200);
+        QueueSetexLocked(device_key, data.toJson().dump(), 7200);
 
         // PointLatestData도 생성
         BackendFormat::PointLatestData latest_data;
@@ -503,11 +881,11 @@ size_t RedisDataWriter::SyncWorkerDataPoints(
         latest_data.quality = 2; // UNCERTAIN
         latest_data.changed = false;
 
-        redis_client_->setex(point_key, latest_data.toJson().dump(), 7200);
+        QueueSetexLocked(point_key, latest_data.toJson().dump(), 7200);
 
         // 🔧 ScheduledExporter 호환성: :current 키에도 저장
         std::string current_key = "point:" + point.id + ":current";
-        redis_client_->setex(current_key, latest_data.toJson().dump(), 7200);
+        QueueSetexLocked(current_key, latest_data.toJson().dump(), 7200);
 
         LogManager::getInstance().log("redis_writer", LogLevel::DEBUG_LEVEL,
                                       "새 포인트 Redis 키 생성: " + device_key);
@@ -521,6 +899,7 @@ size_t RedisDataWriter::SyncWorkerDataPoints(
       }
       synced_count++;
     }
+    FlushPipelineLocked();
 
     return synced_count;
 
@@ -539,7 +918,8 @@ bool RedisDataWriter::SaveWorkerStatus(const std::string &device_id,
   }
 
   try {
-    std::lock_guard<std::mutex> lock(redis_mutex_);
+    auto device_locks = LockDevices({&device_id});
+    std::unique_lock<std::mutex> lock(redis_mutex_);
 
     std::string device_num = ExtractDeviceNumber(device_id);
 
@@ -558,7 +938,7 @@ bool RedisDataWriter::SaveWorkerStatus(const std::string &device_id,
 
     // Worker 상태 저장
     std::string status_key = "worker:" + device_id + ":status";
-    redis_client_->setex(status_key, worker_status.dump(), 3600);
+    QueueSetexLocked(status_key, worker_status.dump(), 3600);
 
     // Device 상태도 업데이트
     std::string device_status_key = "device:" + device_num + ":status";
@@ -570,7 +950,7 @@ bool RedisDataWriter::SaveWorkerStatus(const std::string &device_id,
     device_status["last_communication"] = worker_status["timestamp"];
     device_status["worker_status"] = status;
 
-    redis_client_->setex(device_status_key, device_status.dump(), 3600);
+    QueueSetexLocked(device_status_key, device_status.dump(), 3600);
 
     // 상태 변화 알림 발송
     json status_notification;
@@ -579,7 +959,9 @@ bool RedisDataWriter::SaveWorkerStatus(const std::string &device_id,
     status_notification["status"] = status;
     status_notification["timestamp"] = worker_status["timestamp"];
 
-    redis_client_->publish("worker:status", status_notification.dump());
+    QueueCommandLocked(
+        {"PUBLISH", "worker:status", status_notification.dump()});
+    FlushPipelineUnlocked(lock);
 
     stats_.total_writes.fetch_add(1);
     stats_.successful_writes.fetch_add(1);
@@ -639,17 +1021,24 @@ BackendFormat::DevicePointData RedisDataWriter::ConvertToDevicePointData(
 
   BackendFormat::DevicePointData data;
 
+  const auto metadata = Pipeline::PointMetadataRegistry::getInstance().Find(
+      point.point_id, point.is_virtual_point);
+
   data.point_id = point.point_id;
   data.device_id = device_num;
-  data.device_name = "Device " + device_num;
-  data.point_name = GetPointName(point.point_id);
+  data.device_name = metadata && !metadata->device_name.empty()
+                         ? metadata->device_name
+                         : "Device " + device_num;
+  data.point_name = metadata && !metadata->name.empty()
+                        ? metadata->name
+                        : "point_" + std::to_string(point.point_id);
   data.value = ConvertValueToString(point.value);
   data.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
                        point.timestamp.time_since_epoch())
                        .count();
   data.quality = ConvertQualityToString(point.quality);
   data.data_type = GetDataTypeString(point.value);
-  data.unit = GetUnit(point.point_id);
+  data.unit = metadata ? metadata->unit : std::string();
   // data.changed = point.value_changed;
 
   return data;
@@ -760,62 +1149,166 @@ RedisDataWriter::ExtractDeviceNumber(const std::string &device_id) const {
   }
 }
 
-std::string RedisDataWriter::GetPointName(int point_id) const {
-  // 캐시 확인
-  std::lock_guard<std::mutex> lock(cache_mutex_);
-  auto it = point_name_cache_.find(point_id);
-  if (it != point_name_cache_.end()) {
-    return it->second;
+std::string RedisDataWriter::GetPointName(int point_id,
+                                          bool is_virtual) const {
+  return Pipeline::PointMetadataRegistry::getInstance().NameOf(point_id,
+                                                               is_virtual);
+}
+
+std::string RedisDataWriter::GetUnit(int point_id, bool is_virtual) const {
+  return Pipeline::PointMetadataRegistry::getInstance().UnitOf(point_id,
+                                                               is_virtual);
+}
+
+std::string RedisDataWriter::GetDeviceIdForPoint(int point_id) const {
+  // 포인트 ID를 기반으로 디바이스 ID 추론 (임시 로직)
+  return "device_" + std::to_string(point_id / 100 + 1);
+}
+
+// =============================================================================
+// 바이너리 값 인코딩
+// =============================================================================
+
+std::string RedisDataWriter::EncodeBinaryPoint(
+    const Structs::TimestampedValue &point, const std::string &device_num,
+    int metadata, std::string *point_name) {
+  auto record = ToPointRecord(point);
+  if (metadata >= RedisValueCodec::META_DEVICE_ID)
+    record.device_id = device_num;
+  if (metadata >= RedisValueCodec::META_ALL) {
+    // ConvertToDevicePointData와 같은 기본값
+    const auto meta = Pipeline::PointMetadataRegistry::getInstance().Find(
+        point.point_id, point.is_virtual_point);
+    record.point_name = meta && !meta->name.empty()
+                            ? meta->name
+                            : "point_" + std::to_string(point.point_id);
+    record.unit = meta ? meta->unit : std::string();
+    record.device_name = meta && !meta->device_name.empty()
+                             ? meta->device_name
+                             : "Device " + device_num;
+    if (point_name)
+      *point_name = record.point_name;
+  }
+
+  std::string payload;
+  RedisValueCodec::EncodePoint(record, metadata, payload);
+  stats_.binary_payloads.fetch_add(1);
+  return payload;
+}
+
+void RedisDataWriter::AdvertiseEncodingLocked() {
+  const auto now = std::chrono::steady_clock::now();
+  if (now < next_encoding_advertise_)
+    return;
+  next_encoding_advertise_ = now + kPointIndexRefresh;
+
+  RedisClient::StringList hset{
+      "HSET", Shared::Data::RedisKeyBuilder::ValueEncodingKey()};
+  for (size_t i = 0; i < family_encoding_.size(); ++i) {
+    hset.push_back(
+        Shared::Data::KeyFamilyName(static_cast<RedisKeyFamily>(i)));
+    hset.push_back(Shared::Data::ValueEncodingName(family_encoding_[i]));
   }
+  QueueCommandLocked(std::move(hset));
+}
+
+// =============================================================================
+// 파이프라인
+// =============================================================================
 
-  // Backend realtime.js와 일치하는 포인트 이름들
-  std::unordered_map<int, std::string> point_names = {
-      {1, "temperature_sensor_01"},
-      {2, "pressure_sensor_01"},
-      {3, "flow_rate"},
-      {4, "pump_status"},
-      {5, "room_temperature"},
-      {6, "humidity_level"},
-      {7, "fan_speed"},
-      {8, "cooling_mode"},
-      {9, "voltage_l1"},
-      {10, "current_l1"},
-      {11, "power_total"},
-      {12, "energy_consumed"}};
+void RedisDataWriter::QueueCommandLocked(RedisClient::StringList command) {
+  pipeline_.push_back(std::move(command));
+  if (pipeline_.size() >= pipeline_max_commands_)
+    FlushPipelineLocked();
+}
 
-  auto name_it = point_names.find(point_id);
-  std::string point_name = (name_it != point_names.end())
-                               ? name_it->second
-                               : ("point_" + std::to_string(point_id));
+void RedisDataWriter::QueueSetexLocked(const std::string &key,
+                                       std::string value, int expire_seconds) {
+  QueueCommandLocked(
+      {"SETEX", key, std::to_string(expire_seconds), std::move(value)});
+}
+
+size_t RedisDataWriter::FlushPipelineLocked() {
+  if (pipeline_.empty())
+    return 0;
 
-  // 캐시에 저장
-  point_name_cache_[point_id] = point_name;
-  return point_name;
+  std::vector<RedisClient::StringList> commands;
+  commands.swap(pipeline_);
+  pipeline_.reserve(commands.size());
+  return SendCommands(redis_client_, std::move(commands));
 }
 
-std::string RedisDataWriter::GetUnit(int point_id) const {
-  // 캐시 확인
-  std::lock_guard<std::mutex> lock(cache_mutex_);
-  auto it = unit_cache_.find(point_id);
-  if (it != unit_cache_.end()) {
-    return it->second;
+size_t
+RedisDataWriter::FlushPipelineUnlocked(std::unique_lock<std::mutex> &lock) {
+  if (pipeline_.empty()) {
+    lock.unlock();
+    return 0;
   }
 
-  std::unordered_map<int, std::string> units = {
-      {1, "°C"},  {2, "bar"}, {3, "L/min"}, {4, ""},   {5, "°C"}, {6, "%"},
-      {7, "rpm"}, {8, ""},    {9, "V"},     {10, "A"}, {11, "W"}, {12, "kWh"}};
+  std::vector<RedisClient::StringList> commands;
+  commands.swap(pipeline_);
+  pipeline_.reserve(commands.size());
+  std::shared_ptr<RedisClient> client = redis_client_;
+  lock.unlock();
 
-  auto unit_it = units.find(point_id);
-  std::string unit = (unit_it != units.end()) ? unit_it->second : "";
+  return SendCommands(client, std::move(commands));
+}
+
+size_t
+RedisDataWriter::SendCommands(const std::shared_ptr<RedisClient> &client,
+                              std::vector<RedisClient::StringList> commands) {
+  const size_t sent = commands.size();
+  stats_.pipeline_flushes.fetch_add(1);
+  stats_.pipelined_commands.fetch_add(sent);
+
+  if (async_client_ && async_client_->IsRunning()) {
+    // 완료 콜백은 루프 스레드에서 호출되므로 카운터만 갱신
+    const bool accepted = async_client_->SubmitBatch(
+        std::move(commands),
+        [this, sent](size_t ok) {
+          if (ok < sent)
+            stats_.pipeline_errors.fetch_add(sent - ok);
+        },
+        async_submit_wait_);
+    if (accepted)
+      return sent;
+
+    stats_.async_rejected.fetch_add(sent);
+    stats_.pipeline_errors.fetch_add(sent);
+    LogManager::getInstance().log("redis_writer", LogLevel::WARN,
+                                  "비동기 Redis 큐 포화: " +
+                                      std::to_string(sent) + "개 명령 버림");
+    return 0;
+  }
 
-  // 캐시에 저장
-  unit_cache_[point_id] = unit;
-  return unit;
+  const size_t ok = client ? client->pipeline(commands) : 0;
+  if (ok < sent) {
+    stats_.pipeline_errors.fetch_add(sent - ok);
+    LogManager::getInstance().log("redis_writer", LogLevel::WARN,
+                                  "Redis 파이프라인 일부 실패: " +
+                                      std::to_string(ok) + "/" +
+                                      std::to_string(sent) + "개 성공");
+  }
+  return ok;
 }
 
-std::string RedisDataWriter::GetDeviceIdForPoint(int point_id) const {
-  // 포인트 ID를 기반으로 디바이스 ID 추론 (임시 로직)
-  return "device_" + std::to_string(point_id / 100 + 1);
+std::vector<std::unique_lock<std::mutex>> RedisDataWriter::LockDevices(
+    const std::vector<const std::string *> &device_ids) const {
+  std::vector<size_t> stripes;
+  stripes.reserve(device_ids.size());
+  for (const auto *device_id : device_ids) {
+    const std::string device_num = ExtractDeviceNumber(*device_id);
+    stripes.push_back(std::hash<std::string>{}(device_num) %
+                      kDeviceLockStripes);
+  }
+  std::sort(stripes.begin(), stripes.end());
+  stripes.erase(std::unique(stripes.begin(), stripes.end()), stripes.end());
+
+  std::vector<std::unique_lock<std::mutex>> locks;
+  locks.reserve(stripes.size());
+  for (size_t stripe : stripes)
+    locks.emplace_back(device_locks_[stripe]);
+  return locks;
 }
 
 void RedisDataWriter::HandleError(const std::string &context,
@@ -841,6 +1334,12 @@ nlohmann::json RedisDataWriter::GetStatistics() const {
   stats_json["point_latest_writes"] = stats_.point_latest_writes.load();
   stats_json["alarm_publishes"] = stats_.alarm_publishes.load();
   stats_json["worker_init_writes"] = stats_.worker_init_writes.load();
+  stats_json["pipeline_flushes"] = stats_.pipeline_flushes.load();
+  stats_json["pipelined_commands"] = stats_.pipelined_commands.load();
+  stats_json["pipeline_errors"] = stats_.pipeline_errors.load();
+  stats_json["device_hash_writes"] = stats_.device_hash_writes.load();
+  stats_json["binary_payloads"] = stats_.binary_payloads.load();
+  stats_json["async_rejected"] = stats_.async_rejected.load();
 
   return stats_json;
 }
@@ -853,6 +1352,12 @@ void RedisDataWriter::ResetStatistics() {
   stats_.point_latest_writes.store(0);
   stats_.alarm_publishes.store(0);
   stats_.worker_init_writes.store(0);
+  stats_.pipeline_flushes.store(0);
+  stats_.pipelined_commands.store(0);
+  stats_.pipeline_errors.store(0);
+  stats_.device_hash_writes.store(0);
+  stats_.binary_payloads.store(0);
+  stats_.async_rejected.store(0);
 
   LogManager::getInstance().log("redis_writer", LogLevel::INFO,
                                 "Redis 쓰기 통계 리셋 완료");
@@ -863,8 +1368,47 @@ json RedisDataWriter::GetStatus() const {
   status["connected"] = IsConnected();
   status["statistics"] = GetStatistics(); // 이제 json 반환
   status["redis_client_available"] = (redis_client_ != nullptr);
-  status["cache_size"] = {{"point_names", point_name_cache_.size()},
-                          {"units", unit_cache_.size()}};
+  if (auto impl = std::dynamic_pointer_cast<RedisClientImpl>(redis_client_)) {
+    const auto client_stats = impl->getStats();
+    status["connection_pool"] = {
+        {"size", client_stats.pool_size},
+        {"open", client_stats.pool_open},
+        {"checkouts", client_stats.pool_checkouts},
+        {"waits", client_stats.pool_waits},
+        {"wait_timeouts", client_stats.pool_wait_timeouts},
+        {"wait_us_total", client_stats.pool_wait_us_total},
+        {"wait_us_max", client_stats.pool_wait_us_max},
+        {"connects", client_stats.pool_connects},
+        {"health_failures", client_stats.pool_health_failures}};
+  }
+  {
+    std::lock_guard<std::mutex> lock(redis_mutex_);
+    json encodings;
+    for (size_t i = 0; i < family_encoding_.size(); ++i) {
+      encodings[Shared::Data::KeyFamilyName(static_cast<RedisKeyFamily>(i))] =
+          Shared::Data::ValueEncodingName(family_encoding_[i]);
+    }
+    status["value_encoding"] = encodings;
+  }
+  if (async_client_) {
+    const auto async_stats = async_client_->GetStats();
+    status["async"] = {{"connected", async_stats.connected},
+                       {"submitted", async_stats.submitted},
+                       {"completed", async_stats.completed},
+                       {"failed", async_stats.failed},
+                       {"rejected", async_stats.rejected},
+                       {"write_batches", async_stats.write_batches},
+                       {"batched_commands", async_stats.batched_commands},
+                       {"reconnects", async_stats.reconnects},
+                       {"latency_us_total", async_stats.latency_us_total},
+                       {"latency_us_max", async_stats.latency_us_max},
+                       {"queued", async_stats.queued},
+                       {"in_flight", async_stats.in_flight}};
+  }
+  status["point_metadata"] = {
+      {"points", Pipeline::PointMetadataRegistry::getInstance().Size()},
+      {"generation",
+       Pipeline::PointMetadataRegistry::getInstance().Generation()}};
 
   return status;
 }
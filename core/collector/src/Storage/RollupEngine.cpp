@@ -0,0 +1,254 @@
+// =============================================================================
+// collector/src/Storage/RollupEngine.cpp - 스트리밍 롤업(다운샘플링) 엔진
+// =============================================================================
+
+#include "Storage/RollupEngine.h"
+#include "Utils/ConfigManager.h"
+
+#include <algorithm>
+
+namespace PulseOne {
+namespace Storage {
+
+namespace {
+
+constexpr int64_t TIER_WIDTH_MS[ROLLUP_TIER_COUNT] = {60 * 1000, 15 * 60 * 1000,
+                                                      60 * 60 * 1000};
+constexpr const char *TIER_SUFFIX[ROLLUP_TIER_COUNT] = {"1m", "15m", "1h"};
+
+int64_t AlignDown(int64_t ms, int64_t width) {
+  int64_t start = ms - ms % width;
+  if (ms < 0 && ms % width != 0)
+    start -= width;
+  return start;
+}
+
+} // namespace
+
+// =============================================================================
+// 설정
+// =============================================================================
+
+RollupOptions RollupOptions::FromConfig() {
+  auto &config = ConfigManager::getInstance();
+  RollupOptions options;
+
+  options.enabled = config.getBool("ROLLUP_ENABLED", false);
+  options.to_influx = config.getBool("ROLLUP_TO_INFLUX", true);
+  options.to_sqlite = config.getBool("ROLLUP_TO_SQLITE", false);
+  options.flush_interval_ms =
+      std::clamp(config.getInt("ROLLUP_FLUSH_MS", 5000), 100, 30000);
+  options.grace_ms = std::max(config.getInt("ROLLUP_GRACE_MS", 2000), 0);
+  options.raw_retention_hours =
+      std::max(config.getInt("ROLLUP_RAW_RETENTION_HOURS", 24 * 7), 0);
+  options.retention_hours[0] =
+      std::max(config.getInt("ROLLUP_1M_RETENTION_HOURS", 24 * 30), 0);
+  options.retention_hours[1] =
+      std::max(config.getInt("ROLLUP_15M_RETENTION_HOURS", 24 * 180), 0);
+  options.retention_hours[2] =
+      std::max(config.getInt("ROLLUP_1H_RETENTION_HOURS", 24 * 730), 0);
+  options.retention_sweep_minutes =
+      std::max(config.getInt("ROLLUP_RETENTION_SWEEP_MIN", 60), 1);
+  return options;
+}
+
+int64_t RollupEngine::TierWidthMs(RollupTier tier) {
+  return TIER_WIDTH_MS[static_cast<size_t>(tier)];
+}
+
+const char *RollupEngine::TierSuffix(RollupTier tier) {
+  return TIER_SUFFIX[static_cast<size_t>(tier)];
+}
+
+bool RollupEngine::ParseTierSuffix(const std::string &suffix,
+                                   RollupTier &tier) {
+  for (size_t i = 0; i < ROLLUP_TIER_COUNT; ++i) {
+    if (suffix == TIER_SUFFIX[i]) {
+      tier = static_cast<RollupTier>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+// =============================================================================
+// 누적 (처리 스레드)
+// =============================================================================
+
+void RollupEngine::Add(int point_id, std::chrono::system_clock::time_point time,
+                       double value) {
+  const uint32_t index =
+      Pipeline::PointIndexRegistry::getInstance().Acquire(point_id);
+  if (index == Pipeline::PointIndexRegistry::INVALID_INDEX)
+    return;
+
+  const int64_t ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                         time.time_since_epoch())
+                         .count();
+
+  Slot &slot = slots_.At(index);
+  SlotLock lock(slot);
+
+  for (size_t tier = 0; tier < ROLLUP_TIER_COUNT; ++tier) {
+    const int64_t start = AlignDown(ms, TIER_WIDTH_MS[tier]);
+    Window &open = slot.open[tier];
+
+    if (start <= slot.emitted_start[tier] ||
+        (open.start_ms >= 0 && start < open.start_ms)) {
+      // 이미 지난 윈도우 (가장 짧은 티어에서만 집계)
+      if (tier == 0)
+        late_samples_.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+
+    if (open.start_ms >= 0 && start > open.start_ms) {
+      Window &closed = slot.closed[tier];
+      if (closed.start_ms >= 0)
+        overwritten_.fetch_add(1, std::memory_order_relaxed);
+      closed = open;
+      open.start_ms = -1;
+    }
+
+    if (open.start_ms < 0) {
+      open.start_ms = start;
+      open.min = value;
+      open.max = value;
+      open.sum = value;
+      open.count = 1;
+    } else {
+      open.min = std::min(open.min, value);
+      open.max = std::max(open.max, value);
+      open.sum += value;
+      ++open.count;
+    }
+    open.last = value;
+  }
+  samples_.fetch_add(1, std::memory_order_relaxed);
+}
+
+// =============================================================================
+// 수집 (Persistence 스레드)
+// =============================================================================
+
+void RollupEngine::Emit(int point_id, size_t tier, Window &window,
+                        std::vector<RollupRow> &out) {
+  RollupRow row;
+  row.point_id = point_id;
+  row.tier = static_cast<RollupTier>(tier);
+  row.window_start_ms = window.start_ms;
+  row.min = window.min;
+  row.max = window.max;
+  row.mean = window.count > 0 ? window.sum / window.count : window.last;
+  row.last = window.last;
+  row.sum = window.sum;
+  row.count = window.count;
+  out.push_back(row);
+  window.start_ms = -1;
+}
+
+size_t RollupEngine::Collect(std::chrono::system_clock::time_point now,
+                             std::vector<RollupRow> &out) {
+  const auto &registry = Pipeline::PointIndexRegistry::getInstance();
+  const int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                             now.time_since_epoch())
+                             .count();
+  const size_t before = out.size();
+  const size_t count = registry.Size();
+
+  for (uint32_t index = 0; index < count; ++index) {
+    // Find는 할당하지 않으므로 롤업 샘플이 없던 청크는 건너뜀
+    Slot *found = slots_.Find(index);
+    if (!found)
+      continue;
+    Slot &slot = *found;
+
+    SlotLock lock(slot);
+    int point_id = -1;
+    for (size_t tier = 0; tier < ROLLUP_TIER_COUNT; ++tier) {
+      Window &closed = slot.closed[tier];
+      Window &open = slot.open[tier];
+      const bool open_done =
+          open.start_ms >= 0 &&
+          open.start_ms + TIER_WIDTH_MS[tier] + options_.grace_ms <= now_ms;
+      if (closed.start_ms < 0 && !open_done)
+        continue;
+
+      if (point_id < 0)
+        point_id = registry.PointIdOf(index);
+      if (closed.start_ms >= 0) {
+        slot.emitted_start[tier] = closed.start_ms;
+        Emit(point_id, tier, closed, out);
+      }
+      if (open_done) {
+        slot.emitted_start[tier] = open.start_ms;
+        Emit(point_id, tier, open, out);
+      }
+    }
+  }
+
+  const size_t emitted = out.size() - before;
+  rows_emitted_.fetch_add(emitted, std::memory_order_relaxed);
+  return emitted;
+}
+
+size_t RollupEngine::TakeOpen(std::vector<RollupRow> &out) {
+  const auto &registry = Pipeline::PointIndexRegistry::getInstance();
+  const size_t before = out.size();
+  const size_t count = registry.Size();
+
+  for (uint32_t index = 0; index < count; ++index) {
+    Slot *found = slots_.Find(index);
+    if (!found)
+      continue;
+    Slot &slot = *found;
+
+    SlotLock lock(slot);
+    for (size_t tier = 0; tier < ROLLUP_TIER_COUNT; ++tier) {
+      // 닫힘 칸은 Collect()가 이미 비웠으므로 열린 윈도우만 남음
+      Window &open = slot.open[tier];
+      if (open.start_ms >= 0)
+        Emit(registry.PointIdOf(index), tier, open, out);
+    }
+  }
+  return out.size() - before;
+}
+
+void RollupEngine::Restore(const RollupRow &row) {
+  if (row.count == 0)
+    return;
+  const uint32_t index =
+      Pipeline::PointIndexRegistry::getInstance().Acquire(row.point_id);
+  if (index == Pipeline::PointIndexRegistry::INVALID_INDEX)
+    return;
+
+  Slot &slot = slots_.At(index);
+  SlotLock lock(slot);
+  Window &open = slot.open[static_cast<size_t>(row.tier)];
+  if (open.start_ms < 0) {
+    open.start_ms = row.window_start_ms;
+    open.min = row.min;
+    open.max = row.max;
+    open.sum = row.sum;
+    open.last = row.last;
+    open.count = row.count;
+  } else if (open.start_ms == row.window_start_ms) {
+    // 체크포인트 값이 먼저 들어온 샘플이므로 last는 열린 쪽을 유지
+    open.min = std::min(open.min, row.min);
+    open.max = std::max(open.max, row.max);
+    open.sum += row.sum;
+    open.count += row.count;
+  }
+}
+
+RollupStats RollupEngine::GetStats() const {
+  RollupStats stats;
+  stats.enabled = options_.enabled;
+  stats.samples = samples_.load(std::memory_order_relaxed);
+  stats.late_samples = late_samples_.load(std::memory_order_relaxed);
+  stats.overwritten = overwritten_.load(std::memory_order_relaxed);
+  stats.rows_emitted = rows_emitted_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+} // namespace Storage
+} // namespace PulseOne
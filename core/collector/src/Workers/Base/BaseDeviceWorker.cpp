@@ -865,20 +865,18 @@ bool BaseDeviceWorker::SendDataToPipeline(
 
     message.UpdateDeviceStatus(thresholds);
 
-    // PipelineManager로 전송
-    bool success = pipeline_manager.PushMessage(message);
+    // PipelineManager로 전송 (move: 포인트 복사 없음)
+    const auto sent_status = message.device_status;
+    const auto sent_timestamp = message.timestamp;
+    bool success = pipeline_manager.PushMessage(std::move(message));
 
     if (success) {
-      LogMessage(
-          LogLevel::DEBUG_LEVEL,
-          "파이프라인 전송 성공: " + std::to_string(values.size()) +
-              "개 포인트 " + "(상태: " +
-              PulseOne::Enums::DeviceStatusToString(message.device_status) +
-              ", " + "알람=" + (message.trigger_alarms ? "ON" : "OFF") + ", " +
-              "가상포인트=" + (message.trigger_virtual_points ? "ON" : "OFF") +
-              ")");
-
-      last_success_time_ = message.timestamp;
+      LogMessage(LogLevel::DEBUG_LEVEL,
+                 "파이프라인 전송 성공: " + std::to_string(values.size()) +
+                     "개 포인트 " + "(상태: " +
+                     PulseOne::Enums::DeviceStatusToString(sent_status) + ")");
+
+      last_success_time_ = sent_timestamp;
       consecutive_failures_ = 0;
     } else {
       LogMessage(LogLevel::WARN, "파이프라인 전송 실패 (큐 오버플로우?)");
@@ -905,6 +903,50 @@ bool BaseDeviceWorker::SendDataToPipeline(
   }
 }
 
+// =============================================================================
+// 파이프라인 역압 (혼잡 시 폴링 주기 확장)
+// =============================================================================
+std::chrono::milliseconds BaseDeviceWorker::GetBackpressureAdjustedInterval(
+    std::chrono::milliseconds base) {
+  auto &pipeline = Pipeline::PipelineManager::getInstance();
+  uint32_t multiplier = pipeline.GetBackoffMultiplier();
+  uint32_t previous = backpressure_multiplier_.exchange(multiplier);
+
+  if (multiplier != previous) {
+    if (multiplier > 1) {
+      LogMessage(LogLevel::WARN,
+                 "파이프라인 혼잡(" +
+                     std::string(Pipeline::PipelineManager::CongestionLevelName(
+                         pipeline.GetCongestionLevel())) +
+                     ") - 폴링 주기 x" + std::to_string(multiplier));
+    } else {
+      LogMessage(LogLevel::INFO, "파이프라인 혼잡 해소 - 폴링 주기 복원");
+    }
+  }
+
+  if (multiplier > 1) {
+    backpressure_stretch_count_.fetch_add(1);
+  }
+  return base * multiplier;
+}
+
+bool BaseDeviceWorker::WaitForPipelineCapacity(
+    std::chrono::milliseconds max_wait) {
+  auto &pipeline = Pipeline::PipelineManager::getInstance();
+  if (pipeline.GetCongestionLevel() <
+      Pipeline::PipelineManager::CongestionLevel::HIGH) {
+    return true;
+  }
+
+  backpressure_stretch_count_.fetch_add(1);
+  bool ready = pipeline.WaitForCapacity(max_wait);
+  if (!ready) {
+    LogMessage(LogLevel::WARN, "파이프라인 여유 대기 시간 초과 (" +
+                                   std::to_string(max_wait.count()) + "ms)");
+  }
+  return ready;
+}
+
 bool BaseDeviceWorker::SendValuesToPipelineWithLogging(
     const std::vector<PulseOne::Structs::TimestampedValue> &values,
     const std::string &data_type, uint32_t priority) {
@@ -1120,6 +1162,19 @@ std::future<bool> BaseDeviceWorker::Resume() {
   });
 }
 
+void BaseDeviceWorker::RecordDriverReadLatency(
+    std::chrono::steady_clock::time_point started) {
+  auto *histogram = driver_read_histogram_.load(std::memory_order_relaxed);
+  if (!histogram) {
+    const std::string &protocol = device_info_.protocol_type;
+    histogram = &Pipeline::PipelineMetrics::getInstance().Get(
+        Pipeline::PipelineMetrics::DRIVER_READ,
+        protocol.empty() ? "unknown" : protocol);
+    driver_read_histogram_.store(histogram, std::memory_order_relaxed);
+  }
+  histogram->Record(std::chrono::steady_clock::now() - started);
+}
+
 void BaseDeviceWorker::LogMessage(LogLevel level,
                                   const std::string &message) const {
   std::string prefix = "[Worker:" + device_info_.name + "] ";
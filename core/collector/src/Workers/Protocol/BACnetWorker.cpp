@@ -817,8 +817,9 @@ void BACnetWorker::DataScanThreadFunction() {
         cleanup_timer_ = 0;
       }
 
-      std::this_thread::sleep_for(
-          std::chrono::milliseconds(polling_interval_ms));
+      // 파이프라인 혼잡 시 주기 확장
+      std::this_thread::sleep_for(GetBackpressureAdjustedInterval(
+          std::chrono::milliseconds(polling_interval_ms)));
 
     } catch (const std::exception &e) {
       LogMessage(LogLevel::LOG_ERROR,
@@ -856,7 +857,9 @@ bool BACnetWorker::PerformDataScan() {
 
     // BACnet Present Value들 읽기
     std::vector<TimestampedValue> values;
+    auto read_start = std::chrono::steady_clock::now();
     bool success = bacnet_driver_->ReadValues(data_points_to_scan, values);
+    RecordDriverReadLatency(read_start);
 
     if (success && !values.empty()) {
       worker_stats_.read_operations++;
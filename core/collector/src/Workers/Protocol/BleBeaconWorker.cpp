@@ -117,7 +117,10 @@ void BleBeaconWorker::PollingThreadFunction() {
     // 2. Read Values
     if (!points_to_read.empty()) {
       std::vector<Structs::TimestampedValue> values;
-      if (ble_driver_->ReadValues(points_to_read, values)) {
+      auto read_start = std::chrono::steady_clock::now();
+      bool read_ok = ble_driver_->ReadValues(points_to_read, values);
+      RecordDriverReadLatency(read_start);
+      if (read_ok) {
         // LogManager::getInstance().Info("Read " +
         // std::to_string(values.size()) + " values from driver.");
 
@@ -161,7 +161,10 @@ bool GenericDeviceWorker::PerformRead() {
     return false;
 
   std::vector<PulseOne::Structs::TimestampedValue> received_values;
-  if (driver_->ReadValues(data_points_, received_values)) {
+  auto read_start = std::chrono::steady_clock::now();
+  bool read_ok = driver_->ReadValues(data_points_, received_values);
+  RecordDriverReadLatency(read_start);
+  if (read_ok) {
     SendDataToPipeline(received_values);
     return true;
   }
@@ -210,7 +210,9 @@ void HttpRestWorker::PollingThreadFunction() {
     try {
       // Read all data points
       std::vector<PulseOne::Structs::TimestampedValue> values;
+      auto read_start = std::chrono::steady_clock::now();
       bool success = http_driver_->ReadValues(data_points_, values);
+      RecordDriverReadLatency(read_start);
 
       if (success && !values.empty()) {
         // Send to pipeline
@@ -229,7 +231,8 @@ void HttpRestWorker::PollingThreadFunction() {
     uint32_t interval = device_info_.polling_interval_ms > 0
                             ? device_info_.polling_interval_ms
                             : 5000;
-    std::this_thread::sleep_for(std::chrono::milliseconds(interval));
+    std::this_thread::sleep_for(
+        GetBackpressureAdjustedInterval(std::chrono::milliseconds(interval)));
   }
 
   LogMessage(LogLevel::INFO, "HTTP/REST polling thread stopped");
@@ -92,6 +92,7 @@ MQTTWorker::~MQTTWorker() {
   message_thread_running_ = false;
   publish_thread_running_ = false;
   publish_queue_cv_.notify_all();
+  inbound_cv_.notify_all();
 
   if (message_processor_thread_ && message_processor_thread_->joinable()) {
     message_processor_thread_->join();
@@ -218,6 +219,7 @@ std::future<bool> MQTTWorker::Stop() {
       mqtt_self->message_thread_running_ = false;
       mqtt_self->publish_thread_running_ = false;
       mqtt_self->publish_queue_cv_.notify_all();
+      mqtt_self->inbound_cv_.notify_all();
 
       if (mqtt_self->message_processor_thread_ &&
           mqtt_self->message_processor_thread_->joinable()) {
@@ -1637,8 +1639,8 @@ void MQTTWorker::MessageProcessorThreadFunction() {
         }
       }
 
-      // 메시지 처리는 MqttDriver의 콜백을 통해 처리됨
-      std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+      // 드라이버 콜백이 넣어 둔 수신 메시지 처리 (없으면 최대 1초 대기)
+      DrainInbound(std::chrono::milliseconds(1000));
 
     } catch (const std::exception &e) {
       LogMessage(LogLevel::LOG_ERROR,
@@ -2219,7 +2221,48 @@ double MQTTWorker::CalculateMessagePriority(const std::string &topic,
 void MQTTWorker::MessageCallback(MQTTWorker *worker, const std::string &topic,
                                  const std::string &payload) {
   if (worker) {
-    worker->ProcessReceivedMessage(topic, payload);
+    worker->EnqueueInbound(topic, payload);
+  }
+}
+
+void MQTTWorker::EnqueueInbound(const std::string &topic,
+                                const std::string &payload) {
+  // 클라이언트 콜백 스레드: 블로킹 없이 버퍼에 넣기만 함
+  {
+    std::lock_guard<std::mutex> lock(inbound_mutex_);
+    if (inbound_queue_.size() < INBOUND_QUEUE_MAX) {
+      inbound_queue_.push_back(InboundMessage{topic, payload});
+      inbound_cv_.notify_one();
+      return;
+    }
+  }
+
+  performance_metrics_.messages_dropped++;
+  const uint64_t dropped = inbound_dropped_.fetch_add(1) + 1;
+  if (dropped == 1 || dropped % 1000 == 0) {
+    LogMessage(LogLevel::WARN,
+               "MQTT 수신 버퍼 가득 참 (" +
+                   std::to_string(INBOUND_QUEUE_MAX) +
+                   "개) - 메시지 드롭 누적 " + std::to_string(dropped));
+  }
+}
+
+void MQTTWorker::DrainInbound(std::chrono::milliseconds max_wait) {
+  std::deque<InboundMessage> batch;
+  {
+    std::unique_lock<std::mutex> lock(inbound_mutex_);
+    inbound_cv_.wait_for(lock, max_wait, [this] {
+      return !inbound_queue_.empty() || !message_thread_running_;
+    });
+    batch.swap(inbound_queue_);
+  }
+
+  for (auto &message : batch) {
+    // 혼잡하면 여기서 기다리는 동안 버퍼가 쌓이고, 한도를 넘으면 드롭.
+    // 우선순위와 무관하게 high_priority가 아닌 메시지는 NORMAL 레인으로 감.
+    if (message_thread_running_)
+      WaitForPipelineCapacity(std::chrono::seconds(5));
+    ProcessReceivedMessage(message.topic, message.payload);
   }
 }
 
@@ -2267,7 +2310,7 @@ void MQTTWorker::SetupMQTTDriverCallbacks() {
   // 메시지 수신 콜백 설정
   mqtt_driver_->SetMessageCallback(
       [this](const std::string &topic, const std::string &payload) {
-        ProcessReceivedMessage(topic, payload);
+        EnqueueInbound(topic, payload);
       });
 
   LogMessage(LogLevel::DEBUG_LEVEL, "✅ MQTT driver callbacks configured");
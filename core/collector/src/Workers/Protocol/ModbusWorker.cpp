@@ -388,7 +388,9 @@ void ModbusWorker::PollingThreadFunction() {
         }
         if (!fast_to_read.empty()) {
           std::vector<TimestampedValue> results;
+          auto read_start = std::chrono::steady_clock::now();
           bool success = modbus_driver_->ReadValues(fast_to_read, results);
+          RecordDriverReadLatency(read_start);
           if (success && !results.empty()) {
             SendValuesToPipelineWithLogging(results, "FastPolling", 0);
             UpdateCommunicationResult(
@@ -426,7 +428,9 @@ void ModbusWorker::PollingThreadFunction() {
         if (!slow_to_read.empty()) {
           auto slow_start = system_clock::now();
           std::vector<TimestampedValue> results;
+          auto read_start = std::chrono::steady_clock::now();
           bool success = modbus_driver_->ReadValues(slow_to_read, results);
+          RecordDriverReadLatency(read_start);
           if (success && !results.empty()) {
             SendValuesToPipelineWithLogging(results, "SlowPolling", 0);
             LogMessage(LogLevel::DEBUG,
@@ -449,7 +453,9 @@ void ModbusWorker::PollingThreadFunction() {
     // ── 루프 주기 맞추기
     auto elapsed =
         duration_cast<milliseconds>(system_clock::now() - loop_start);
-    auto sleep_ms = milliseconds(fast_interval_ms) - elapsed;
+    auto sleep_ms =
+        GetBackpressureAdjustedInterval(milliseconds(fast_interval_ms)) -
+        elapsed;
     if (sleep_ms.count() > 0) {
       std::this_thread::sleep_for(sleep_ms);
     }
@@ -182,7 +182,10 @@ void OPCUAWorker::PollingThreadFunction() {
 
       if (!points_to_read.empty()) {
         std::vector<PulseOne::Structs::TimestampedValue> values;
-        if (opcua_driver_->ReadValues(points_to_read, values)) {
+        auto read_start = std::chrono::steady_clock::now();
+        bool read_ok = opcua_driver_->ReadValues(points_to_read, values);
+        RecordDriverReadLatency(read_start);
+        if (read_ok) {
           // Send to Pipeline
           SendDataToPipeline(values);
         } else {
@@ -206,7 +209,9 @@ void OPCUAWorker::PollingThreadFunction() {
     auto end_time = std::chrono::steady_clock::now();
     auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
         end_time - start_time);
-    auto interval = std::chrono::milliseconds(GetPollingInterval());
+    // Stretch the interval while the pipeline is congested
+    auto interval = GetBackpressureAdjustedInterval(
+        std::chrono::milliseconds(GetPollingInterval()));
 
     if (interval > elapsed) {
       std::this_thread::sleep_for(interval - elapsed);
@@ -6,6 +6,7 @@
 #include "Database/Repositories/DeviceSettingsRepository.h"
 #include "Database/RepositoryFactory.h"
 #include "Logging/LogManager.h"
+#include "Pipeline/PointMetadataRegistry.h"
 #include "Storage/RedisDataWriter.h"
 #include "Utils/ConfigManager.h"
 #include "Workers/Base/BaseDeviceWorker.h"
@@ -189,6 +190,14 @@ bool WorkerScheduler::ReloadWorkerSettings(const std::string &device_id) {
   // Stop and unregister existing
   StopWorker(device_id);
 
+  // 포인트 이름/단위/스케일링이 바뀌었을 수 있으므로 메타데이터도 갱신
+  try {
+    Pipeline::PointMetadataRegistry::getInstance().RefreshDevice(
+        std::stoi(device_id));
+  } catch (const std::exception &) {
+    // 숫자가 아닌 device_id는 메타데이터 갱신 대상 아님
+  }
+
   // Start new (will reload settings from DB upon creation)
   return StartWorker(device_id);
 }
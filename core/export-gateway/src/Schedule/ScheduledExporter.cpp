@@ -14,6 +14,8 @@
 
 #include "Schedule/ScheduledExporter.h"
 #include "Client/RedisClientImpl.h"
+#include "Data/RedisDataTypes.h"
+#include "Data/RedisValueCodec.h"
 #include "Gateway/Model/AlarmMessage.h"
 #include "Gateway/Model/ValueMessage.h"
 #include "Gateway/Service/TargetRunner.h"
@@ -631,7 +633,59 @@ std::optional<ExportDataPoint> ScheduledExporter::fetchPointData(
     std::string json_str = redis_client_->get(key);
 
     if (json_str.empty()) {
-      return std::nullopt;
+      // Collector가 해시 레이아웃(REDIS_STORAGE_LAYOUT=hash)으로 저장한 경우
+      using PulseOne::Shared::Data::CompactPointValue;
+      using PulseOne::Shared::Data::RedisKeyBuilder;
+      const std::string field = std::to_string(point_id);
+      const std::string device_num =
+          redis_client_->hget(RedisKeyBuilder::PointDeviceIndexKey(), field);
+      if (device_num.empty()) {
+        return std::nullopt;
+      }
+      auto compact = CompactPointValue::Decode(redis_client_->hget(
+          RedisKeyBuilder::DeviceValuesKey(device_num), field));
+      if (!compact) {
+        return std::nullopt;
+      }
+
+      const auto current = compact->toCurrentValue(point_id, device_num);
+      ExportDataPoint point;
+      point.point_id = point_id;
+      point.building_id = 0;
+      point.value = current.value;
+      point.timestamp = compact->timestamp;
+      point.quality = compact->quality;
+      point.extra_info = {{"point_id", point_id},
+                          {"device_id", device_num},
+                          {"vl", current.value},
+                          {"tm_ms", compact->timestamp},
+                          {"st", compact->quality}};
+      return point;
+    }
+
+    // Collector가 REDIS_BINARY_FAMILIES=latest로 기록한 경우 (MessagePack)
+    if (PulseOne::Shared::Data::RedisValueCodec::IsBinary(json_str)) {
+      auto record =
+          PulseOne::Shared::Data::RedisValueCodec::DecodePoint(json_str);
+      if (!record) {
+        return std::nullopt;
+      }
+
+      ExportDataPoint point;
+      point.point_id = point_id;
+      point.building_id = 0;
+      point.point_name = record->point_name;
+      point.value = record->ValueText();
+      point.timestamp = record->timestamp;
+      point.quality = record->quality;
+      point.unit = record->unit;
+      point.extra_info = {{"point_id", point_id},
+                          {"device_id", record->device_id},
+                          {"value", point.value},
+                          {"timestamp", record->timestamp},
+                          {"quality", record->quality},
+                          {"changed", record->changed}};
+      return point;
     }
 
     auto data = json::parse(json_str);
@@ -37,8 +37,9 @@ public:
 private:
   void SubscribeLoop();
 
-  // JSON 페이로드 파싱 → 레지스터 갱신
+  // 페이로드 파싱 → 레지스터 갱신
   // 예상 포맷: {"point_id":42,"value":23.5,"quality":"GOOD","timestamp":"..."}
+  // 또는 RedisValueCodec POINT_VALUE_V1 바이너리 (shared 라이브러리 빌드)
   void OnMessage(const std::string &payload);
 
   void WriteValueToTable(const RegisterMapping &m, double value);
@@ -16,6 +16,11 @@
 using json = nlohmann::json;
 #endif
 
+// shared 라이브러리가 있으면 Collector의 바이너리 값(MessagePack)도 수신
+#ifdef HAS_SHARED_LIBS
+#include "Data/RedisValueCodec.h"
+#endif
+
 namespace PulseOne {
 namespace ModbusSlave {
 
@@ -138,6 +143,19 @@ void RedisSubscriber::SubscribeLoop() {
 }
 
 void RedisSubscriber::OnMessage(const std::string &payload) {
+#ifdef HAS_SHARED_LIBS
+  using Shared::Data::RedisValueCodec;
+  if (RedisValueCodec::IsBinary(payload)) {
+    auto record = RedisValueCodec::DecodePoint(payload);
+    if (!record)
+      return;
+    auto it = point_map_.find(record->point_id);
+    if (it != point_map_.end() && it->second->enabled) {
+      WriteValueToTable(*it->second, record->NumericValue());
+    }
+    return;
+  }
+#endif
 #ifdef HAS_NLOHMANN_JSON
   try {
     auto j = json::parse(payload);
@@ -0,0 +1,169 @@
+#ifndef PULSEONE_CLIENT_LINE_PROTOCOL_ENCODER_H
+#define PULSEONE_CLIENT_LINE_PROTOCOL_ENCODER_H
+
+/**
+ * @file LineProtocolEncoder.h
+ * @brief InfluxDB 라인 프로토콜 인코더 (Shared Library)
+ * @author PulseOne Development Team
+ */
+
+#include "Common/BasicTypes.h"
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace PulseOne {
+namespace Client {
+
+/**
+ * @brief InfluxDB 라인 프로토콜 인코더
+ * @details
+ * 모든 함수는 호출자가 재사용하는 버퍼 끝에 덧붙이기만 한다. 숫자는
+ * std::to_chars로 스택에서 변환하므로 버퍼 용량이 충분하면 힙 할당이 없다.
+ * 실수 to_chars가 없는 표준 라이브러리에서는 snprintf("%.17g")로 대신한다.
+ *
+ * 자주 쓰는 "measurement,tag=value,... field=" 접두사는 BuildPrefix로 한 번
+ * 만들어 캐시해 두고, 샘플마다 값과 타임스탬프만 붙이는 것을 권장한다:
+ * @code
+ *   const std::string prefix = LineProtocolEncoder::BuildPrefix(
+ *       "device_telemetry", tags, "p_12");
+ *   LineProtocolEncoder::AppendLine(buffer, prefix, 23.5, epoch_ms);
+ * @endcode
+ */
+class LineProtocolEncoder {
+public:
+  using Tags = std::vector<std::pair<std::string, std::string>>;
+
+  // ===========================================================================
+  // 이스케이프
+  // ===========================================================================
+
+  /// measurement: 쉼표, 공백
+  static void AppendMeasurement(std::string &out, std::string_view name);
+
+  /// 태그 키/값, 필드 키: 쉼표, 등호, 공백
+  static void AppendKey(std::string &out, std::string_view key);
+
+  /// 문자열 필드 값: 큰따옴표로 감싸고 " 와 \ 이스케이프
+  static void AppendQuoted(std::string &out, std::string_view value);
+
+  // ===========================================================================
+  // 값 (std::to_chars)
+  // ===========================================================================
+
+  static void AppendInteger(std::string &out, int64_t value) {
+    char buf[24];
+    auto result = std::to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, result.ptr);
+  }
+
+  static void AppendUnsigned(std::string &out, uint64_t value) {
+    char buf[24];
+    auto result = std::to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, result.ptr);
+  }
+
+  /**
+   * @brief 왕복 가능한 최단 표현으로 실수 기록
+   * @return NaN/Inf는 라인 프로토콜로 표현할 수 없으므로 false (버퍼 불변)
+   */
+  static bool AppendDouble(std::string &out, double value) {
+    if (!std::isfinite(value))
+      return false;
+    char buf[32];
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    auto result = std::to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, result.ptr);
+#else
+    // 실수 to_chars가 없는 표준 라이브러리 (mingw GCC 10 등): 왕복 가능한 17자리
+    const int length = std::snprintf(buf, sizeof(buf), "%.17g", value);
+    if (length > 0)
+      out.append(buf, static_cast<size_t>(length));
+#endif
+    return true;
+  }
+
+  /**
+   * @brief DataVariant의 모든 타입을 필드 값으로 기록
+   * @details bool → true/false, 부호 있는 정수 → 123i, 부호 없는 정수 → 123u,
+   * float/double → 실수, string → "..."
+   * @return NaN/Inf면 false (버퍼 불변)
+   */
+  static bool AppendFieldValue(std::string &out,
+                               const BasicTypes::DataVariant &value);
+
+  // ===========================================================================
+  // 접두사 / 한 줄
+  // ===========================================================================
+
+  /**
+   * @brief 이스케이프가 끝난 "measurement,k=v,... " 또는
+   * "measurement,k=v,... field=" 접두사 생성
+   * @param tags 키 순서대로 기록 (InfluxDB 권장: 키 정렬)
+   * @param field_key 비어 있지 않으면 "field=" 까지 포함
+   */
+  static std::string BuildPrefix(std::string_view measurement, const Tags &tags,
+                                 std::string_view field_key = {});
+  static std::string
+  BuildPrefix(std::string_view measurement,
+              const std::map<std::string, std::string> &tags,
+              std::string_view field_key = {});
+
+  /**
+   * @brief prefix(필드 키와 '=' 포함) + 값 + 타임스탬프 + 개행
+   * @param timestamp 0 이하면 생략 (서버 수신 시각 사용)
+   * @return 값이 NaN/Inf면 아무것도 쓰지 않고 false
+   */
+  static bool AppendLine(std::string &out, std::string_view prefix,
+                         double value, int64_t timestamp) {
+    if (!std::isfinite(value))
+      return false;
+    out.append(prefix);
+    AppendDouble(out, value);
+    AppendTimestamp(out, timestamp);
+    out += '\n';
+    return true;
+  }
+
+  static bool AppendLine(std::string &out, std::string_view prefix,
+                         const BasicTypes::DataVariant &value,
+                         int64_t timestamp) {
+    const size_t mark = out.size();
+    out.append(prefix);
+    if (!AppendFieldValue(out, value)) {
+      out.resize(mark);
+      return false;
+    }
+    AppendTimestamp(out, timestamp);
+    out += '\n';
+    return true;
+  }
+
+  /**
+   * @brief 여러 필드를 가진 한 줄 (개행 없음)
+   * @param prefix BuildPrefix(measurement, tags)의 결과 ("... " 로 끝남)
+   * @return 기록할 수 있는 필드가 하나도 없으면 false (버퍼 불변)
+   */
+  static bool AppendFields(std::string &out, std::string_view prefix,
+                           const std::map<std::string, double> &fields,
+                           int64_t timestamp);
+
+private:
+  static void AppendTimestamp(std::string &out, int64_t timestamp) {
+    if (timestamp > 0) {
+      out += ' ';
+      AppendInteger(out, timestamp);
+    }
+  }
+};
+
+} // namespace Client
+} // namespace PulseOne
+
+#endif // PULSEONE_CLIENT_LINE_PROTOCOL_ENCODER_H
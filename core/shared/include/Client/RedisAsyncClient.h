@@ -0,0 +1,234 @@
+// =============================================================================
+// RedisAsyncClient.h - 이벤트 루프 기반 비동기 Redis 클라이언트
+// 🔥 hiredis 비동기 API + 전용 epoll 루프 스레드. 호출 스레드는 큐에 넣고
+//    바로 돌아가며, 결과는 콜백/future로 받는다
+// =============================================================================
+#ifndef REDIS_ASYNC_CLIENT_H
+#define REDIS_ASYNC_CLIENT_H
+
+#include "Client/RedisClient.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct redisAsyncContext;
+
+namespace PulseOne {
+
+/**
+ * @brief 비동기 클라이언트 설정 (REDIS_ASYNC_* 키, 접속 정보는 REDIS_PRIMARY_*)
+ */
+struct RedisAsyncOptions {
+  bool enabled = false;
+  std::string host = "localhost";
+  int port = 6379;
+  std::string password;
+  int database = 0;
+  size_t max_in_flight = 1000; // 응답을 기다리는 명령 상한
+  size_t max_queued = 10000;   // 아직 보내지 않은 명령 상한
+  int connect_timeout_ms = 3000;
+  int reconnect_interval_ms = 1000;
+  int drain_timeout_ms = 2000; // Stop() 시 남은 명령을 보낼 최대 시간
+
+  static RedisAsyncOptions FromConfig();
+};
+
+/**
+ * @brief 비동기 응답 (hiredis redisReply 사본)
+ */
+struct RedisAsyncReply {
+  enum class Type { NIL, STATUS, STRING, INTEGER, ARRAY, ERROR_REPLY };
+
+  Type type = Type::NIL;
+  std::string str; // STATUS/STRING/ERROR_REPLY
+  long long integer = 0;
+  std::vector<RedisAsyncReply> elements;
+
+  bool ok() const { return type != Type::ERROR_REPLY; }
+
+  static RedisAsyncReply Error(std::string message) {
+    RedisAsyncReply reply;
+    reply.type = Type::ERROR_REPLY;
+    reply.str = std::move(message);
+    return reply;
+  }
+};
+
+struct RedisAsyncStats {
+  bool connected = false;
+  uint64_t submitted = 0;
+  uint64_t completed = 0;
+  uint64_t failed = 0;   // 오류 응답 + 연결 끊김으로 실패한 명령
+  uint64_t rejected = 0; // 큐가 가득 차 받지 않은 명령
+  uint64_t write_batches = 0;    // 루프 한 바퀴에서 hiredis로 넘긴 묶음 수
+  uint64_t batched_commands = 0; // 그 묶음들에 담긴 명령 수
+  uint64_t reconnects = 0;
+  uint64_t latency_us_total = 0; // 제출 → 응답
+  uint64_t latency_us_max = 0;
+  size_t queued = 0;
+  size_t in_flight = 0;
+};
+
+/**
+ * @brief 이벤트 루프 기반 비동기 Redis 클라이언트
+ * @details
+ * - 연결 하나를 전용 루프 스레드가 소유한다. hiredis 호출은 모두 이 스레드
+ *   에서만 하고, 소켓 이벤트는 epoll로 받는다 (hiredis 이벤트 훅 직접 구현).
+ * - Submit은 명령을 큐에 넣고 바로 돌아온다. 루프는 한 바퀴마다 큐를
+ *   in-flight 여유만큼 hiredis 출력 버퍼로 옮기므로, 동시에 들어온 명령은
+ *   write 한 번으로 나간다 (자동 파이프라이닝). 연결이 하나라 제출 순서가
+ *   곧 실행 순서다.
+ * - 큐(max_queued)가 차면 wait 동안 자리를 기다리고, 그래도 없으면 false.
+ *   hiredis에 넘긴 명령은 max_in_flight를 넘지 않는다.
+ * - 연결이 끊기면 응답 대기 중이던 명령은 오류로 끝나고, 큐의 명령은
+ *   재연결(reconnect_interval_ms 간격) 후 이어서 보낸다.
+ * - 콜백은 루프 스레드에서 호출된다. 오래 걸리는 작업이나 Stop() 호출 금지.
+ * - epoll/hiredis가 없는 빌드에서는 Start()가 false를 반환한다
+ *   (IsSupported()). 호출자는 동기 RedisClient 경로를 그대로 쓴다.
+ */
+class RedisAsyncClient {
+public:
+  using ReplyCallback = std::function<void(RedisAsyncReply &&reply)>;
+  // 배치 전체 응답 후 한 번 호출 (성공 응답 수)
+  using BatchCallback = std::function<void(size_t ok)>;
+
+  explicit RedisAsyncClient(RedisAsyncOptions options = RedisAsyncOptions());
+  ~RedisAsyncClient();
+
+  RedisAsyncClient(const RedisAsyncClient &) = delete;
+  RedisAsyncClient &operator=(const RedisAsyncClient &) = delete;
+
+  static bool IsSupported();
+
+  /**
+   * @brief 루프 스레드 시작 (연결은 루프가 비동기로 맺음)
+   */
+  bool Start();
+
+  /**
+   * @brief 새 명령을 받지 않고, drain_timeout_ms 동안 남은 명령을 보낸 뒤
+   * 종료. 끝내 못 보낸 명령은 오류로 완료된다.
+   */
+  void Stop();
+
+  bool IsRunning() const { return running_.load(std::memory_order_acquire); }
+  bool IsConnected() const {
+    return connected_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief 명령 하나 제출
+   * @param wait 큐가 찼을 때 자리를 기다릴 최대 시간 (0이면 바로 거부)
+   * @return 접수 여부 (false면 콜백은 호출되지 않음)
+   */
+  bool Submit(RedisClient::StringList command,
+              ReplyCallback callback = nullptr,
+              std::chrono::milliseconds wait = std::chrono::milliseconds(0));
+
+  /**
+   * @brief 여러 명령을 순서대로 한꺼번에 제출 (전부 접수하거나 전부 거부)
+   * @details 개별 응답은 만들지 않고 성공 수만 센다 (쓰기 전용 경로용).
+   */
+  bool SubmitBatch(
+      std::vector<RedisClient::StringList> commands,
+      BatchCallback done = nullptr,
+      std::chrono::milliseconds wait = std::chrono::milliseconds(0));
+
+  /**
+   * @brief future로 결과 받기 (거부되면 오류 응답이 바로 준비됨)
+   */
+  std::future<RedisAsyncReply> Execute(RedisClient::StringList command);
+
+  RedisAsyncStats GetStats() const;
+
+private:
+  struct BatchState {
+    size_t remaining = 0;
+    size_t ok = 0;
+    BatchCallback done;
+  };
+
+  struct Request {
+    RedisClient::StringList command;
+    ReplyCallback callback;
+    std::shared_ptr<BatchState> batch;
+    std::chrono::steady_clock::time_point queued_at;
+    bool internal = false; // AUTH/SELECT
+  };
+
+  // 큐 자리 확보 (queue_mutex_ 보유 상태에서 호출)
+  bool ReserveLocked(std::unique_lock<std::mutex> &lock, size_t count,
+                     std::chrono::milliseconds wait);
+  void Wake();
+
+  // 아래는 모두 루프 스레드 전용
+  void Loop();
+  void Connect();
+  void CloseContext(const std::string &reason);
+  void Dispatch();
+  bool SendRequest(Request &request);
+  // reply가 nullptr이면 error 메시지로 실패 처리
+  void Complete(Request &request, const void *reply, const char *error);
+  void FailAll(const std::string &reason);
+  void UpdateEvents();
+
+  // hiredis 콜백/이벤트 훅
+  static void OnConnect(const redisAsyncContext *ac, int status);
+  static void OnDisconnect(const redisAsyncContext *ac, int status);
+  static void OnReply(redisAsyncContext *ac, void *reply, void *privdata);
+  static void AddRead(void *privdata);
+  static void DelRead(void *privdata);
+  static void AddWrite(void *privdata);
+  static void DelWrite(void *privdata);
+  static void Cleanup(void *privdata);
+
+  RedisAsyncOptions options_;
+
+  std::atomic<bool> running_{false};
+  std::atomic<bool> stopping_{false};
+  std::atomic<bool> connected_{false};
+  std::thread loop_thread_;
+
+  // 제출 큐 (queue_mutex_)
+  mutable std::mutex queue_mutex_;
+  std::condition_variable space_cv_;
+  std::deque<Request> queue_;
+
+  // 루프 스레드 상태
+  int epoll_fd_ = -1;
+  int wake_fd_ = -1;
+  redisAsyncContext *context_ = nullptr;
+  int context_fd_ = -1;
+  bool registered_ = false;
+  bool reading_ = false;
+  bool writing_ = false;
+  bool ready_ = false; // 연결 완료 (큐 전송 시작)
+  std::deque<Request> in_flight_; // 응답 순서 = 전송 순서
+  std::chrono::steady_clock::time_point next_connect_{};
+  std::chrono::steady_clock::time_point connect_deadline_{};
+
+  std::atomic<uint64_t> submitted_{0};
+  std::atomic<uint64_t> completed_{0};
+  std::atomic<uint64_t> failed_{0};
+  std::atomic<uint64_t> rejected_{0};
+  std::atomic<uint64_t> write_batches_{0};
+  std::atomic<uint64_t> batched_commands_{0};
+  std::atomic<uint64_t> reconnects_{0};
+  std::atomic<uint64_t> latency_us_total_{0};
+  std::atomic<uint64_t> latency_us_max_{0};
+  std::atomic<size_t> in_flight_count_{0};
+};
+
+} // namespace PulseOne
+
+#endif // REDIS_ASYNC_CLIENT_H
@@ -399,6 +399,15 @@ public:
    */
   virtual StringList mget(const StringList &keys) = 0;
 
+  /**
+   * @brief 여러 명령을 파이프라인으로 전송 (모두 보낸 뒤 응답을 한 번에 읽음)
+   * @param commands 명령별 인자 목록 (예: {"SETEX", key, "3600", value})
+   * @return 에러가 아닌 응답 수 (연결이 끊기면 그때까지 받은 수)
+   * @note 명령마다 왕복하지 않으므로 N개 명령이 왕복 1회로 끝난다.
+   *       트랜잭션이 아니므로 일부만 적용될 수 있다.
+   */
+  virtual size_t pipeline(const std::vector<StringList> &commands) = 0;
+
   // =============================================================================
   // 트랜잭션 지원
   // =============================================================================
@@ -15,6 +15,7 @@
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 // hiredis 라이브러리 체크
 #ifdef HAVE_REDIS
@@ -26,6 +27,15 @@ namespace PulseOne {
 /**
  * @brief 완전 자동화된 Redis 클라이언트 구현체
  * @details 모든 Redis 명령어를 완전히 구현하고 자동 연결 관리 제공
+ *
+ * 연결 풀 (REDIS_POOL_SIZE > 1):
+ * - 상태 없는 명령(키/해시/리스트/셋/PUBLISH/MGET/파이프라인 등)은 풀
+ *   연결을 하나 체크아웃해 실행하므로 여러 스레드가 동시에 보낼 수 있다.
+ *   스레드마다 선호 슬롯(스레드 ID 해시)을 먼저 시도한다.
+ * - 풀 연결은 필요할 때 연결하고(lazy), 오래 쉬었으면 PING으로 확인한다.
+ *   오류가 난 연결은 반납 시 닫고 다음 체크아웃에서 다시 연결한다.
+ * - 구독/트랜잭션/SELECT/감시 PING은 기존 기본 연결(context_)을 쓴다.
+ *   풀이 꽉 차 대기 시간을 넘기거나 풀 연결이 실패하면 기본 연결로 처리.
  */
 class RedisClientImpl : public RedisClient {
 public:
@@ -130,6 +140,7 @@ public:
 
   bool mset(const StringMap &key_values) override;
   StringList mget(const StringList &keys) override;
+  size_t pipeline(const std::vector<StringList> &commands) override;
 
   // =============================================================================
   // 트랜잭션 지원 (RedisClient 인터페이스 구현)
@@ -160,6 +171,17 @@ public:
     int current_reconnect_attempts{0};
     std::chrono::steady_clock::time_point connect_time;
     bool is_connected{false};
+
+    // 연결 풀
+    size_t pool_size{0};
+    size_t pool_open{0};               // 현재 열린 풀 연결 수
+    uint64_t pool_checkouts{0};
+    uint64_t pool_waits{0};            // 빈 슬롯이 없어 기다린 횟수
+    uint64_t pool_wait_timeouts{0};    // 대기 초과로 기본 연결 사용
+    uint64_t pool_wait_us_total{0};
+    uint64_t pool_wait_us_max{0};
+    uint64_t pool_connects{0};         // 풀 연결 생성(재연결 포함)
+    uint64_t pool_health_failures{0};  // 체크아웃 시 PING 실패
   };
 
   ConnectionStats getStats() const;
@@ -174,6 +196,11 @@ private:
   // 설정 및 연결 관리
   void loadConfiguration();
   bool attemptConnection();
+#ifdef HAVE_REDIS
+  // 연결 + AUTH + SELECT (실패 시 nullptr)
+  redisContext *openContext(const std::string &host, int port,
+                            const std::string &password, int database);
+#endif
   bool ensureConnected();
   void connectionWatchdog();
 
@@ -210,6 +237,56 @@ private:
     return default_value;
   }
 
+  // 상태 없는 명령용: 풀 연결에서 실행 (불가하면 executeWithRetry)
+  template <typename T>
+  T executePooled(std::function<T()> operation, T default_value) {
+#ifdef HAVE_REDIS
+    const int slot = checkoutSlot();
+    if (slot < 0)
+      return executeWithRetry<T>(std::move(operation), default_value);
+
+    struct Lease {
+      RedisClientImpl *self;
+      int slot;
+      ~Lease() { self->releaseSlot(slot); }
+    } lease{this, slot};
+
+    total_commands_++;
+    try {
+      T result = operation();
+      successful_commands_++;
+      return result;
+    } catch (const std::exception &e) {
+      logError("Redis 작업 중 예외: " + std::string(e.what()));
+    }
+
+    failed_commands_++;
+    return default_value;
+#else
+    return executeWithRetry<T>(std::move(operation), default_value);
+#endif
+  }
+
+#ifdef HAVE_REDIS
+  // 연결 풀 (pool_mutex_)
+  struct PoolSlot {
+    redisContext *context{nullptr};
+    bool in_use{false};
+    uint64_t generation{0}; // pool_generation_과 다르면 다시 연결
+    std::chrono::steady_clock::time_point last_used;
+    std::chrono::steady_clock::time_point retry_after; // 연결 실패 후 대기
+  };
+
+  int checkoutSlot();           // 실패 시 -1 (기본 연결 사용)
+  void releaseSlot(int index);
+  void resetPool();             // 설정 변경/해제: 쉬는 연결 닫고 세대 증가
+  redisContext *activeContext() const; // 현재 스레드가 쓸 연결
+  void markConnectionLost();    // 기본 연결일 때만 connected_ 해제
+
+  static thread_local const RedisClientImpl *tls_owner_;
+  static thread_local redisContext *tls_context_;
+#endif
+
 #ifdef HAVE_REDIS
   // hiredis 전용 메서드들
   redisReply *executeCommandSafe(const char *format, ...);
@@ -271,6 +348,26 @@ private:
   // Pub/Sub 콜백
   MessageCallback message_callback_;
   std::mutex callback_mutex_;
+
+  // 연결 풀 설정 (REDIS_POOL_*)
+  size_t pool_size_{1};
+  std::chrono::milliseconds pool_wait_timeout_{200};
+  std::chrono::seconds pool_health_check_{30};
+  std::atomic<std::thread::id> transaction_thread_{}; // MULTI 중인 스레드
+
+#ifdef HAVE_REDIS
+  mutable std::mutex pool_mutex_;
+  std::condition_variable pool_cv_;
+  std::vector<PoolSlot> pool_slots_;
+  uint64_t pool_generation_{0};
+#endif
+  std::atomic<uint64_t> pool_checkouts_{0};
+  std::atomic<uint64_t> pool_waits_{0};
+  std::atomic<uint64_t> pool_wait_timeouts_{0};
+  std::atomic<uint64_t> pool_wait_us_total_{0};
+  std::atomic<uint64_t> pool_wait_us_max_{0};
+  std::atomic<uint64_t> pool_connects_{0};
+  std::atomic<uint64_t> pool_health_failures_{0};
 };
 
 } // namespace PulseOne
@@ -1824,6 +1824,8 @@ struct DeviceDataMessage {
   std::string correlation_id = ""; // 요청 추적 ID (로그 연결용)
   std::string source_worker = "";  // 메시지 생성한 Worker명
   uint32_t batch_sequence = 0;     // 배치 내 시퀀스 번호
+  uint64_t wal_lsn = 0;            // 파이프라인 WAL 시퀀스 (0 = 미기록)
+  bool wal_retry = false; // 저장 실패 후 WAL에서 재투입 (저장만 다시 수행)
 
   // ==========================================================================
   // 🔥 디바이스 상태 정보 (새로 추가)
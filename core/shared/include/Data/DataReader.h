@@ -96,12 +96,24 @@ public:
    */
   std::vector<CurrentValue> ReadAllDevicePoints(int device_num);
 
+  /**
+   * @brief 디바이스 현재값 읽기 (해시 레이아웃 우선)
+   * @details device:{num}:values를 HGETALL 1회로 읽고, 해시가 없으면
+   *          ReadAllDevicePoints()로 레거시 키를 읽는다.
+   *          해시 값에는 포인트 이름/단위가 없어 "point_{id}"로 채워진다.
+   * @param device_num 디바이스 번호
+   * @return 포인트 벡터
+   */
+  std::vector<CurrentValue> ReadDeviceValues(int device_num);
+
   // ==========================================================================
   // Point Latest 읽기 (point:{id}:latest)
   // ==========================================================================
 
   /**
    * @brief 포인트 최신값 읽기 (Legacy 패턴)
+   * @details point:{id}:latest가 없으면 point:device 인덱스로 디바이스
+   *          해시(device:{num}:values)에서 읽는다.
    * @param point_id 포인트 ID
    * @return 성공 시 CurrentValue, 실패 시 nullopt
    */
@@ -256,6 +268,8 @@ private:
   std::optional<ActiveAlarm> parseActiveAlarm(const std::string &json_str);
 
   int extractDeviceNumber(const std::string &device_id) const;
+  // point:device 인덱스 → device:{num}:values 필드 (없으면 nullopt)
+  std::optional<CurrentValue> readFromDeviceHash(int point_id);
   std::string readWithRetry(const std::string &key);
 
   std::optional<std::string> getFromCache(const std::string &key);
@@ -35,6 +35,34 @@ struct CurrentValue {
     static std::optional<CurrentValue> fromJson(const nlohmann::json& j);
 };
 
+// =============================================================================
+// CompactPointValue - device:{num}:values 해시 필드 값 (필드명 = point_id)
+// =============================================================================
+/**
+ * @brief 디바이스 해시 레이아웃의 압축 값
+ * @details 형식: "<타입><품질>|<타임스탬프 ms>|<값>" (예: "d1|1718000000000|23.5")
+ * - 타입: b(bool, 1/0) i(정수) d(실수) s(문자열)
+ * - 품질: Enums::DataQuality 정수
+ * - 값은 마지막 필드이므로 '|'를 포함해도 된다
+ * 포인트 이름/단위/디바이스 이름은 담지 않는다 (메타데이터는 DB 기준).
+ * Decode는 RedisValueCodec 바이너리 필드 값도 받아 같은 형태로 돌려준다.
+ */
+struct CompactPointValue {
+    char type = 'd';
+    int quality = 0;
+    int64_t timestamp = 0;
+    std::string value;
+
+    static std::string Encode(char type, int quality, int64_t timestamp,
+                              const std::string& value);
+    static std::optional<CompactPointValue> Decode(const std::string& text);
+
+    /**
+     * @brief 레거시 형식과 같은 CurrentValue로 변환 (호환 리더용)
+     */
+    CurrentValue toCurrentValue(int point_id, const std::string& device_num) const;
+};
+
 // =============================================================================
 // VirtualPointValue - virtualpoint:{id}
 // =============================================================================
@@ -137,6 +165,10 @@ public:
     static std::string ServiceStatusKey(int service_id);
     static std::string ExportCounterKey(const std::string& metric_name);
     static std::string DeviceAllPointsPattern(int device_num);
+    // 디바이스 해시 레이아웃 (REDIS_STORAGE_LAYOUT=hash|both)
+    static std::string DeviceValuesKey(const std::string& device_num);
+    static std::string PointDeviceIndexKey(); // point_id → 디바이스 번호
+    static std::string ValueEncodingKey();    // 키 패밀리 → 값 인코딩
 };
 
 // =============================================================================
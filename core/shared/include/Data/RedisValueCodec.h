@@ -0,0 +1,154 @@
+// =============================================================================
+// core/shared/include/Data/RedisValueCodec.h
+// Redis 값 바이너리 인코딩 (MessagePack 기반, 버전 태그 포함)
+// =============================================================================
+
+#ifndef REDIS_VALUE_CODEC_H
+#define REDIS_VALUE_CODEC_H
+
+#include "Data/RedisDataTypes.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace PulseOne {
+namespace Shared {
+namespace Data {
+
+// =============================================================================
+// 키 패밀리별 값 인코딩 (REDIS_BINARY_FAMILIES)
+// =============================================================================
+
+enum class ValueEncoding : uint8_t { JSON = 0, MSGPACK = 1 };
+
+/**
+ * @brief 인코딩을 따로 고를 수 있는 키 패밀리
+ * - DEVICE_POINT: device:{num}:{name}
+ * - POINT_LATEST: point:{id}:latest, point:{id}:current
+ * - POINT_LIGHT:  point:{id}:light
+ * - DEVICE_FULL:  device:full:{num}, current_values:{num}
+ * - DEVICE_HASH:  device:{num}:values 해시 필드
+ */
+enum class RedisKeyFamily : uint8_t {
+    DEVICE_POINT = 0,
+    POINT_LATEST,
+    POINT_LIGHT,
+    DEVICE_FULL,
+    DEVICE_HASH,
+    COUNT
+};
+
+// 설정/meta:value_encoding 해시에서 쓰는 이름 (device, latest, light, full, hash)
+const char* KeyFamilyName(RedisKeyFamily family);
+std::optional<RedisKeyFamily> KeyFamilyFromName(const std::string& name);
+
+// meta:value_encoding 해시 값 ("json" | "msgpack/1")
+const char* ValueEncodingName(ValueEncoding encoding);
+
+// =============================================================================
+// 디코딩 결과
+// =============================================================================
+
+/**
+ * @brief 포인트 값 하나 (스키마 POINT_VALUE_V1)
+ * @details 타입 문자는 CompactPointValue와 같다: b(bool) i(정수) d(실수)
+ * s(문자열). 메타데이터 필드는 인코딩된 배열 길이만큼만 채워진다.
+ */
+struct PointValueRecord {
+    int point_id = 0;
+    char type = 'd';
+    int64_t int_value = 0;     // b(0/1), i
+    double double_value = 0.0; // d
+    std::string string_value;  // s
+    int64_t timestamp = 0;     // ms
+    int quality = 0;           // Enums::DataQuality 정수
+
+    // 선택 메타데이터
+    bool changed = false;
+    std::string device_id;
+    std::string point_name;
+    std::string unit;
+    std::string device_name;
+
+    /**
+     * @brief 레거시 JSON 값 문자열 ("true"/"false", 정수, %.15g, 문자열)
+     */
+    std::string ValueText() const;
+    double NumericValue() const;
+
+    /**
+     * @brief 해시 레이아웃 텍스트 형식으로 변환 (호환 리더 공용 경로)
+     */
+    CompactPointValue ToCompact() const;
+
+    CurrentValue toCurrentValue(const std::string& device_num) const;
+};
+
+struct DeviceSnapshotRecord {
+    std::string device_id;
+    std::string protocol;
+    int64_t timestamp = 0;
+    std::vector<PointValueRecord> points; // 메타데이터 중 changed만 사용
+};
+
+// =============================================================================
+// RedisValueCodec
+// =============================================================================
+
+/**
+ * @brief Redis 값 바이너리 인코더/디코더
+ * @details
+ * 페이로드는 표준 MessagePack 배열이고 첫 원소가 스키마 번호다.
+ * 어떤 MessagePack 라이브러리로도 읽을 수 있고, 첫 바이트(fixarray
+ * 0x90~0x9f, array16 0xdc)로 JSON('{')·CompactPointValue 텍스트와 구분된다.
+ * - POINT_VALUE_V1 (1):
+ *     [1, point_id, value, ts_ms, quality,
+ *      (changed, device_id, point_name, unit, device_name)]
+ *     괄호 안은 선택이며 앞에서부터 필요한 만큼만 쓴다.
+ * - DEVICE_SNAPSHOT_V1 (2):
+ *     [2, device_id, protocol, ts_ms,
+ *      [[point_id, value, ts_ms, quality, changed], ...]]
+ * value는 MessagePack 네이티브 타입(bool/int/float/str)으로 쓰고, 실수는
+ * float32로 손실 없이 표현되면 float32를 쓴다. 형식을 바꿀 때는 기존 번호를
+ * 고치지 않고 새 스키마 번호를 추가한다 (리더는 모르는 번호를 거부).
+ */
+class RedisValueCodec {
+public:
+    static constexpr uint8_t POINT_VALUE_V1 = 1;
+    static constexpr uint8_t DEVICE_SNAPSHOT_V1 = 2;
+
+    // POINT_VALUE_V1 메타데이터 범위 (배열 뒤쪽 선택 원소 수)
+    static constexpr int META_NONE = 0;
+    static constexpr int META_DEVICE_ID = 2;  // changed, device_id
+    static constexpr int META_ALL = 5;        // + point_name, unit, device_name
+
+    /**
+     * @brief 바이너리 페이로드인지 (첫 바이트 + 스키마 번호만 확인)
+     */
+    static bool IsBinary(const std::string& payload);
+
+    /**
+     * @brief out 뒤에 이어서 기록 (out을 비우지 않음)
+     */
+    static void EncodePoint(const PointValueRecord& record, int metadata,
+                            std::string& out);
+    static void EncodeDeviceSnapshot(const DeviceSnapshotRecord& snapshot,
+                                     std::string& out);
+
+    static std::optional<PointValueRecord> DecodePoint(const std::string& payload);
+    static std::optional<DeviceSnapshotRecord>
+    DecodeDeviceSnapshot(const std::string& payload);
+
+    /**
+     * @brief 바이너리 페이로드를 레거시 JSON 모양으로 변환 (디버깅/JSON 소비자용)
+     */
+    static std::optional<nlohmann::json> ToJson(const std::string& payload);
+};
+
+} // namespace Data
+} // namespace Shared
+} // namespace PulseOne
+
+#endif // REDIS_VALUE_CODEC_H
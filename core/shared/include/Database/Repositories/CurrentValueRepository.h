@@ -30,9 +30,8 @@ public:
   // =======================================================================
   // 생성자
   // =======================================================================
-  CurrentValueRepository()
-      : IRepository<CurrentValueEntity>("CurrentValueRepository") {}
-  virtual ~CurrentValueRepository() = default;
+  CurrentValueRepository();
+  virtual ~CurrentValueRepository();
 
   // =======================================================================
   // IRepository 필수 구현 (CRUD)
@@ -84,6 +83,9 @@ public:
 
   /**
    * @brief 다수 엔티티를 1 트랜잭션으로 배치 저장 (30K 포인트 성능 최적화)
+   * @details SQLite면 전용 연결의 캐시된 prepared statement에 값을 바인딩해
+   * 저장한다 (행마다 SQL 생성·이스케이프·파싱 없음). 그 외 DB이거나 전용
+   * 연결을 열 수 없으면 executeBatch 경로를 쓴다.
    * @return 성공한 항목 수
    */
   size_t saveBatch(const std::vector<CurrentValueEntity> &entities);
@@ -101,6 +103,13 @@ protected:
 
 private:
   bool validateCurrentValue(const CurrentValueEntity &entity) const;
+
+  // SQLite 벌크 경로. 전용 연결을 열 수 없으면 -1 반환 (executeBatch로 대체)
+  long saveBatchSQLite(const std::vector<CurrentValueEntity> &entities);
+  size_t saveBatchGeneric(const std::vector<CurrentValueEntity> &entities);
+
+  class BulkWriter; // 전용 SQLite 연결 + 캐시된 UPSERT statement
+  std::unique_ptr<BulkWriter> bulk_writer_;
 };
 
 } // namespace Repositories
@@ -9,12 +9,15 @@
 //   - EdgeServer      : Application.cpp (collector identity / heartbeat)
 //   - VirtualPointBatch : VirtualPointBatchWriter.cpp
 //   - DeviceStatus    : DataProcessingService.cpp
+//   - PointRollup     : DataProcessingService.cpp (롤업 윈도우)
 //   - MaintenanceLog  : LogLevelManager.cpp
 // =============================================================================
 
 #ifndef RUNTIME_SQL_QUERIES_H
 #define RUNTIME_SQL_QUERIES_H
 
+#include <iomanip>
+#include <sstream>
 #include <string>
 
 namespace PulseOne {
@@ -144,6 +147,88 @@ inline std::string UPSERT_STATUS(const std::string &device_id,
 
 } // namespace DeviceStatus
 
+// =============================================================================
+// 🟣 PointRollup — 롤업 윈도우 저장/보존 (DataProcessingService.cpp)
+// =============================================================================
+namespace PointRollup {
+
+const std::string CREATE_TABLE =
+    "CREATE TABLE IF NOT EXISTS point_rollups ("
+    "point_id INTEGER NOT NULL, "
+    "tier TEXT NOT NULL, "
+    "window_start INTEGER NOT NULL, " // UTC epoch ms
+    "min_value REAL, max_value REAL, mean_value REAL, last_value REAL, "
+    "sample_count INTEGER NOT NULL, "
+    "PRIMARY KEY (point_id, tier, window_start))";
+
+// 윈도우 UPSERT (윈도우마다 한 번만 내보냄. 종료 시 열린 윈도우는 아래
+// point_rollup_open에 체크포인트했다가 재시작 후 이어서 누적하므로 같은
+// 윈도우를 다시 쓰면 항상 이전 값을 포함한 전체 윈도우)
+// 파라미터: {point_id}, {tier}, {window_start_ms}, {min}, {max}, {mean},
+// {last}, {count}
+inline std::string UPSERT(int point_id, const std::string &tier,
+                          long long window_start_ms, double min, double max,
+                          double mean, double last, unsigned count) {
+  auto num = [](double v) {
+    std::ostringstream oss;
+    oss << std::setprecision(17) << v;
+    return oss.str();
+  };
+  return "INSERT OR REPLACE INTO point_rollups (point_id, tier, window_start, "
+         "min_value, max_value, mean_value, last_value, sample_count) "
+         "VALUES (" +
+         std::to_string(point_id) + ", '" + tier + "', " +
+         std::to_string(window_start_ms) + ", " + num(min) + ", " + num(max) +
+         ", " + num(mean) + ", " + num(last) + ", " + std::to_string(count) +
+         ")";
+}
+
+// 보존 기간 정리
+// 파라미터: {tier}, {before_ms}
+inline std::string DELETE_BEFORE(const std::string &tier, long long before_ms) {
+  return "DELETE FROM point_rollups WHERE tier = '" + tier +
+         "' AND window_start < " + std::to_string(before_ms);
+}
+
+// 종료 시 열린(진행 중) 윈도우 체크포인트 - 출력이 아니라 누적 상태이므로
+// 평균 대신 합계를 둠. 시작 시 엔진에 되살린 뒤 비움
+const std::string CREATE_OPEN_TABLE =
+    "CREATE TABLE IF NOT EXISTS point_rollup_open ("
+    "point_id INTEGER NOT NULL, "
+    "tier TEXT NOT NULL, "
+    "window_start INTEGER NOT NULL, " // UTC epoch ms
+    "min_value REAL, max_value REAL, sum_value REAL, last_value REAL, "
+    "sample_count INTEGER NOT NULL, "
+    "PRIMARY KEY (point_id, tier))";
+
+// 파라미터: {point_id}, {tier}, {window_start_ms}, {min}, {max}, {sum},
+// {last}, {count}
+inline std::string INSERT_OPEN(int point_id, const std::string &tier,
+                               long long window_start_ms, double min,
+                               double max, double sum, double last,
+                               unsigned count) {
+  auto num = [](double v) {
+    std::ostringstream oss;
+    oss << std::setprecision(17) << v;
+    return oss.str();
+  };
+  return "INSERT OR REPLACE INTO point_rollup_open (point_id, tier, "
+         "window_start, min_value, max_value, sum_value, last_value, "
+         "sample_count) VALUES (" +
+         std::to_string(point_id) + ", '" + tier + "', " +
+         std::to_string(window_start_ms) + ", " + num(min) + ", " + num(max) +
+         ", " + num(sum) + ", " + num(last) + ", " + std::to_string(count) +
+         ")";
+}
+
+const std::string SELECT_OPEN =
+    "SELECT point_id, tier, window_start, min_value, max_value, sum_value, "
+    "last_value, sample_count FROM point_rollup_open";
+
+const std::string DELETE_OPEN = "DELETE FROM point_rollup_open";
+
+} // namespace PointRollup
+
 // =============================================================================
 // 🔴 MaintenanceLog — 로그 레벨 변경 이력 (LogLevelManager.cpp)
 // =============================================================================
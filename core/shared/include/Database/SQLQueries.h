@@ -1231,6 +1231,15 @@ const std::string GET_STATISTICS_SUMMARY = R"(
         FROM current_values
     )";
 
+// 🔥 saveBatch 전용 (SQLite prepared statement, ? 11개 순서대로 바인딩)
+const std::string BULK_UPSERT = R"(
+        INSERT OR REPLACE INTO current_values (
+            point_id, current_value, raw_value, value_type,
+            quality_code, quality, value_timestamp,
+            read_count, write_count, error_count, updated_at
+        ) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
+    )";
+
 // 🔥 기존 테스트와 호환성을 위한 별칭들
 const std::string FIND_BY_POINT_ID = FIND_BY_ID;
 const std::string UPSERT_VALUE = UPSERT;
@@ -40,6 +40,23 @@ public:
         return true;
     }
 
+    // Push as many items as fit under the capacity limit with one lock.
+    // Items are moved from the front of values; returns the number pushed.
+    size_t try_push_batch(std::vector<T>& values, size_t max_size) {
+        size_t pushed = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            while (pushed < values.size() && queue_.size() < max_size) {
+                queue_.push(std::move(values[pushed]));
+                ++pushed;
+            }
+        }
+        if (pushed > 0) {
+            cond_.notify_all();
+        }
+        return pushed;
+    }
+
     // Pop a single item (blocking)
     T pop() {
         std::unique_lock<std::mutex> lock(mutex_);
@@ -1,7 +1,7 @@
 #include "Client/InfluxClientImpl.h"
+#include "Client/LineProtocolEncoder.h"
 #include "Logging/LogManager.h"
 #include <chrono>
-#include <sstream>
 #include <string>
 
 namespace PulseOne {
@@ -73,11 +73,16 @@ bool InfluxClientImpl::writeBatch(const std::vector<std::string> &lines) {
   std::string path =
       "/api/v2/write?org=" + org_ + "&bucket=" + bucket_ + "&precision=s";
 
-  std::ostringstream oss;
+  size_t total = 0;
   for (const auto &line : lines) {
-    oss << line << "\n";
+    total += line.size() + 1;
+  }
+  std::string body;
+  body.reserve(total);
+  for (const auto &line : lines) {
+    body += line;
+    body += '\n';
   }
-  std::string body = oss.str();
 
   auto response = http_client_->post(path, body, "text/plain");
 
@@ -159,66 +164,32 @@ void InfluxClientImpl::disconnect() {
   connected_ = false;
 }
 
-// [BUG #26 FIX] InfluxDB line protocol: tag keys/values must escape spaces,
-// commas, equals.
-static std::string EscapeInfluxTagValue(const std::string &s) {
-  std::string out;
-  out.reserve(s.size() + 4);
-  for (char c : s) {
-    if (c == ' ') {
-      out += '\\ ';
-    } else if (c == ',') {
-      out += "\\,";
-    } else if (c == '=') {
-      out += "\\=";
-    } else {
-      out += c;
-    }
-  }
-  return out;
-}
-
+// [BUG #26 FIX] 태그/필드 이스케이프와 숫자 변환은 LineProtocolEncoder가 담당
 std::string InfluxClientImpl::formatLineProtocol(const std::string &measurement,
                                                  const std::string &field,
                                                  double value,
                                                  long long epoch_seconds) {
   // Line Protocol: measurement field=value timestamp_seconds
-  std::ostringstream oss;
-  oss << EscapeInfluxTagValue(measurement) << " " << EscapeInfluxTagValue(field)
-      << "=" << value;
-  if (epoch_seconds > 0)
-    oss << " " << epoch_seconds;
-  return oss.str();
+  std::string line;
+  const std::string prefix = LineProtocolEncoder::BuildPrefix(
+      measurement, LineProtocolEncoder::Tags{}, field);
+  LineProtocolEncoder::AppendLine(line, prefix, value, epoch_seconds);
+  if (!line.empty())
+    line.pop_back(); // 개행 제거 (호출자가 줄 단위로 조립)
+  return line;
 }
 
 std::string InfluxClientImpl::formatLineProtocol(
     const std::string &measurement,
     const std::map<std::string, std::string> &tags,
     const std::map<std::string, double> &fields, long long epoch_seconds) {
-  std::ostringstream oss;
-  oss << EscapeInfluxTagValue(measurement);
-
-  for (const auto &[key, value] : tags) {
-    oss << "," << EscapeInfluxTagValue(key) << "="
-        << EscapeInfluxTagValue(value);
-  }
-
-  oss << " ";
-
-  bool first = true;
-  for (const auto &[key, value] : fields) {
-    if (!first)
-      oss << ",";
-    oss << EscapeInfluxTagValue(key) << "=" << value;
-    first = false;
-  }
-
   // [BUG #25 FIX] Caller-supplied epoch seconds = actual measurement time.
   // epoch_seconds=0 means no timestamp (InfluxDB server time used as fallback).
-  if (epoch_seconds > 0)
-    oss << " " << epoch_seconds;
-
-  return oss.str();
+  std::string line;
+  LineProtocolEncoder::AppendFields(
+      line, LineProtocolEncoder::BuildPrefix(measurement, tags), fields,
+      epoch_seconds);
+  return line;
 }
 
 } // namespace Client
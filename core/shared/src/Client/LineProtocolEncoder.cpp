@@ -0,0 +1,127 @@
+#include "Client/LineProtocolEncoder.h"
+#include <type_traits>
+#include <variant>
+
+namespace PulseOne {
+namespace Client {
+
+namespace {
+
+template <typename Pred>
+void AppendEscaped(std::string &out, std::string_view text, Pred needs_escape) {
+  size_t start = 0;
+  for (size_t i = 0; i < text.size(); ++i) {
+    if (needs_escape(text[i])) {
+      out.append(text.data() + start, i - start);
+      out += '\\';
+      start = i;
+    }
+  }
+  out.append(text.data() + start, text.size() - start);
+}
+
+template <typename TagRange>
+std::string BuildPrefixImpl(std::string_view measurement, const TagRange &tags,
+                            std::string_view field_key) {
+  std::string prefix;
+  prefix.reserve(measurement.size() + tags.size() * 24 + field_key.size() + 2);
+  LineProtocolEncoder::AppendMeasurement(prefix, measurement);
+  for (const auto &[key, value] : tags) {
+    if (key.empty() || value.empty())
+      continue; // 빈 태그 값은 라인 프로토콜 오류
+    prefix += ',';
+    LineProtocolEncoder::AppendKey(prefix, key);
+    prefix += '=';
+    LineProtocolEncoder::AppendKey(prefix, value);
+  }
+  prefix += ' ';
+  if (!field_key.empty()) {
+    LineProtocolEncoder::AppendKey(prefix, field_key);
+    prefix += '=';
+  }
+  return prefix;
+}
+
+} // namespace
+
+void LineProtocolEncoder::AppendMeasurement(std::string &out,
+                                            std::string_view name) {
+  AppendEscaped(out, name, [](char c) { return c == ',' || c == ' '; });
+}
+
+void LineProtocolEncoder::AppendKey(std::string &out, std::string_view key) {
+  AppendEscaped(out, key,
+                [](char c) { return c == ',' || c == '=' || c == ' '; });
+}
+
+void LineProtocolEncoder::AppendQuoted(std::string &out,
+                                       std::string_view value) {
+  out += '"';
+  AppendEscaped(out, value, [](char c) { return c == '"' || c == '\\'; });
+  out += '"';
+}
+
+bool LineProtocolEncoder::AppendFieldValue(
+    std::string &out, const BasicTypes::DataVariant &value) {
+  return std::visit(
+      [&out](const auto &v) -> bool {
+        using T = std::decay_t<decltype(v)>;
+        if constexpr (std::is_same_v<T, bool>) {
+          out += v ? "true" : "false";
+          return true;
+        } else if constexpr (std::is_same_v<T, std::string>) {
+          AppendQuoted(out, v);
+          return true;
+        } else if constexpr (std::is_floating_point_v<T>) {
+          return AppendDouble(out, static_cast<double>(v));
+        } else if constexpr (std::is_signed_v<T>) {
+          AppendInteger(out, static_cast<int64_t>(v));
+          out += 'i';
+          return true;
+        } else {
+          AppendUnsigned(out, static_cast<uint64_t>(v));
+          out += 'u';
+          return true;
+        }
+      },
+      value);
+}
+
+std::string LineProtocolEncoder::BuildPrefix(std::string_view measurement,
+                                             const Tags &tags,
+                                             std::string_view field_key) {
+  return BuildPrefixImpl(measurement, tags, field_key);
+}
+
+std::string LineProtocolEncoder::BuildPrefix(
+    std::string_view measurement,
+    const std::map<std::string, std::string> &tags,
+    std::string_view field_key) {
+  return BuildPrefixImpl(measurement, tags, field_key);
+}
+
+bool LineProtocolEncoder::AppendFields(
+    std::string &out, std::string_view prefix,
+    const std::map<std::string, double> &fields, int64_t timestamp) {
+  const size_t mark = out.size();
+  out.append(prefix);
+  const size_t fields_start = out.size();
+  for (const auto &[key, value] : fields) {
+    if (!std::isfinite(value))
+      continue;
+    if (out.size() != fields_start)
+      out += ',';
+    AppendKey(out, key);
+    out += '=';
+    AppendDouble(out, value);
+  }
+  if (out.size() == fields_start) {
+    out.resize(mark);
+    return false;
+  }
+  AppendTimestamp(out, timestamp);
+  return true;
+}
+
+} // namespace Client
+} // namespace PulseOne
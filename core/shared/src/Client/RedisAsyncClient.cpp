@@ -0,0 +1,658 @@
+// =============================================================================
+// RedisAsyncClient.cpp - 이벤트 루프 기반 비동기 Redis 클라이언트
+// =============================================================================
+
+#include "Client/RedisAsyncClient.h"
+#include "Logging/LogManager.h"
+#include "Utils/ConfigManager.h"
+#include <algorithm>
+
+#if defined(HAVE_REDIS) && defined(__linux__)
+#define PULSEONE_REDIS_ASYNC 1
+#include <hiredis/async.h>
+#include <hiredis/hiredis.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+namespace PulseOne {
+
+namespace {
+
+void LogAsync(LogLevel level, const std::string &message) {
+  LogManager::getInstance().log("redis", level, "[async] " + message);
+}
+
+} // namespace
+
+// =============================================================================
+// 설정
+// =============================================================================
+
+RedisAsyncOptions RedisAsyncOptions::FromConfig() {
+  auto &config = ConfigManager::getInstance();
+  RedisAsyncOptions options;
+
+  options.enabled = config.getBool("REDIS_ASYNC_ENABLED", false);
+  options.host = config.getOrDefault("REDIS_PRIMARY_HOST", "localhost");
+  options.port = config.getInt("REDIS_PRIMARY_PORT", 6379);
+  options.password = config.getOrDefault("REDIS_PRIMARY_PASSWORD", "");
+  options.database = config.getInt("REDIS_PRIMARY_DB", 0);
+  options.max_in_flight = static_cast<size_t>(
+      std::max(1, config.getInt("REDIS_ASYNC_MAX_IN_FLIGHT", 1000)));
+  options.max_queued = static_cast<size_t>(
+      std::max(1, config.getInt("REDIS_ASYNC_MAX_QUEUED", 10000)));
+  options.connect_timeout_ms =
+      std::max(100, config.getInt("REDIS_PRIMARY_CONNECT_TIMEOUT_MS", 3000));
+  options.reconnect_interval_ms =
+      std::max(10, config.getInt("REDIS_ASYNC_RECONNECT_MS", 1000));
+  options.drain_timeout_ms =
+      std::max(0, config.getInt("REDIS_ASYNC_DRAIN_TIMEOUT_MS", 2000));
+  return options;
+}
+
+// =============================================================================
+// 생성/시작/종료
+// =============================================================================
+
+RedisAsyncClient::RedisAsyncClient(RedisAsyncOptions options)
+    : options_(std::move(options)) {}
+
+RedisAsyncClient::~RedisAsyncClient() { Stop(); }
+
+bool RedisAsyncClient::IsSupported() {
+#ifdef PULSEONE_REDIS_ASYNC
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool RedisAsyncClient::Start() {
+#ifdef PULSEONE_REDIS_ASYNC
+  if (running_.load(std::memory_order_acquire))
+    return true;
+
+  epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+  wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (epoll_fd_ < 0 || wake_fd_ < 0) {
+    LogAsync(LogLevel::LOG_ERROR, "epoll/eventfd 생성 실패");
+    if (epoll_fd_ >= 0)
+      close(epoll_fd_);
+    if (wake_fd_ >= 0)
+      close(wake_fd_);
+    epoll_fd_ = wake_fd_ = -1;
+    return false;
+  }
+
+  epoll_event ev{};
+  ev.events = EPOLLIN;
+  ev.data.u64 = 0; // 0 = wake_fd_, 1 = Redis 소켓
+  epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &ev);
+
+  stopping_.store(false, std::memory_order_release);
+  next_connect_ = std::chrono::steady_clock::now();
+  running_.store(true, std::memory_order_release);
+  loop_thread_ = std::thread(&RedisAsyncClient::Loop, this);
+
+  LogAsync(LogLevel::INFO,
+           "비동기 클라이언트 시작: " + options_.host + ":" +
+               std::to_string(options_.port) + " (in-flight " +
+               std::to_string(options_.max_in_flight) + ", 큐 " +
+               std::to_string(options_.max_queued) + ")");
+  return true;
+#else
+  LogAsync(LogLevel::WARN, "이 빌드는 비동기 Redis를 지원하지 않음");
+  return false;
+#endif
+}
+
+void RedisAsyncClient::Stop() {
+  if (!running_.load(std::memory_order_acquire))
+    return;
+
+  stopping_.store(true, std::memory_order_release);
+  space_cv_.notify_all();
+  Wake();
+
+  if (loop_thread_.joinable())
+    loop_thread_.join();
+
+#ifdef PULSEONE_REDIS_ASYNC
+  close(wake_fd_);
+  close(epoll_fd_);
+  wake_fd_ = epoll_fd_ = -1;
+#endif
+  running_.store(false, std::memory_order_release);
+
+  LogAsync(LogLevel::INFO,
+           "비동기 클라이언트 종료 (완료 " +
+               std::to_string(completed_.load()) + ", 실패 " +
+               std::to_string(failed_.load()) + ")");
+}
+
+// =============================================================================
+// 제출 (호출 스레드)
+// =============================================================================
+
+bool RedisAsyncClient::ReserveLocked(std::unique_lock<std::mutex> &lock,
+                                     size_t count,
+                                     std::chrono::milliseconds wait) {
+  // 한도보다 큰 배치도 큐가 비어 있으면 받는다 (영원히 못 들어가는 것 방지)
+  auto fits = [&] {
+    return queue_.empty() || queue_.size() + count <= options_.max_queued;
+  };
+  if (!fits() && wait.count() > 0) {
+    space_cv_.wait_for(lock, wait, [&] {
+      return stopping_.load(std::memory_order_acquire) || fits();
+    });
+  }
+  return !stopping_.load(std::memory_order_acquire) && fits();
+}
+
+void RedisAsyncClient::Wake() {
+#ifdef PULSEONE_REDIS_ASYNC
+  if (wake_fd_ >= 0) {
+    uint64_t one = 1;
+    ssize_t written = write(wake_fd_, &one, sizeof(one));
+    (void)written; // 카운터가 이미 차 있으면 EAGAIN, 깨우기는 유효
+  }
+#endif
+}
+
+bool RedisAsyncClient::Submit(RedisClient::StringList command,
+                              ReplyCallback callback,
+                              std::chrono::milliseconds wait) {
+  if (!running_.load(std::memory_order_acquire) ||
+      stopping_.load(std::memory_order_acquire) || command.empty()) {
+    rejected_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  Request request;
+  request.command = std::move(command);
+  request.callback = std::move(callback);
+  request.queued_at = std::chrono::steady_clock::now();
+
+  std::unique_lock<std::mutex> lock(queue_mutex_);
+  if (!ReserveLocked(lock, 1, wait)) {
+    rejected_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  bool was_empty = queue_.empty();
+  queue_.push_back(std::move(request));
+  submitted_.fetch_add(1, std::memory_order_relaxed);
+  lock.unlock();
+
+  if (was_empty)
+    Wake();
+  return true;
+}
+
+bool RedisAsyncClient::SubmitBatch(
+    std::vector<RedisClient::StringList> commands, BatchCallback done,
+    std::chrono::milliseconds wait) {
+  if (!running_.load(std::memory_order_acquire) ||
+      stopping_.load(std::memory_order_acquire)) {
+    rejected_.fetch_add(commands.size(), std::memory_order_relaxed);
+    return false;
+  }
+  if (commands.empty()) {
+    if (done)
+      done(0);
+    return true;
+  }
+
+  auto batch = std::make_shared<BatchState>();
+  batch->remaining = commands.size();
+  batch->done = std::move(done);
+  auto now = std::chrono::steady_clock::now();
+
+  std::unique_lock<std::mutex> lock(queue_mutex_);
+  if (!ReserveLocked(lock, commands.size(), wait)) {
+    rejected_.fetch_add(commands.size(), std::memory_order_relaxed);
+    return false;
+  }
+  bool was_empty = queue_.empty();
+  for (auto &command : commands) {
+    Request request;
+    request.command = std::move(command);
+    request.batch = batch;
+    request.queued_at = now;
+    queue_.push_back(std::move(request));
+  }
+  submitted_.fetch_add(commands.size(), std::memory_order_relaxed);
+  lock.unlock();
+
+  if (was_empty)
+    Wake();
+  return true;
+}
+
+std::future<RedisAsyncReply>
+RedisAsyncClient::Execute(RedisClient::StringList command) {
+  auto promise = std::make_shared<std::promise<RedisAsyncReply>>();
+  auto future = promise->get_future();
+  bool accepted =
+      Submit(std::move(command), [promise](RedisAsyncReply &&reply) {
+        promise->set_value(std::move(reply));
+      });
+  if (!accepted)
+    promise->set_value(RedisAsyncReply::Error("rejected"));
+  return future;
+}
+
+RedisAsyncStats RedisAsyncClient::GetStats() const {
+  RedisAsyncStats stats;
+  stats.connected = connected_.load(std::memory_order_acquire);
+  stats.submitted = submitted_.load(std::memory_order_relaxed);
+  stats.completed = completed_.load(std::memory_order_relaxed);
+  stats.failed = failed_.load(std::memory_order_relaxed);
+  stats.rejected = rejected_.load(std::memory_order_relaxed);
+  stats.write_batches = write_batches_.load(std::memory_order_relaxed);
+  stats.batched_commands = batched_commands_.load(std::memory_order_relaxed);
+  stats.reconnects = reconnects_.load(std::memory_order_relaxed);
+  stats.latency_us_total = latency_us_total_.load(std::memory_order_relaxed);
+  stats.latency_us_max = latency_us_max_.load(std::memory_order_relaxed);
+  stats.in_flight = in_flight_count_.load(std::memory_order_relaxed);
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    stats.queued = queue_.size();
+  }
+  return stats;
+}
+
+#ifdef PULSEONE_REDIS_ASYNC
+
+// =============================================================================
+// 이벤트 루프 (루프 스레드)
+// =============================================================================
+
+namespace {
+
+constexpr uint64_t kWakeTag = 0;
+constexpr uint64_t kRedisTag = 1;
+constexpr int kMaxEvents = 16;
+constexpr int kIdleWaitMs = 50; // 연결 시간 초과/재연결 확인 주기
+
+RedisAsyncReply ConvertReply(const redisReply *reply) {
+  RedisAsyncReply out;
+  switch (reply->type) {
+  case REDIS_REPLY_STRING:
+    out.type = RedisAsyncReply::Type::STRING;
+    out.str.assign(reply->str, reply->len);
+    break;
+  case REDIS_REPLY_STATUS:
+    out.type = RedisAsyncReply::Type::STATUS;
+    out.str.assign(reply->str, reply->len);
+    break;
+  case REDIS_REPLY_ERROR:
+    out.type = RedisAsyncReply::Type::ERROR_REPLY;
+    out.str.assign(reply->str, reply->len);
+    break;
+  case REDIS_REPLY_INTEGER:
+    out.type = RedisAsyncReply::Type::INTEGER;
+    out.integer = reply->integer;
+    break;
+  case REDIS_REPLY_ARRAY:
+    out.type = RedisAsyncReply::Type::ARRAY;
+    out.elements.reserve(reply->elements);
+    for (size_t i = 0; i < reply->elements; ++i)
+      out.elements.push_back(ConvertReply(reply->element[i]));
+    break;
+  default:
+    // RESP3 타입(double/bool 등)은 문자열 표현이 있으면 문자열로
+    if (reply->str) {
+      out.type = RedisAsyncReply::Type::STRING;
+      out.str.assign(reply->str, reply->len);
+    }
+    break;
+  }
+  return out;
+}
+
+} // namespace
+
+void RedisAsyncClient::Loop() {
+  using Clock = std::chrono::steady_clock;
+  auto drain_deadline = Clock::time_point::max();
+  epoll_event events[kMaxEvents];
+
+  while (true) {
+    auto now = Clock::now();
+
+    if (stopping_.load(std::memory_order_acquire)) {
+      if (drain_deadline == Clock::time_point::max())
+        drain_deadline =
+            now + std::chrono::milliseconds(options_.drain_timeout_ms);
+      bool queue_empty;
+      {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        queue_empty = queue_.empty();
+      }
+      if ((queue_empty && in_flight_.empty()) || now >= drain_deadline)
+        break;
+    }
+
+    if (!context_ && now >= next_connect_)
+      Connect();
+    if (context_ && !ready_ && now >= connect_deadline_)
+      CloseContext("연결 시간 초과");
+    if (ready_)
+      Dispatch();
+
+    int count = epoll_wait(epoll_fd_, events, kMaxEvents, kIdleWaitMs);
+    for (int i = 0; i < count; ++i) {
+      if (events[i].data.u64 == kWakeTag) {
+        uint64_t value;
+        while (read(wake_fd_, &value, sizeof(value)) > 0) {
+        }
+        continue;
+      }
+      if (!context_)
+        continue;
+      uint32_t flags = events[i].events;
+      if (flags & (EPOLLIN | EPOLLERR | EPOLLHUP))
+        redisAsyncHandleRead(context_);
+      // 읽기 중 연결이 끊기면 context_는 이미 해제됨
+      if (context_ && (flags & EPOLLOUT))
+        redisAsyncHandleWrite(context_);
+    }
+  }
+
+  CloseContext("종료");
+  FailAll("stopped");
+}
+
+void RedisAsyncClient::Connect() {
+  auto now = std::chrono::steady_clock::now();
+  next_connect_ =
+      now + std::chrono::milliseconds(options_.reconnect_interval_ms);
+
+  redisAsyncContext *ac =
+      redisAsyncConnect(options_.host.c_str(), options_.port);
+  if (!ac)
+    return;
+  if (ac->err) {
+    LogAsync(LogLevel::WARN, "연결 실패: " + std::string(ac->errstr));
+    redisAsyncFree(ac);
+    return;
+  }
+
+  context_ = ac;
+  context_fd_ = ac->c.fd;
+  registered_ = reading_ = writing_ = false;
+  ready_ = false;
+  connect_deadline_ =
+      now + std::chrono::milliseconds(options_.connect_timeout_ms);
+
+  ac->data = this;
+  // 연결 콜백 등록이 쓰기 이벤트를 요청하므로 훅을 먼저 설정
+  ac->ev.data = this;
+  ac->ev.addRead = &RedisAsyncClient::AddRead;
+  ac->ev.delRead = &RedisAsyncClient::DelRead;
+  ac->ev.addWrite = &RedisAsyncClient::AddWrite;
+  ac->ev.delWrite = &RedisAsyncClient::DelWrite;
+  ac->ev.cleanup = &RedisAsyncClient::Cleanup;
+  redisAsyncSetConnectCallback(ac, &RedisAsyncClient::OnConnect);
+  redisAsyncSetDisconnectCallback(ac, &RedisAsyncClient::OnDisconnect);
+
+  // AUTH/SELECT는 큐보다 먼저 출력 버퍼에 넣는다 (연결 완료 시 함께 전송)
+  if (!options_.password.empty()) {
+    Request auth;
+    auth.command = {"AUTH", options_.password};
+    auth.internal = true;
+    SendRequest(auth);
+  }
+  if (context_ && options_.database != 0) {
+    Request select;
+    select.command = {"SELECT", std::to_string(options_.database)};
+    select.internal = true;
+    SendRequest(select);
+  }
+}
+
+void RedisAsyncClient::CloseContext(const std::string &reason) {
+  if (!context_)
+    return;
+  LogAsync(LogLevel::WARN, "연결 닫음: " + reason);
+
+  redisAsyncContext *ac = context_;
+  context_ = nullptr;
+  ready_ = false;
+  connected_.store(false, std::memory_order_release);
+  // 응답 대기 중인 명령은 hiredis가 nullptr 응답으로 콜백 → OnReply에서 실패
+  redisAsyncFree(ac);
+  next_connect_ = std::chrono::steady_clock::now() +
+                  std::chrono::milliseconds(options_.reconnect_interval_ms);
+}
+
+void RedisAsyncClient::Dispatch() {
+  if (!context_ || in_flight_.size() >= options_.max_in_flight)
+    return;
+
+  std::vector<Request> batch;
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    size_t room = options_.max_in_flight - in_flight_.size();
+    size_t take = std::min(room, queue_.size());
+    if (take == 0)
+      return;
+    batch.reserve(take);
+    for (size_t i = 0; i < take; ++i) {
+      batch.push_back(std::move(queue_.front()));
+      queue_.pop_front();
+    }
+  }
+  space_cv_.notify_all();
+
+  // 출력 버퍼에만 쌓고, 실제 write는 다음 쓰기 이벤트에서 한 번에
+  size_t sent = 0;
+  for (; sent < batch.size(); ++sent) {
+    if (!SendRequest(batch[sent]))
+      break;
+  }
+  if (sent < batch.size()) {
+    // 연결이 끊기는 중: 못 보낸 명령은 순서를 유지한 채 큐 앞으로 되돌림
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    for (size_t i = batch.size(); i > sent; --i)
+      queue_.push_front(std::move(batch[i - 1]));
+  }
+  if (sent > 0) {
+    write_batches_.fetch_add(1, std::memory_order_relaxed);
+    batched_commands_.fetch_add(sent, std::memory_order_relaxed);
+  }
+}
+
+bool RedisAsyncClient::SendRequest(Request &request) {
+  std::vector<const char *> argv;
+  std::vector<size_t> argvlen;
+  argv.reserve(request.command.size());
+  argvlen.reserve(request.command.size());
+  for (const auto &arg : request.command) {
+    argv.push_back(arg.data());
+    argvlen.push_back(arg.size());
+  }
+
+  int rc = redisAsyncCommandArgv(context_, &RedisAsyncClient::OnReply, nullptr,
+                                 static_cast<int>(argv.size()), argv.data(),
+                                 argvlen.data());
+  if (rc != REDIS_OK)
+    return false;
+
+  in_flight_.push_back(std::move(request));
+  in_flight_count_.store(in_flight_.size(), std::memory_order_relaxed);
+  return true;
+}
+
+void RedisAsyncClient::Complete(Request &request, const void *raw,
+                                const char *error) {
+  const auto *reply = static_cast<const redisReply *>(raw);
+  bool ok = reply && reply->type != REDIS_REPLY_ERROR;
+
+  if (request.internal) {
+    if (!ok) {
+      LogAsync(LogLevel::LOG_ERROR,
+               request.command.front() + " 실패: " +
+                   (reply && reply->str ? std::string(reply->str, reply->len)
+                                        : std::string(error)));
+    }
+    return;
+  }
+
+  auto latency = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - request.queued_at)
+          .count());
+  latency_us_total_.fetch_add(latency, std::memory_order_relaxed);
+  uint64_t max = latency_us_max_.load(std::memory_order_relaxed);
+  while (latency > max && !latency_us_max_.compare_exchange_weak(
+                              max, latency, std::memory_order_relaxed)) {
+  }
+  (ok ? completed_ : failed_).fetch_add(1, std::memory_order_relaxed);
+
+  try {
+    if (request.batch) {
+      auto &batch = *request.batch;
+      if (ok)
+        ++batch.ok;
+      if (--batch.remaining == 0 && batch.done)
+        batch.done(batch.ok);
+    } else if (request.callback) {
+      request.callback(reply ? ConvertReply(reply)
+                             : RedisAsyncReply::Error(error));
+    }
+  } catch (const std::exception &e) {
+    LogAsync(LogLevel::LOG_ERROR, "콜백 예외: " + std::string(e.what()));
+  }
+}
+
+void RedisAsyncClient::FailAll(const std::string &reason) {
+  while (!in_flight_.empty()) {
+    Request request = std::move(in_flight_.front());
+    in_flight_.pop_front();
+    Complete(request, nullptr, reason.c_str());
+  }
+  in_flight_count_.store(0, std::memory_order_relaxed);
+
+  std::deque<Request> pending;
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    pending.swap(queue_);
+  }
+  space_cv_.notify_all();
+  for (auto &request : pending)
+    Complete(request, nullptr, reason.c_str());
+}
+
+void RedisAsyncClient::UpdateEvents() {
+  if (epoll_fd_ < 0 || context_fd_ < 0)
+    return;
+
+  uint32_t flags = (reading_ ? EPOLLIN : 0u) | (writing_ ? EPOLLOUT : 0u);
+  if (flags == 0) {
+    if (registered_) {
+      epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, context_fd_, nullptr);
+      registered_ = false;
+    }
+    return;
+  }
+
+  epoll_event ev{};
+  ev.events = flags;
+  ev.data.u64 = kRedisTag;
+  epoll_ctl(epoll_fd_, registered_ ? EPOLL_CTL_MOD : EPOLL_CTL_ADD,
+            context_fd_, &ev);
+  registered_ = true;
+}
+
+// =============================================================================
+// hiredis 콜백 / 이벤트 훅 (모두 루프 스레드에서 호출)
+// =============================================================================
+
+void RedisAsyncClient::OnConnect(const redisAsyncContext *ac, int status) {
+  auto *self = static_cast<RedisAsyncClient *>(ac->data);
+  if (status != REDIS_OK) {
+    // 실패한 컨텍스트는 콜백 반환 후 hiredis가 해제
+    LogAsync(LogLevel::WARN, "연결 실패: " + std::string(ac->errstr));
+    if (self->context_ == ac)
+      self->context_ = nullptr;
+    self->ready_ = false;
+    return;
+  }
+
+  self->ready_ = true;
+  self->connected_.store(true, std::memory_order_release);
+  LogAsync(LogLevel::INFO, "연결됨: " + self->options_.host + ":" +
+                               std::to_string(self->options_.port));
+}
+
+void RedisAsyncClient::OnDisconnect(const redisAsyncContext *ac, int status) {
+  auto *self = static_cast<RedisAsyncClient *>(ac->data);
+  // CloseContext()가 직접 닫은 경우 context_는 이미 nullptr
+  bool unexpected = self->context_ == ac;
+  if (unexpected)
+    self->context_ = nullptr;
+  self->ready_ = false;
+  self->connected_.store(false, std::memory_order_release);
+
+  if (unexpected) {
+    self->reconnects_.fetch_add(1, std::memory_order_relaxed);
+    self->next_connect_ =
+        std::chrono::steady_clock::now() +
+        std::chrono::milliseconds(self->options_.reconnect_interval_ms);
+    LogAsync(LogLevel::WARN,
+             "연결 끊김" + (status != REDIS_OK && ac->errstr
+                                ? ": " + std::string(ac->errstr)
+                                : std::string()));
+  }
+}
+
+void RedisAsyncClient::OnReply(redisAsyncContext *ac, void *reply,
+                               void * /*privdata*/) {
+  auto *self = static_cast<RedisAsyncClient *>(ac->data);
+  if (self->in_flight_.empty())
+    return;
+
+  Request request = std::move(self->in_flight_.front());
+  self->in_flight_.pop_front();
+  self->in_flight_count_.store(self->in_flight_.size(),
+                               std::memory_order_relaxed);
+  self->Complete(request, reply, "connection lost");
+}
+
+void RedisAsyncClient::AddRead(void *privdata) {
+  auto *self = static_cast<RedisAsyncClient *>(privdata);
+  self->reading_ = true;
+  self->UpdateEvents();
+}
+
+void RedisAsyncClient::DelRead(void *privdata) {
+  auto *self = static_cast<RedisAsyncClient *>(privdata);
+  self->reading_ = false;
+  self->UpdateEvents();
+}
+
+void RedisAsyncClient::AddWrite(void *privdata) {
+  auto *self = static_cast<RedisAsyncClient *>(privdata);
+  self->writing_ = true;
+  self->UpdateEvents();
+}
+
+void RedisAsyncClient::DelWrite(void *privdata) {
+  auto *self = static_cast<RedisAsyncClient *>(privdata);
+  self->writing_ = false;
+  self->UpdateEvents();
+}
+
+void RedisAsyncClient::Cleanup(void *privdata) {
+  auto *self = static_cast<RedisAsyncClient *>(privdata);
+  self->reading_ = self->writing_ = false;
+  self->UpdateEvents();
+  self->context_fd_ = -1;
+}
+
+#endif // PULSEONE_REDIS_ASYNC
+
+} // namespace PulseOne
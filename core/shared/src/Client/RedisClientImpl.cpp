@@ -5,6 +5,7 @@
 #include "Client/RedisClientImpl.h"
 #include "Logging/LogManager.h"
 #include "Utils/ConfigManager.h"
+#include <algorithm>
 #include <functional>
 #include <sstream>
 #include <stdarg.h>
@@ -31,6 +32,11 @@ struct redisReply {
 
 namespace PulseOne {
 
+#ifdef HAVE_REDIS
+thread_local const RedisClientImpl *RedisClientImpl::tls_owner_ = nullptr;
+thread_local redisContext *RedisClientImpl::tls_context_ = nullptr;
+#endif
+
 // =============================================================================
 // 생성자/소멸자
 // =============================================================================
@@ -80,6 +86,9 @@ RedisClientImpl::~RedisClientImpl() {
 #endif
     context_ = nullptr;
   }
+#ifdef HAVE_REDIS
+  resetPool();
+#endif
 
   connected_ = false;
   logInfo("Redis 클라이언트 종료 완료");
@@ -107,6 +116,9 @@ bool RedisClientImpl::connect(const std::string &host, int port,
 #endif
     context_ = nullptr;
   }
+#ifdef HAVE_REDIS
+  resetPool(); // 풀 연결도 새 주소로 다시 연결
+#endif
 
   connected_ = false;
 
@@ -124,6 +136,9 @@ void RedisClientImpl::disconnect() {
 #endif
     context_ = nullptr;
   }
+#ifdef HAVE_REDIS
+  resetPool();
+#endif
 
   connected_ = false;
   reconnect_attempts_ = 0; // 재연결 시도 횟수 초기화
@@ -158,7 +173,7 @@ bool RedisClientImpl::isSubscriberMode() const {
 // =============================================================================
 
 bool RedisClientImpl::set(const std::string &key, const std::string &value) {
-  return executeWithRetry<bool>(
+  return executePooled<bool>(
       [this, &key, &value]() {
 #ifdef HAVE_REDIS
         redisReply *reply =
@@ -177,7 +192,7 @@ bool RedisClientImpl::set(const std::string &key, const std::string &value) {
 
 bool RedisClientImpl::setex(const std::string &key, const std::string &value,
                             int expire_seconds) {
-  return executeWithRetry<bool>(
+  return executePooled<bool>(
       [this, key, value, expire_seconds]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("SETEX %s %d %s", key.c_str(),
@@ -215,7 +230,7 @@ bool RedisClientImpl::setex(const std::string &key, const std::string &value,
 }
 
 std::string RedisClientImpl::get(const std::string &key) {
-  return executeWithRetry<std::string>(
+  return executePooled<std::string>(
       [this, &key]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("GET %s", key.c_str());
@@ -232,7 +247,7 @@ std::string RedisClientImpl::get(const std::string &key) {
 }
 
 int RedisClientImpl::del(const std::string &key) {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this, &key]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("DEL %s", key.c_str());
@@ -249,7 +264,7 @@ int RedisClientImpl::del(const std::string &key) {
 }
 
 bool RedisClientImpl::exists(const std::string &key) {
-  return executeWithRetry<bool>(
+  return executePooled<bool>(
       [this, &key]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("EXISTS %s", key.c_str());
@@ -266,7 +281,7 @@ bool RedisClientImpl::exists(const std::string &key) {
 }
 
 RedisClient::StringList RedisClientImpl::keys(const std::string &pattern) {
-  return executeWithRetry<StringList>(
+  return executePooled<StringList>(
       [this, &pattern]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("KEYS %s", pattern.c_str());
@@ -288,7 +303,7 @@ RedisClient::StringList RedisClientImpl::keys(const std::string &pattern) {
 // SCAN: 논블로킹 커서 기반 키 순회 (프로덕션 안전, 30K+ 키 지원)
 RedisClient::StringList RedisClientImpl::scan(const std::string &pattern,
                                               int count) {
-  return executeWithRetry<StringList>(
+  return executePooled<StringList>(
       [this, &pattern, count]() {
         StringList all_keys;
 #ifdef HAVE_REDIS
@@ -328,7 +343,7 @@ RedisClient::StringList RedisClientImpl::scan(const std::string &pattern,
 }
 
 bool RedisClientImpl::expire(const std::string &key, int seconds) {
-  return executeWithRetry<bool>(
+  return executePooled<bool>(
       [this, &key, seconds]() {
 #ifdef HAVE_REDIS
         redisReply *reply =
@@ -347,7 +362,7 @@ bool RedisClientImpl::expire(const std::string &key, int seconds) {
 }
 
 int RedisClientImpl::ttl(const std::string &key) {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this, &key]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("TTL %s", key.c_str());
@@ -364,7 +379,7 @@ int RedisClientImpl::ttl(const std::string &key) {
 }
 
 int RedisClientImpl::incr(const std::string &key, int increment) {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this, &key, increment]() {
 #ifdef HAVE_REDIS
         redisReply *reply;
@@ -391,7 +406,7 @@ int RedisClientImpl::incr(const std::string &key, int increment) {
 
 bool RedisClientImpl::hset(const std::string &key, const std::string &field,
                            const std::string &value) {
-  return executeWithRetry<bool>(
+  return executePooled<bool>(
       [this, &key, &field, &value]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("HSET %s %s %s", key.c_str(),
@@ -410,7 +425,7 @@ bool RedisClientImpl::hset(const std::string &key, const std::string &field,
 
 std::string RedisClientImpl::hget(const std::string &key,
                                   const std::string &field) {
-  return executeWithRetry<std::string>(
+  return executePooled<std::string>(
       [this, &key, &field]() {
 #ifdef HAVE_REDIS
         redisReply *reply =
@@ -428,7 +443,7 @@ std::string RedisClientImpl::hget(const std::string &key,
 }
 
 RedisClient::StringMap RedisClientImpl::hgetall(const std::string &key) {
-  return executeWithRetry<StringMap>(
+  return executePooled<StringMap>(
       [this, &key]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("HGETALL %s", key.c_str());
@@ -448,7 +463,7 @@ RedisClient::StringMap RedisClientImpl::hgetall(const std::string &key) {
 }
 
 int RedisClientImpl::hdel(const std::string &key, const std::string &field) {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this, &key, &field]() {
 #ifdef HAVE_REDIS
         redisReply *reply =
@@ -467,7 +482,7 @@ int RedisClientImpl::hdel(const std::string &key, const std::string &field) {
 
 bool RedisClientImpl::hexists(const std::string &key,
                               const std::string &field) {
-  return executeWithRetry<bool>(
+  return executePooled<bool>(
       [this, &key, &field]() {
 #ifdef HAVE_REDIS
         redisReply *reply =
@@ -485,7 +500,7 @@ bool RedisClientImpl::hexists(const std::string &key,
 }
 
 int RedisClientImpl::hlen(const std::string &key) {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this, &key]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("HLEN %s", key.c_str());
@@ -506,7 +521,7 @@ int RedisClientImpl::hlen(const std::string &key) {
 // =============================================================================
 
 int RedisClientImpl::lpush(const std::string &key, const std::string &value) {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this, &key, &value]() {
 #ifdef HAVE_REDIS
         redisReply *reply =
@@ -524,7 +539,7 @@ int RedisClientImpl::lpush(const std::string &key, const std::string &value) {
 }
 
 int RedisClientImpl::rpush(const std::string &key, const std::string &value) {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this, &key, &value]() {
 #ifdef HAVE_REDIS
         redisReply *reply =
@@ -542,7 +557,7 @@ int RedisClientImpl::rpush(const std::string &key, const std::string &value) {
 }
 
 std::string RedisClientImpl::lpop(const std::string &key) {
-  return executeWithRetry<std::string>(
+  return executePooled<std::string>(
       [this, &key]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("LPOP %s", key.c_str());
@@ -559,7 +574,7 @@ std::string RedisClientImpl::lpop(const std::string &key) {
 }
 
 std::string RedisClientImpl::rpop(const std::string &key) {
-  return executeWithRetry<std::string>(
+  return executePooled<std::string>(
       [this, &key]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("RPOP %s", key.c_str());
@@ -577,7 +592,7 @@ std::string RedisClientImpl::rpop(const std::string &key) {
 
 RedisClient::StringList RedisClientImpl::lrange(const std::string &key,
                                                 int start, int stop) {
-  return executeWithRetry<StringList>(
+  return executePooled<StringList>(
       [this, &key, start, stop]() {
 #ifdef HAVE_REDIS
         redisReply *reply =
@@ -599,7 +614,7 @@ RedisClient::StringList RedisClientImpl::lrange(const std::string &key,
 }
 
 int RedisClientImpl::llen(const std::string &key) {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this, &key]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("LLEN %s", key.c_str());
@@ -620,7 +635,7 @@ int RedisClientImpl::llen(const std::string &key) {
 // =============================================================================
 
 int RedisClientImpl::sadd(const std::string &key, const std::string &member) {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this, &key, &member]() {
 #ifdef HAVE_REDIS
         redisReply *reply =
@@ -638,7 +653,7 @@ int RedisClientImpl::sadd(const std::string &key, const std::string &member) {
 }
 
 int RedisClientImpl::srem(const std::string &key, const std::string &member) {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this, &key, &member]() {
 #ifdef HAVE_REDIS
         redisReply *reply =
@@ -657,7 +672,7 @@ int RedisClientImpl::srem(const std::string &key, const std::string &member) {
 
 bool RedisClientImpl::sismember(const std::string &key,
                                 const std::string &member) {
-  return executeWithRetry<bool>(
+  return executePooled<bool>(
       [this, &key, &member]() {
 #ifdef HAVE_REDIS
         redisReply *reply =
@@ -675,7 +690,7 @@ bool RedisClientImpl::sismember(const std::string &key,
 }
 
 RedisClient::StringList RedisClientImpl::smembers(const std::string &key) {
-  return executeWithRetry<StringList>(
+  return executePooled<StringList>(
       [this, &key]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("SMEMBERS %s", key.c_str());
@@ -695,7 +710,7 @@ RedisClient::StringList RedisClientImpl::smembers(const std::string &key) {
 }
 
 int RedisClientImpl::scard(const std::string &key) {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this, &key]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("SCARD %s", key.c_str());
@@ -717,7 +732,7 @@ int RedisClientImpl::scard(const std::string &key) {
 
 int RedisClientImpl::zadd(const std::string &key, double score,
                           const std::string &member) {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this, &key, score, &member]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("ZADD %s %f %s", key.c_str(),
@@ -736,7 +751,7 @@ int RedisClientImpl::zadd(const std::string &key, double score,
 }
 
 int RedisClientImpl::zrem(const std::string &key, const std::string &member) {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this, &key, &member]() {
 #ifdef HAVE_REDIS
         redisReply *reply =
@@ -755,7 +770,7 @@ int RedisClientImpl::zrem(const std::string &key, const std::string &member) {
 
 RedisClient::StringList RedisClientImpl::zrange(const std::string &key,
                                                 int start, int stop) {
-  return executeWithRetry<StringList>(
+  return executePooled<StringList>(
       [this, &key, start, stop]() {
 #ifdef HAVE_REDIS
         redisReply *reply =
@@ -777,7 +792,7 @@ RedisClient::StringList RedisClientImpl::zrange(const std::string &key,
 }
 
 int RedisClientImpl::zcard(const std::string &key) {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this, &key]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("ZCARD %s", key.c_str());
@@ -799,7 +814,7 @@ int RedisClientImpl::zcard(const std::string &key) {
 
 int RedisClientImpl::publish(const std::string &channel,
                              const std::string &message) {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this, &channel, &message]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("PUBLISH %s %s", channel.c_str(),
@@ -1030,7 +1045,7 @@ bool RedisClientImpl::mset(const StringMap &key_values) {
   if (key_values.empty())
     return true;
 
-  return executeWithRetry<bool>(
+  return executePooled<bool>(
       [this, &key_values]() {
 #ifdef HAVE_REDIS
         std::vector<std::string> args;
@@ -1050,7 +1065,7 @@ bool RedisClientImpl::mset(const StringMap &key_values) {
         }
 
         redisReply *reply = static_cast<redisReply *>(redisCommandArgv(
-            context_, argv.size(), argv.data(), argvlen.data()));
+            activeContext(), argv.size(), argv.data(), argvlen.data()));
 
         bool result = isReplyOK(reply);
         if (reply)
@@ -1069,7 +1084,7 @@ RedisClient::StringList RedisClientImpl::mget(const StringList &keys) {
   if (keys.empty())
     return StringList{};
 
-  return executeWithRetry<StringList>(
+  return executePooled<StringList>(
       [this, &keys]() {
 #ifdef HAVE_REDIS
         std::vector<std::string> args;
@@ -1085,7 +1100,7 @@ RedisClient::StringList RedisClientImpl::mget(const StringList &keys) {
         }
 
         redisReply *reply = static_cast<redisReply *>(redisCommandArgv(
-            context_, argv.size(), argv.data(), argvlen.data()));
+            activeContext(), argv.size(), argv.data(), argvlen.data()));
 
         StringList result = replyToStringList(reply);
         if (reply)
@@ -1104,6 +1119,68 @@ RedisClient::StringList RedisClientImpl::mget(const StringList &keys) {
       StringList{});
 }
 
+size_t RedisClientImpl::pipeline(const std::vector<StringList> &commands) {
+  if (commands.empty())
+    return 0;
+
+  return executePooled<size_t>(
+      [this, &commands]() -> size_t {
+#ifdef HAVE_REDIS
+        redisContext *context = activeContext();
+
+        // 1. 출력 버퍼에 모두 쌓기 (네트워크 전송 없음)
+        std::vector<const char *> argv;
+        std::vector<size_t> argvlen;
+        size_t appended = 0;
+        for (const auto &command : commands) {
+          if (command.empty())
+            continue;
+          argv.clear();
+          argvlen.clear();
+          for (const auto &arg : command) {
+            argv.push_back(arg.c_str());
+            argvlen.push_back(arg.length());
+          }
+          if (redisAppendCommandArgv(context, static_cast<int>(argv.size()),
+                                     argv.data(),
+                                     argvlen.data()) != REDIS_OK) {
+            break; // 메모리 부족 등: 쌓인 명령까지만 전송
+          }
+          ++appended;
+        }
+
+        // 2. 첫 redisGetReply가 버퍼를 한 번에 쓰고, 응답을 순서대로 읽음
+        size_t ok = 0;
+        size_t errors = 0;
+        for (size_t i = 0; i < appended; ++i) {
+          void *raw = nullptr;
+          if (redisGetReply(context, &raw) != REDIS_OK) {
+            markConnectionLost();
+            logWarning("Redis 파이프라인 중 연결 오류: " +
+                       std::to_string(i) + "/" + std::to_string(appended) +
+                       "개 응답 수신");
+            break;
+          }
+          redisReply *reply = static_cast<redisReply *>(raw);
+          if (reply && reply->type != REDIS_REPLY_ERROR) {
+            ++ok;
+          } else if (reply && errors++ == 0) {
+            logWarning("Redis 파이프라인 오류 응답: " +
+                       std::string(reply->str, reply->len));
+          }
+          if (reply)
+            freeReplyObject(reply);
+        }
+        return ok;
+#else
+        logInfo("PIPELINE (시뮬레이션): " + std::to_string(commands.size()) +
+                "개 명령");
+        return commands.size();
+#endif
+      },
+      0);
+}
+
 // =============================================================================
 // 트랜잭션 지원
 // =============================================================================
@@ -1114,6 +1191,8 @@ bool RedisClientImpl::multi() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("MULTI");
         bool result = isReplyOK(reply);
+        if (result) // 이 스레드의 명령은 EXEC/DISCARD까지 기본 연결로
+          transaction_thread_ = std::this_thread::get_id();
         if (reply)
           freeReplyObject(reply);
         return result;
@@ -1131,6 +1210,7 @@ bool RedisClientImpl::exec() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("EXEC");
         bool result = reply && reply->type == REDIS_REPLY_ARRAY;
+        transaction_thread_ = std::thread::id();
         if (reply)
           freeReplyObject(reply);
         return result;
@@ -1148,6 +1228,7 @@ bool RedisClientImpl::discard() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("DISCARD");
         bool result = isReplyOK(reply);
+        transaction_thread_ = std::thread::id();
         if (reply)
           freeReplyObject(reply);
         return result;
@@ -1164,7 +1245,7 @@ bool RedisClientImpl::discard() {
 // =============================================================================
 
 RedisClient::StringMap RedisClientImpl::info() {
-  return executeWithRetry<StringMap>(
+  return executePooled<StringMap>(
       [this]() {
         StringMap result;
 
@@ -1232,6 +1313,7 @@ bool RedisClientImpl::select(int db_index) {
         bool result = isReplyOK(reply);
         if (result) {
           database_ = db_index;
+          resetPool(); // 풀 연결도 새 DB로
         }
         if (reply)
           freeReplyObject(reply);
@@ -1246,7 +1328,7 @@ bool RedisClientImpl::select(int db_index) {
 }
 
 int RedisClientImpl::dbsize() {
-  return executeWithRetry<int>(
+  return executePooled<int>(
       [this]() {
 #ifdef HAVE_REDIS
         redisReply *reply = executeCommandSafe("DBSIZE");
@@ -1277,6 +1359,22 @@ RedisClientImpl::ConnectionStats RedisClientImpl::getStats() const {
   stats.connect_time = connect_time_;
   stats.is_connected = connected_;
 
+  stats.pool_size = pool_size_;
+  stats.pool_checkouts = pool_checkouts_;
+  stats.pool_waits = pool_waits_;
+  stats.pool_wait_timeouts = pool_wait_timeouts_;
+  stats.pool_wait_us_total = pool_wait_us_total_;
+  stats.pool_wait_us_max = pool_wait_us_max_;
+  stats.pool_connects = pool_connects_;
+  stats.pool_health_failures = pool_health_failures_;
+#ifdef HAVE_REDIS
+  {
+    std::lock_guard<std::mutex> pool_lock(pool_mutex_);
+    for (const auto &slot : pool_slots_) // 사용 중인 슬롯은 연결된 것으로
+      stats.pool_open += (slot.in_use || slot.context) ? 1 : 0;
+  }
+#endif
+
   return stats;
 }
 
@@ -1288,6 +1386,13 @@ void RedisClientImpl::resetStats() {
   failed_commands_ = 0;
   total_reconnects_ = 0;
   connect_time_ = std::chrono::steady_clock::now();
+  pool_checkouts_ = 0;
+  pool_waits_ = 0;
+  pool_wait_timeouts_ = 0;
+  pool_wait_us_total_ = 0;
+  pool_wait_us_max_ = 0;
+  pool_connects_ = 0;
+  pool_health_failures_ = 0;
 
   logInfo("Redis 통계 초기화 완료");
 }
@@ -1331,6 +1436,18 @@ void RedisClientImpl::loadConfiguration() {
     logInfo("🔗 Redis 연결 타임아웃: " + std::to_string(connect_timeout_ms) +
             "ms");
 
+    // 연결 풀: 1이면 기존처럼 연결 하나를 직렬로 사용
+    pool_size_ =
+        static_cast<size_t>(std::max(1, config.getInt("REDIS_POOL_SIZE", 4)));
+    pool_wait_timeout_ = std::chrono::milliseconds(
+        std::max(0, config.getInt("REDIS_POOL_WAIT_TIMEOUT_MS", 200)));
+    pool_health_check_ = std::chrono::seconds(
+        std::max(0, config.getInt("REDIS_POOL_HEALTH_CHECK_SEC", 30)));
+#ifdef HAVE_REDIS
+    pool_slots_.assign(pool_size_ > 1 ? pool_size_ : 0, PoolSlot{});
+#endif
+    logInfo("🏊 Redis 연결 풀: " + std::to_string(pool_size_) + "개");
+
     bool test_mode = config.getBool("REDIS_TEST_MODE", false);
     logInfo("🧪 Redis 테스트 모드: " +
             std::string(test_mode ? "true" : "false"));
@@ -1368,51 +1485,11 @@ bool RedisClientImpl::attemptConnection() {
       context_ = nullptr;
     }
 
-    struct timeval timeout = {.tv_sec = CONNECTION_TIMEOUT.count() / 1000,
-                              .tv_usec =
-                                  (CONNECTION_TIMEOUT.count() % 1000) * 1000};
-
-    context_ = redisConnectWithTimeout(host_.c_str(), port_, timeout);
-
-    if (!context_ || context_->err) {
-      if (context_) {
-        logError("연결 실패: " + std::string(context_->errstr));
-        redisFree(context_);
-        context_ = nullptr;
-      }
+    context_ = openContext(host_, port_, password_, database_);
+    if (!context_) {
       return false;
     }
 
-    // 인증
-    if (!password_.empty()) {
-      redisReply *auth_reply =
-          (redisReply *)redisCommand(context_, "AUTH %s", password_.c_str());
-      if (!auth_reply || auth_reply->type == REDIS_REPLY_ERROR) {
-        logError("Redis 인증 실패");
-        if (auth_reply)
-          freeReplyObject(auth_reply);
-        redisFree(context_);
-        context_ = nullptr;
-        return false;
-      }
-      freeReplyObject(auth_reply);
-    }
-
-    // DB 선택
-    if (database_ != 0) {
-      redisReply *select_reply =
-          (redisReply *)redisCommand(context_, "SELECT %d", database_);
-      if (!select_reply || select_reply->type == REDIS_REPLY_ERROR) {
-        logError("데이터베이스 선택 실패: DB " + std::to_string(database_));
-        if (select_reply)
-          freeReplyObject(select_reply);
-        redisFree(context_);
-        context_ = nullptr;
-        return false;
-      }
-      freeReplyObject(select_reply);
-    }
-
     connected_ = true;
     reconnect_attempts_ = 0;
     connect_time_ = std::chrono::steady_clock::now();
@@ -1430,6 +1507,56 @@ bool RedisClientImpl::attemptConnection() {
 #endif
 }
 
+#ifdef HAVE_REDIS
+redisContext *RedisClientImpl::openContext(const std::string &host, int port,
+                                           const std::string &password,
+                                           int database) {
+  struct timeval timeout = {.tv_sec = CONNECTION_TIMEOUT.count() / 1000,
+                            .tv_usec =
+                                (CONNECTION_TIMEOUT.count() % 1000) * 1000};
+
+  redisContext *context = redisConnectWithTimeout(host.c_str(), port, timeout);
+
+  if (!context || context->err) {
+    if (context) {
+      logError("연결 실패: " + std::string(context->errstr));
+      redisFree(context);
+    }
+    return nullptr;
+  }
+
+  // 인증
+  if (!password.empty()) {
+    redisReply *auth_reply =
+        (redisReply *)redisCommand(context, "AUTH %s", password.c_str());
+    if (!auth_reply || auth_reply->type == REDIS_REPLY_ERROR) {
+      logError("Redis 인증 실패");
+      if (auth_reply)
+        freeReplyObject(auth_reply);
+      redisFree(context);
+      return nullptr;
+    }
+    freeReplyObject(auth_reply);
+  }
+
+  // DB 선택
+  if (database != 0) {
+    redisReply *select_reply =
+        (redisReply *)redisCommand(context, "SELECT %d", database);
+    if (!select_reply || select_reply->type == REDIS_REPLY_ERROR) {
+      logError("데이터베이스 선택 실패: DB " + std::to_string(database));
+      if (select_reply)
+        freeReplyObject(select_reply);
+      redisFree(context);
+      return nullptr;
+    }
+    freeReplyObject(select_reply);
+  }
+
+  return context;
+}
+#endif
+
 bool RedisClientImpl::ensureConnected() {
   // [BUG #13 FIX] connected_/context_/reconnect_attempts_를 뮤텍스 없이
   // 읽으면 watchdog 스레드의 재연결과 TOCTOU 레이스가 발생한다.
@@ -1522,22 +1649,159 @@ void RedisClientImpl::incrementFailure() { failed_commands_++; }
 // =============================================================================
 
 redisReply *RedisClientImpl::executeCommandSafe(const char *format, ...) {
-  if (!context_)
+  redisContext *context = activeContext();
+  if (!context)
     return nullptr;
 
   va_list args;
   va_start(args, format);
-  redisReply *reply = (redisReply *)redisvCommand(context_, format, args);
+  redisReply *reply = (redisReply *)redisvCommand(context, format, args);
   va_end(args);
 
   if (!reply && isConnectionError()) {
-    connected_ = false;
+    markConnectionLost();
     logWarning("Redis 명령 실행 중 연결 오류 감지");
   }
 
   return reply;
 }
 
+// =============================================================================
+// 연결 풀
+// =============================================================================
+
+int RedisClientImpl::checkoutSlot() {
+  if (pool_slots_.empty() || !connected_)
+    return -1; // 풀 비활성 / 기본 연결이 재연결 관리 중
+  const auto self = std::this_thread::get_id();
+  if (transaction_thread_.load() == self)
+    return -1;
+
+  const size_t preferred =
+      std::hash<std::thread::id>{}(self) % pool_slots_.size();
+  auto pick = [this, preferred]() -> int {
+    for (size_t i = 0; i < pool_slots_.size(); ++i) {
+      const size_t index = (preferred + i) % pool_slots_.size();
+      if (!pool_slots_[index].in_use)
+        return static_cast<int>(index);
+    }
+    return -1;
+  };
+
+  std::unique_lock<std::mutex> lock(pool_mutex_);
+  int index = pick();
+  if (index < 0) {
+    pool_waits_++;
+    const auto wait_start = std::chrono::steady_clock::now();
+    pool_cv_.wait_for(lock, pool_wait_timeout_, [&]() {
+      return (index = pick()) >= 0 || shutdown_requested_.load();
+    });
+    const uint64_t waited_us = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - wait_start)
+            .count());
+    pool_wait_us_total_ += waited_us;
+    uint64_t prev_max = pool_wait_us_max_.load();
+    while (waited_us > prev_max &&
+           !pool_wait_us_max_.compare_exchange_weak(prev_max, waited_us)) {
+    }
+    if (index < 0) {
+      pool_wait_timeouts_++;
+      return -1;
+    }
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+  PoolSlot &slot = pool_slots_[index];
+  if (!slot.context && now < slot.retry_after)
+    return -1; // 최근 연결 실패: 기본 연결로
+  slot.in_use = true;
+  const uint64_t generation = pool_generation_;
+  lock.unlock();
+
+  // 슬롯을 소유한 상태이므로 아래는 풀 락 없이 진행
+  if (slot.context && (slot.context->err || slot.generation != generation)) {
+    redisFree(slot.context);
+    slot.context = nullptr;
+  }
+  if (slot.context && pool_health_check_.count() > 0 &&
+      now - slot.last_used > pool_health_check_) {
+    redisReply *reply = (redisReply *)redisCommand(slot.context, "PING");
+    const bool healthy = reply && reply->type == REDIS_REPLY_STATUS;
+    if (reply)
+      freeReplyObject(reply);
+    if (!healthy) {
+      pool_health_failures_++;
+      redisFree(slot.context);
+      slot.context = nullptr;
+    }
+  }
+  if (!slot.context) {
+    std::string host, password;
+    int port, database;
+    {
+      std::lock_guard<std::recursive_mutex> conn_lock(connection_mutex_);
+      host = host_;
+      port = port_;
+      password = password_;
+      database = database_;
+    }
+    slot.context = openContext(host, port, password, database);
+    if (!slot.context) {
+      std::lock_guard<std::mutex> relock(pool_mutex_);
+      slot.retry_after = now + RECONNECT_DELAY;
+      slot.in_use = false;
+      pool_cv_.notify_one();
+      return -1;
+    }
+    slot.generation = generation;
+    pool_connects_++;
+  }
+
+  pool_checkouts_++;
+  tls_owner_ = this;
+  tls_context_ = slot.context;
+  return index;
+}
+
+void RedisClientImpl::releaseSlot(int index) {
+  tls_owner_ = nullptr;
+  tls_context_ = nullptr;
+
+  std::lock_guard<std::mutex> lock(pool_mutex_);
+  PoolSlot &slot = pool_slots_[index];
+  if (slot.context &&
+      (slot.context->err || slot.generation != pool_generation_)) {
+    redisFree(slot.context); // 다음 체크아웃에서 다시 연결
+    slot.context = nullptr;
+  }
+  slot.last_used = std::chrono::steady_clock::now();
+  slot.in_use = false;
+  pool_cv_.notify_one();
+}
+
+void RedisClientImpl::resetPool() {
+  std::lock_guard<std::mutex> lock(pool_mutex_);
+  pool_generation_++;
+  for (auto &slot : pool_slots_) {
+    if (!slot.in_use && slot.context) { // 사용 중인 연결은 반납 시 닫힘
+      redisFree(slot.context);
+      slot.context = nullptr;
+    }
+    slot.retry_after = {};
+  }
+}
+
+redisContext *RedisClientImpl::activeContext() const {
+  return tls_owner_ == this ? tls_context_ : context_;
+}
+
+void RedisClientImpl::markConnectionLost() {
+  // 풀 연결 오류는 반납 시 그 연결만 닫는다
+  if (tls_owner_ != this)
+    connected_ = false;
+}
+
 std::string RedisClientImpl::replyToString(redisReply *reply) const {
   if (!reply)
     return "";
@@ -1626,7 +1890,8 @@ bool RedisClientImpl::isReplyOK(redisReply *reply) const {
 }
 
 bool RedisClientImpl::isConnectionError() const {
-  return context_ && context_->err != 0;
+  redisContext *context = activeContext();
+  return context && context->err != 0;
 }
 #endif
 
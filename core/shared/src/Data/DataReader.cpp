@@ -6,10 +6,12 @@
 // ✅ 핵심: 헤더 include 순서 중요!
 #include "Data/DataReader.h"    // 자신의 헤더
 #include "Client/RedisClient.h" // RedisClient 전체 정의 (필수!)
+#include "Data/RedisValueCodec.h"
 #include "Logging/LogManager.h" // LogManager
 
 #include <algorithm>
 #include <chrono>
+#include <map>
 #include <sstream>
 
 namespace PulseOne {
@@ -135,6 +137,41 @@ std::vector<CurrentValue> DataReader::ReadAllDevicePoints(int device_num) {
   return results;
 }
 
+std::vector<CurrentValue> DataReader::ReadDeviceValues(int device_num) {
+  auto start = std::chrono::steady_clock::now();
+  std::vector<CurrentValue> results;
+
+  try {
+    const std::string num = std::to_string(device_num);
+    const auto fields = redis_->hgetall(RedisKeyBuilder::DeviceValuesKey(num));
+
+    for (const auto &[field, encoded] : fields) {
+      auto decoded = CompactPointValue::Decode(encoded);
+      if (!decoded)
+        continue;
+      try {
+        results.push_back(decoded->toCurrentValue(std::stoi(field), num));
+      } catch (...) {
+        // 숫자가 아닌 필드는 무시
+      }
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+    updateStats(!results.empty(), elapsed);
+
+  } catch (const std::exception &e) {
+    LogManager::getInstance().Error("DataReader::ReadDeviceValues failed: " +
+                                    std::string(e.what()));
+  }
+
+  if (results.empty()) {
+    return ReadAllDevicePoints(device_num); // 레거시 레이아웃
+  }
+  return results;
+}
+
 // =============================================================================
 // Point Latest 읽기 (point:{id}:latest)
 // =============================================================================
@@ -160,15 +197,20 @@ std::optional<CurrentValue> DataReader::ReadPointLatest(int point_id) {
     // Redis에서 읽기
     std::string json_str = readWithRetry(key);
 
+    if (json_str.empty()) {
+      // 해시 레이아웃 (REDIS_STORAGE_LAYOUT=hash)
+      auto result = readFromDeviceHash(point_id);
+      auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+      updateStats(result.has_value(), elapsed);
+      return result;
+    }
+
     auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
                        std::chrono::steady_clock::now() - start)
                        .count();
 
-    if (json_str.empty()) {
-      updateStats(false, elapsed);
-      return std::nullopt;
-    }
-
     // 캐시 저장
     if (options_.enable_cache) {
       putToCache(key, json_str);
@@ -206,9 +248,10 @@ BatchReadResult DataReader::ReadPointsBatch(const std::vector<int> &point_ids) {
     // MGET으로 배치 읽기
     auto values = redis_->mget(keys);
 
-    // 결과 파싱
-    for (size_t i = 0; i < values.size(); i++) {
-      if (!values[i].empty()) {
+    // 결과 파싱 (레거시 키가 없는 포인트는 해시 레이아웃에서 다시 찾음)
+    std::vector<int> missing;
+    for (size_t i = 0; i < point_ids.size(); i++) {
+      if (i < values.size() && !values[i].empty()) {
         auto value = parseCurrentValue(values[i]);
         if (value) {
           result.values.push_back(*value);
@@ -218,8 +261,39 @@ BatchReadResult DataReader::ReadPointsBatch(const std::vector<int> &point_ids) {
           result.failed++;
         }
       } else {
-        result.failed_point_ids.push_back(point_ids[i]);
+        missing.push_back(point_ids[i]);
+      }
+    }
+
+    // 디바이스별로 모아 HGETALL은 디바이스당 1회
+    std::map<std::string, std::vector<int>> by_device;
+    const std::string index_key = RedisKeyBuilder::PointDeviceIndexKey();
+    for (int point_id : missing) {
+      std::string device_num =
+          redis_->hget(index_key, std::to_string(point_id));
+      if (device_num.empty()) {
+        result.failed_point_ids.push_back(point_id);
         result.failed++;
+      } else {
+        by_device[device_num].push_back(point_id);
+      }
+    }
+    for (const auto &[device_num, ids] : by_device) {
+      const auto fields =
+          redis_->hgetall(RedisKeyBuilder::DeviceValuesKey(device_num));
+      for (int point_id : ids) {
+        auto it = fields.find(std::to_string(point_id));
+        auto decoded = it != fields.end()
+                           ? CompactPointValue::Decode(it->second)
+                           : std::nullopt;
+        if (decoded) {
+          result.values.push_back(
+              decoded->toCurrentValue(point_id, device_num));
+          result.successful++;
+        } else {
+          result.failed_point_ids.push_back(point_id);
+          result.failed++;
+        }
       }
     }
 
@@ -604,6 +678,17 @@ bool DataReader::IsConnected() const { return redis_ && redis_->isConnected(); }
 
 std::optional<CurrentValue>
 DataReader::parseCurrentValue(const std::string &json_str) {
+  // REDIS_BINARY_FAMILIES로 바이너리 기록된 키 (device/latest 패밀리)
+  if (RedisValueCodec::IsBinary(json_str)) {
+    auto record = RedisValueCodec::DecodePoint(json_str);
+    if (!record) {
+      LogManager::getInstance().Error(
+          "DataReader::parseCurrentValue: 바이너리 디코딩 실패");
+      return std::nullopt;
+    }
+    return record->toCurrentValue(record->device_id);
+  }
+
   try {
     auto j = nlohmann::json::parse(json_str);
     return CurrentValue::fromJson(j);
@@ -652,6 +737,20 @@ int DataReader::extractDeviceNumber(const std::string &device_id) const {
   }
 }
 
+std::optional<CurrentValue> DataReader::readFromDeviceHash(int point_id) {
+  const std::string field = std::to_string(point_id);
+  const std::string device_num =
+      redis_->hget(RedisKeyBuilder::PointDeviceIndexKey(), field);
+  if (device_num.empty())
+    return std::nullopt;
+
+  auto decoded = CompactPointValue::Decode(
+      redis_->hget(RedisKeyBuilder::DeviceValuesKey(device_num), field));
+  if (!decoded)
+    return std::nullopt;
+  return decoded->toCurrentValue(point_id, device_num);
+}
+
 std::string DataReader::readWithRetry(const std::string &key) {
   int retry_count = 0;
 
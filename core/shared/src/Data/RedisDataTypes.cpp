@@ -4,6 +4,9 @@
 // =============================================================================
 
 #include "Data/RedisDataTypes.h"
+#include "Data/RedisValueCodec.h"
+
+#include <cstdlib>
 
 namespace PulseOne {
 namespace Shared {
@@ -47,6 +50,101 @@ std::optional<CurrentValue> CurrentValue::fromJson(const nlohmann::json& j) {
     }
 }
 
+// =============================================================================
+// CompactPointValue 구현
+// =============================================================================
+
+std::string CompactPointValue::Encode(char type, int quality, int64_t timestamp,
+                                      const std::string& value) {
+    std::string out;
+    out.reserve(value.size() + 24);
+    out.push_back(type);
+    out += std::to_string(quality);
+    out.push_back('|');
+    out += std::to_string(timestamp);
+    out.push_back('|');
+    out += value;
+    return out;
+}
+
+std::optional<CompactPointValue> CompactPointValue::Decode(const std::string& text) {
+    // REDIS_BINARY_FAMILIES에 hash가 있으면 필드 값이 MessagePack
+    if (RedisValueCodec::IsBinary(text)) {
+        auto record = RedisValueCodec::DecodePoint(text);
+        if (!record)
+            return std::nullopt;
+        return record->ToCompact();
+    }
+
+    if (text.size() < 5)
+        return std::nullopt;
+
+    const size_t first = text.find('|');
+    if (first == std::string::npos || first < 2)
+        return std::nullopt;
+    const size_t second = text.find('|', first + 1);
+    if (second == std::string::npos)
+        return std::nullopt;
+
+    CompactPointValue cv;
+    cv.type = text[0];
+    if (cv.type != 'b' && cv.type != 'i' && cv.type != 'd' && cv.type != 's')
+        return std::nullopt;
+
+    char* end = nullptr;
+    cv.quality = static_cast<int>(std::strtol(text.c_str() + 1, &end, 10));
+    if (end != text.c_str() + first)
+        return std::nullopt;
+    cv.timestamp = std::strtoll(text.c_str() + first + 1, &end, 10);
+    if (end != text.c_str() + second)
+        return std::nullopt;
+
+    cv.value = text.substr(second + 1);
+    return cv;
+}
+
+CurrentValue CompactPointValue::toCurrentValue(int point_id,
+                                               const std::string& device_num) const {
+    CurrentValue cv;
+    cv.point_id = point_id;
+    cv.device_id = device_num;
+    cv.device_name = "Device " + device_num;
+    cv.point_name = "point_" + std::to_string(point_id);
+    cv.timestamp = timestamp;
+    cv.unit = "";
+    cv.changed = false;
+
+    switch (type) {
+    case 'b':
+        cv.value = value == "1" ? "true" : "false";
+        cv.data_type = "boolean";
+        break;
+    case 'i':
+        cv.value = value;
+        cv.data_type = "integer";
+        break;
+    case 's':
+        cv.value = value;
+        cv.data_type = "string";
+        break;
+    default:
+        cv.value = value;
+        cv.data_type = "number";
+        break;
+    }
+
+    // RedisDataWriter의 레거시 품질 문자열과 동일하게
+    switch (quality) {
+    case 1:  cv.quality = "good"; break;
+    case 2:  cv.quality = "bad"; break;
+    case 3:  cv.quality = "uncertain"; break;
+    case 8:  cv.quality = "comm_failure"; break;
+    case 9:  cv.quality = "timeout"; break;
+    default: cv.quality = "unknown"; break;
+    }
+    return cv;
+}
+
 // =============================================================================
 // VirtualPointValue 구현
 // =============================================================================
@@ -202,6 +300,18 @@ std::string RedisKeyBuilder::DeviceAllPointsPattern(int device_num) {
     return "device:" + std::to_string(device_num) + ":*";
 }
 
+std::string RedisKeyBuilder::DeviceValuesKey(const std::string& device_num) {
+    return "device:" + device_num + ":values";
+}
+
+std::string RedisKeyBuilder::PointDeviceIndexKey() {
+    return "point:device";
+}
+
+std::string RedisKeyBuilder::ValueEncodingKey() {
+    return "meta:value_encoding";
+}
+
 } // namespace Data
 } // namespace Shared
 } // namespace PulseOne
\ No newline at end of file
@@ -0,0 +1,631 @@
+// =============================================================================
+// core/shared/src/Data/RedisValueCodec.cpp
+// Redis 값 바이너리 인코딩 구현
+// =============================================================================
+
+#include "Data/RedisValueCodec.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace PulseOne {
+namespace Shared {
+namespace Data {
+
+namespace {
+
+constexpr const char* kFamilyNames[] = {"device", "latest", "light", "full",
+                                        "hash"};
+static_assert(sizeof(kFamilyNames) / sizeof(kFamilyNames[0]) ==
+                  static_cast<size_t>(RedisKeyFamily::COUNT),
+              "키 패밀리 이름 누락");
+
+// =============================================================================
+// MessagePack 쓰기 (필요한 타입만)
+// =============================================================================
+
+void PutBigEndian(std::string& out, uint64_t value, int bytes) {
+    for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8)
+        out.push_back(static_cast<char>((value >> shift) & 0xff));
+}
+
+void WriteArrayHeader(std::string& out, uint32_t count) {
+    if (count < 16) {
+        out.push_back(static_cast<char>(0x90 | count));
+    } else if (count <= 0xffff) {
+        out.push_back(static_cast<char>(0xdc));
+        PutBigEndian(out, count, 2);
+    } else {
+        out.push_back(static_cast<char>(0xdd));
+        PutBigEndian(out, count, 4);
+    }
+}
+
+void WriteInt(std::string& out, int64_t value) {
+    if (value >= 0) {
+        const uint64_t v = static_cast<uint64_t>(value);
+        if (v < 0x80) {
+            out.push_back(static_cast<char>(v));
+        } else if (v <= 0xff) {
+            out.push_back(static_cast<char>(0xcc));
+            PutBigEndian(out, v, 1);
+        } else if (v <= 0xffff) {
+            out.push_back(static_cast<char>(0xcd));
+            PutBigEndian(out, v, 2);
+        } else if (v <= 0xffffffffULL) {
+            out.push_back(static_cast<char>(0xce));
+            PutBigEndian(out, v, 4);
+        } else {
+            out.push_back(static_cast<char>(0xcf));
+            PutBigEndian(out, v, 8);
+        }
+        return;
+    }
+
+    const uint64_t bits = static_cast<uint64_t>(value);
+    if (value >= -32) {
+        out.push_back(static_cast<char>(bits & 0xff)); // negative fixint
+    } else if (value >= INT8_MIN) {
+        out.push_back(static_cast<char>(0xd0));
+        PutBigEndian(out, bits, 1);
+    } else if (value >= INT16_MIN) {
+        out.push_back(static_cast<char>(0xd1));
+        PutBigEndian(out, bits, 2);
+    } else if (value >= INT32_MIN) {
+        out.push_back(static_cast<char>(0xd2));
+        PutBigEndian(out, bits, 4);
+    } else {
+        out.push_back(static_cast<char>(0xd3));
+        PutBigEndian(out, bits, 8);
+    }
+}
+
+void WriteBool(std::string& out, bool value) {
+    out.push_back(static_cast<char>(value ? 0xc3 : 0xc2));
+}
+
+void WriteDouble(std::string& out, double value) {
+    // float32로 손실 없이 표현되면 4바이트 (센서 값 대부분)
+    const bool fits_float =
+        !std::isnan(value) &&
+        (std::isinf(value) ||
+         (std::fabs(value) <= FLT_MAX &&
+          static_cast<double>(static_cast<float>(value)) == value));
+    if (fits_float) {
+        const float f = static_cast<float>(value);
+        uint32_t bits;
+        std::memcpy(&bits, &f, sizeof(bits));
+        out.push_back(static_cast<char>(0xca));
+        PutBigEndian(out, bits, 4);
+    } else {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        out.push_back(static_cast<char>(0xcb));
+        PutBigEndian(out, bits, 8);
+    }
+}
+
+void WriteString(std::string& out, const std::string& value) {
+    const size_t len = value.size();
+    if (len < 32) {
+        out.push_back(static_cast<char>(0xa0 | len));
+    } else if (len <= 0xff) {
+        out.push_back(static_cast<char>(0xd9));
+        PutBigEndian(out, len, 1);
+    } else if (len <= 0xffff) {
+        out.push_back(static_cast<char>(0xda));
+        PutBigEndian(out, len, 2);
+    } else {
+        out.push_back(static_cast<char>(0xdb));
+        PutBigEndian(out, len, 4);
+    }
+    out += value;
+}
+
+void WriteValue(std::string& out, const PointValueRecord& record) {
+    switch (record.type) {
+    case 'b':
+        WriteBool(out, record.int_value != 0);
+        break;
+    case 'i':
+        WriteInt(out, record.int_value);
+        break;
+    case 's':
+        WriteString(out, record.string_value);
+        break;
+    default:
+        WriteDouble(out, record.double_value);
+        break;
+    }
+}
+
+// =============================================================================
+// MessagePack 읽기 (범위 검사 포함)
+// =============================================================================
+
+struct Item {
+    enum Kind { NIL, BOOL, INT, DOUBLE, STRING, ARRAY } kind = NIL;
+    int64_t int_value = 0;
+    double double_value = 0.0;
+    const char* str = nullptr;
+    size_t length = 0; // 문자열 길이 또는 배열 원소 수
+};
+
+class Reader {
+public:
+    explicit Reader(const std::string& data)
+        : pos_(reinterpret_cast<const uint8_t*>(data.data())),
+          end_(pos_ + data.size()) {}
+
+    bool Next(Item& item) {
+        if (pos_ >= end_)
+            return false;
+        const uint8_t tag = *pos_++;
+        uint64_t raw = 0;
+
+        if (tag < 0x80) {
+            item.kind = Item::INT;
+            item.int_value = tag;
+            return true;
+        }
+        if (tag >= 0xe0) {
+            item.kind = Item::INT;
+            item.int_value = static_cast<int8_t>(tag);
+            return true;
+        }
+        if ((tag & 0xf0) == 0x90) {
+            item.kind = Item::ARRAY;
+            item.length = tag & 0x0f;
+            return true;
+        }
+        if ((tag & 0xe0) == 0xa0)
+            return ReadString(tag & 0x1f, item);
+
+        switch (tag) {
+        case 0xc0:
+            item.kind = Item::NIL;
+            return true;
+        case 0xc2:
+        case 0xc3:
+            item.kind = Item::BOOL;
+            item.int_value = tag == 0xc3 ? 1 : 0;
+            return true;
+        case 0xca: {
+            if (!Take(4, raw))
+                return false;
+            const uint32_t bits = static_cast<uint32_t>(raw);
+            float f;
+            std::memcpy(&f, &bits, sizeof(f));
+            item.kind = Item::DOUBLE;
+            item.double_value = f;
+            return true;
+        }
+        case 0xcb: {
+            if (!Take(8, raw))
+                return false;
+            double d;
+            std::memcpy(&d, &raw, sizeof(d));
+            item.kind = Item::DOUBLE;
+            item.double_value = d;
+            return true;
+        }
+        case 0xcc:
+        case 0xcd:
+        case 0xce:
+        case 0xcf:
+            if (!Take(1 << (tag - 0xcc), raw))
+                return false;
+            item.kind = Item::INT;
+            item.int_value = static_cast<int64_t>(raw);
+            return true;
+        case 0xd0:
+            if (!Take(1, raw))
+                return false;
+            item.kind = Item::INT;
+            item.int_value = static_cast<int8_t>(raw);
+            return true;
+        case 0xd1:
+            if (!Take(2, raw))
+                return false;
+            item.kind = Item::INT;
+            item.int_value = static_cast<int16_t>(raw);
+            return true;
+        case 0xd2:
+            if (!Take(4, raw))
+                return false;
+            item.kind = Item::INT;
+            item.int_value = static_cast<int32_t>(raw);
+            return true;
+        case 0xd3:
+            if (!Take(8, raw))
+                return false;
+            item.kind = Item::INT;
+            item.int_value = static_cast<int64_t>(raw);
+            return true;
+        case 0xd9:
+        case 0xda:
+        case 0xdb:
+            if (!Take(1 << (tag - 0xd9), raw))
+                return false;
+            return ReadString(raw, item);
+        case 0xdc:
+        case 0xdd:
+            if (!Take(tag == 0xdc ? 2 : 4, raw))
+                return false;
+            item.kind = Item::ARRAY;
+            item.length = static_cast<size_t>(raw);
+            return true;
+        default:
+            return false; // 이 코덱이 쓰지 않는 타입 (map, bin, ext)
+        }
+    }
+
+    bool NextInt(int64_t& value) {
+        Item item;
+        if (!Next(item) || item.kind != Item::INT)
+            return false;
+        value = item.int_value;
+        return true;
+    }
+
+    // nil은 빈 문자열로 취급
+    bool NextString(std::string& value) {
+        Item item;
+        if (!Next(item))
+            return false;
+        if (item.kind == Item::NIL) {
+            value.clear();
+            return true;
+        }
+        if (item.kind != Item::STRING)
+            return false;
+        value.assign(item.str, item.length);
+        return true;
+    }
+
+    bool NextBool(bool& value) {
+        Item item;
+        if (!Next(item))
+            return false;
+        if (item.kind == Item::NIL) {
+            value = false;
+            return true;
+        }
+        if (item.kind != Item::BOOL && item.kind != Item::INT)
+            return false;
+        value = item.int_value != 0;
+        return true;
+    }
+
+    bool NextArray(size_t& count) {
+        Item item;
+        if (!Next(item) || item.kind != Item::ARRAY)
+            return false;
+        count = item.length;
+        return true;
+    }
+
+    bool NextValue(PointValueRecord& record) {
+        Item item;
+        if (!Next(item))
+            return false;
+        switch (item.kind) {
+        case Item::BOOL:
+            record.type = 'b';
+            record.int_value = item.int_value;
+            return true;
+        case Item::INT:
+            record.type = 'i';
+            record.int_value = item.int_value;
+            return true;
+        case Item::DOUBLE:
+            record.type = 'd';
+            record.double_value = item.double_value;
+            return true;
+        case Item::STRING:
+            record.type = 's';
+            record.string_value.assign(item.str, item.length);
+            return true;
+        case Item::NIL:
+            record.type = 's';
+            record.string_value.clear();
+            return true;
+        default:
+            return false;
+        }
+    }
+
+private:
+    bool Take(int bytes, uint64_t& value) {
+        if (end_ - pos_ < bytes)
+            return false;
+        value = 0;
+        for (int i = 0; i < bytes; ++i)
+            value = (value << 8) | *pos_++;
+        return true;
+    }
+
+    bool ReadString(uint64_t length, Item& item) {
+        if (static_cast<uint64_t>(end_ - pos_) < length)
+            return false;
+        item.kind = Item::STRING;
+        item.str = reinterpret_cast<const char*>(pos_);
+        item.length = static_cast<size_t>(length);
+        pos_ += length;
+        return true;
+    }
+
+    const uint8_t* pos_;
+    const uint8_t* end_;
+};
+
+// 스키마 번호 뒤의 [point_id, value, ts, quality] 공통 부분
+bool ReadPointCore(Reader& reader, PointValueRecord& record) {
+    int64_t point_id = 0;
+    int64_t quality = 0;
+    if (!reader.NextInt(point_id) || !reader.NextValue(record) ||
+        !reader.NextInt(record.timestamp) || !reader.NextInt(quality))
+        return false;
+    record.point_id = static_cast<int>(point_id);
+    record.quality = static_cast<int>(quality);
+    return true;
+}
+
+std::string FormatDouble(double value) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.15g", value);
+    return buf;
+}
+
+} // namespace
+
+// =============================================================================
+// 키 패밀리 이름
+// =============================================================================
+
+const char* KeyFamilyName(RedisKeyFamily family) {
+    const size_t index = static_cast<size_t>(family);
+    return index < static_cast<size_t>(RedisKeyFamily::COUNT)
+               ? kFamilyNames[index]
+               : "unknown";
+}
+
+std::optional<RedisKeyFamily> KeyFamilyFromName(const std::string& name) {
+    for (size_t i = 0; i < static_cast<size_t>(RedisKeyFamily::COUNT); ++i) {
+        if (name == kFamilyNames[i])
+            return static_cast<RedisKeyFamily>(i);
+    }
+    return std::nullopt;
+}
+
+const char* ValueEncodingName(ValueEncoding encoding) {
+    return encoding == ValueEncoding::MSGPACK ? "msgpack/1" : "json";
+}
+
+// =============================================================================
+// PointValueRecord
+// =============================================================================
+
+std::string PointValueRecord::ValueText() const {
+    switch (type) {
+    case 'b':
+        return int_value ? "true" : "false";
+    case 'i':
+        return std::to_string(int_value);
+    case 's':
+        return string_value;
+    default:
+        return FormatDouble(double_value);
+    }
+}
+
+double PointValueRecord::NumericValue() const {
+    switch (type) {
+    case 'b':
+    case 'i':
+        return static_cast<double>(int_value);
+    case 's':
+        return std::strtod(string_value.c_str(), nullptr);
+    default:
+        return double_value;
+    }
+}
+
+CompactPointValue PointValueRecord::ToCompact() const {
+    CompactPointValue cv;
+    cv.type = type;
+    cv.quality = quality;
+    cv.timestamp = timestamp;
+    switch (type) {
+    case 'b':
+        cv.value = int_value ? "1" : "0";
+        break;
+    case 'i':
+        cv.value = std::to_string(int_value);
+        break;
+    case 's':
+        cv.value = string_value;
+        break;
+    default:
+        cv.type = 'd';
+        cv.value = FormatDouble(double_value);
+        break;
+    }
+    return cv;
+}
+
+CurrentValue PointValueRecord::toCurrentValue(const std::string& device_num) const {
+    CurrentValue cv = ToCompact().toCurrentValue(
+        point_id, device_id.empty() ? device_num : device_id);
+    if (!point_name.empty())
+        cv.point_name = point_name;
+    if (!device_name.empty())
+        cv.device_name = device_name;
+    cv.unit = unit;
+    cv.changed = changed;
+    return cv;
+}
+
+// =============================================================================
+// RedisValueCodec
+// =============================================================================
+
+bool RedisValueCodec::IsBinary(const std::string& payload) {
+    if (payload.size() < 2)
+        return false;
+    const uint8_t tag = static_cast<uint8_t>(payload[0]);
+    uint8_t schema;
+    if ((tag & 0xf0) == 0x90) {
+        schema = static_cast<uint8_t>(payload[1]);
+    } else if (tag == 0xdc && payload.size() >= 4) {
+        schema = static_cast<uint8_t>(payload[3]);
+    } else {
+        return false;
+    }
+    return schema == POINT_VALUE_V1 || schema == DEVICE_SNAPSHOT_V1;
+}
+
+void RedisValueCodec::EncodePoint(const PointValueRecord& record, int metadata,
+                                  std::string& out) {
+    if (metadata < META_NONE)
+        metadata = META_NONE;
+    if (metadata > META_ALL)
+        metadata = META_ALL;
+
+    WriteArrayHeader(out, static_cast<uint32_t>(5 + metadata));
+    WriteInt(out, POINT_VALUE_V1);
+    WriteInt(out, record.point_id);
+    WriteValue(out, record);
+    WriteInt(out, record.timestamp);
+    WriteInt(out, record.quality);
+
+    const std::string* const strings[] = {&record.device_id, &record.point_name,
+                                          &record.unit, &record.device_name};
+    if (metadata > 0)
+        WriteBool(out, record.changed);
+    for (int i = 1; i < metadata; ++i)
+        WriteString(out, *strings[i - 1]);
+}
+
+void RedisValueCodec::EncodeDeviceSnapshot(const DeviceSnapshotRecord& snapshot,
+                                           std::string& out) {
+    WriteArrayHeader(out, 5);
+    WriteInt(out, DEVICE_SNAPSHOT_V1);
+    WriteString(out, snapshot.device_id);
+    WriteString(out, snapshot.protocol);
+    WriteInt(out, snapshot.timestamp);
+    WriteArrayHeader(out, static_cast<uint32_t>(snapshot.points.size()));
+    for (const auto& point : snapshot.points) {
+        WriteArrayHeader(out, 5);
+        WriteInt(out, point.point_id);
+        WriteValue(out, point);
+        WriteInt(out, point.timestamp);
+        WriteInt(out, point.quality);
+        WriteBool(out, point.changed);
+    }
+}
+
+std::optional<PointValueRecord>
+RedisValueCodec::DecodePoint(const std::string& payload) {
+    Reader reader(payload);
+    size_t count = 0;
+    int64_t schema = 0;
+    if (!reader.NextArray(count) || count < 5 || !reader.NextInt(schema) ||
+        schema != POINT_VALUE_V1)
+        return std::nullopt;
+
+    PointValueRecord record;
+    if (!ReadPointCore(reader, record))
+        return std::nullopt;
+
+    // 선택 메타데이터 (모르는 뒤쪽 원소는 무시)
+    std::string* const strings[] = {&record.device_id, &record.point_name,
+                                    &record.unit, &record.device_name};
+    if (count > 5 && !reader.NextBool(record.changed))
+        return std::nullopt;
+    for (size_t i = 6; i < count && i < 10; ++i) {
+        if (!reader.NextString(*strings[i - 6]))
+            return std::nullopt;
+    }
+    return record;
+}
+
+std::optional<DeviceSnapshotRecord>
+RedisValueCodec::DecodeDeviceSnapshot(const std::string& payload) {
+    Reader reader(payload);
+    size_t count = 0;
+    int64_t schema = 0;
+    if (!reader.NextArray(count) || count < 5 || !reader.NextInt(schema) ||
+        schema != DEVICE_SNAPSHOT_V1)
+        return std::nullopt;
+
+    DeviceSnapshotRecord snapshot;
+    size_t points = 0;
+    if (!reader.NextString(snapshot.device_id) ||
+        !reader.NextString(snapshot.protocol) ||
+        !reader.NextInt(snapshot.timestamp) || !reader.NextArray(points))
+        return std::nullopt;
+
+    // 원소 하나가 최소 6바이트이므로 깨진 길이로 과도하게 예약하지 않도록
+    if (points > payload.size() / 6)
+        return std::nullopt;
+    snapshot.points.reserve(points);
+    for (size_t i = 0; i < points; ++i) {
+        size_t fields = 0;
+        PointValueRecord record;
+        if (!reader.NextArray(fields) || fields < 5 ||
+            !ReadPointCore(reader, record) || !reader.NextBool(record.changed))
+            return std::nullopt;
+        snapshot.points.push_back(std::move(record));
+    }
+    return snapshot;
+}
+
+std::optional<nlohmann::json> RedisValueCodec::ToJson(const std::string& payload) {
+    if (!IsBinary(payload))
+        return std::nullopt;
+
+    if (auto point = DecodePoint(payload)) {
+        const CurrentValue cv = point->toCurrentValue(point->device_id);
+        nlohmann::json j;
+        j["point_id"] = point->point_id;
+        j["value"] = point->ValueText();
+        j["timestamp"] = point->timestamp;
+        j["quality"] = point->quality;
+        j["data_type"] = cv.data_type;
+        j["changed"] = point->changed;
+        if (!point->device_id.empty())
+            j["device_id"] = point->device_id;
+        if (!point->point_name.empty())
+            j["point_name"] = point->point_name;
+        if (!point->unit.empty())
+            j["unit"] = point->unit;
+        if (!point->device_name.empty())
+            j["device_name"] = point->device_name;
+        return j;
+    }
+
+    if (auto snapshot = DecodeDeviceSnapshot(payload)) {
+        nlohmann::json j;
+        j["device_id"] = snapshot->device_id;
+        j["protocol"] = snapshot->protocol;
+        j["timestamp"] = snapshot->timestamp;
+        j["points"] = nlohmann::json::array();
+        for (const auto& point : snapshot->points) {
+            j["points"].push_back({{"point_id", point.point_id},
+                                   {"value", point.ValueText()},
+                                   {"timestamp", point.timestamp},
+                                   {"quality", point.quality},
+                                   {"changed", point.changed}});
+        }
+        return j;
+    }
+    return std::nullopt;
+}
+
+} // namespace Data
+} // namespace Shared
+} // namespace PulseOne
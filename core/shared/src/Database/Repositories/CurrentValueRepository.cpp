@@ -8,7 +8,12 @@
 #include "Database/Repositories/RepositoryHelpers.h"
 #include "Database/SQLQueries.h"
 #include "DatabaseAbstractionLayer.hpp"
+#include "DatabaseManager.hpp"
 #include "Logging/LogManager.h"
+#include "Utils/ConfigManager.h"
+
+#include <algorithm>
+#include <mutex>
 
 namespace PulseOne {
 namespace Database {
@@ -421,84 +426,109 @@ bool CurrentValueRepository::incrementErrorCount(int point_id) {
 // 🔥 Batch Save: N개를 1 트랜잭션으로 처리 (30K 포인트 성능 최적화)
 // =============================================================================
 
+/**
+ * @brief saveBatch 전용 SQLite 연결
+ * @details DatabaseManager 공유 연결은 다른 저장소의 sqlite3_exec와 섞여
+ * 트랜잭션 경계를 보장할 수 없으므로 같은 DB 파일에 연결을 하나 더 연다.
+ * WAL 모드라 읽기와 충돌하지 않고, 쓰기 경합은 busy_timeout으로 기다린다.
+ */
+class CurrentValueRepository::BulkWriter {
+public:
+  ~BulkWriter() { close(); }
+
+  // mutex 보유 상태에서 호출. 실패하면 이후 호출은 바로 false
+  bool open() {
+    if (conn_)
+      return true;
+    if (failed_)
+      return false;
+
+    auto &config = ::ConfigManager::getInstance();
+    const std::string path =
+        DbLib::DatabaseManager::getInstance().getConfig().sqlite_path;
+    const int cache_kb =
+        std::max(config.getInt("SQLITE_BULK_CACHE_KB", 8192), 0);
+
+    int rc = sqlite3_open_v2(path.c_str(), &conn_,
+                             SQLITE_OPEN_READWRITE | SQLITE_OPEN_NOMUTEX,
+                             nullptr);
+    if (rc == SQLITE_OK) {
+      sqlite3_busy_timeout(conn_, 5000);
+      // journal_mode는 DB 파일 단위, 나머지는 연결 단위 설정
+      const std::string pragmas =
+          "PRAGMA journal_mode=WAL; PRAGMA synchronous=NORMAL; "
+          "PRAGMA temp_store=MEMORY; PRAGMA cache_size=-" +
+          std::to_string(cache_kb) + ";";
+      rc = sqlite3_exec(conn_, pragmas.c_str(), nullptr, nullptr, nullptr);
+    }
+    if (rc == SQLITE_OK) {
+      rc = sqlite3_prepare_v2(conn_, SQL::CurrentValue::BULK_UPSERT.c_str(),
+                              -1, &upsert_, nullptr);
+    }
+    if (rc != SQLITE_OK) {
+      LogManager::getInstance().Warn(
+          "CurrentValueRepository: 벌크 저장 연결 실패, 기존 경로 사용 - " +
+          std::string(conn_ ? sqlite3_errmsg(conn_) : sqlite3_errstr(rc)));
+      close();
+      failed_ = true;
+      return false;
+    }
+    return true;
+  }
+
+  void close() {
+    if (upsert_) {
+      sqlite3_finalize(upsert_);
+      upsert_ = nullptr;
+    }
+    if (conn_) {
+      sqlite3_close(conn_);
+      conn_ = nullptr;
+    }
+  }
+
+  std::mutex mutex;
+
+private:
+  friend class CurrentValueRepository;
+
+  sqlite3 *conn_ = nullptr;
+  sqlite3_stmt *upsert_ = nullptr;
+  bool failed_ = false;
+};
+
+CurrentValueRepository::CurrentValueRepository()
+    : IRepository<CurrentValueEntity>("CurrentValueRepository"),
+      bulk_writer_(std::make_unique<BulkWriter>()) {}
+
+CurrentValueRepository::~CurrentValueRepository() = default;
+
 size_t CurrentValueRepository::saveBatch(
     const std::vector<CurrentValueEntity> &entities) {
   if (entities.empty())
     return 0;
 
-  // SQL 이스케이프 헬퍼: ' → '' (SQLite 표준)
-  // MQTT 등 문자열 포인트 값에 홑따옴표가 포함돼도 SQL이 깨지지 않도록 방어
-  auto esc = [](const std::string &s) -> std::string {
-    std::string out;
-    out.reserve(s.size());
-    for (char c : s) {
-      if (c == '\'')
-        out += '\''; // ' → '' (두 번 삽입)
-      out += c;
-    }
-    return out;
-  };
-
   try {
     if (!ensureTableExists())
       return 0;
 
-    DbLib::DatabaseAbstractionLayer db_layer;
-    std::vector<std::string> queries;
-    queries.reserve(entities.size());
-
-    auto now_str = Utils::TimestampToDBString(Utils::GetCurrentTimestamp());
-
-    for (const auto &entity : entities) {
-      // 유효성 간단 체크
-      if (entity.getPointId() <= 0 || entity.getCurrentValue().empty())
-        continue;
-
-      auto params = entityToParams(entity);
-
-      // INSERT OR REPLACE 쿼리 직접 생성 (executeBatch는 트랜잭션 없이 실행)
-      // 문자열 값에는 esc() 적용, 숫자 값(point_id 등)은 그대로 사용
-      std::string q = "INSERT OR REPLACE INTO current_values ("
-                      "point_id, current_value, raw_value, value_type, "
-                      "quality_code, quality, value_timestamp, "
-                      "read_count, write_count, error_count, updated_at"
-                      ") VALUES (" +
-                      params["point_id"] +
-                      ", " // 숫자: 따옴표 없이
-                      "'" +
-                      esc(params["current_value"]) +
-                      "', "
-                      "'" +
-                      esc(params["raw_value"]) +
-                      "', "
-                      "'" +
-                      esc(params["value_type"]) + "', " +
-                      params["quality_code"] +
-                      ", " // 숫자
-                      "'" +
-                      esc(params["quality"]) +
-                      "', "
-                      "'" +
-                      esc(params["value_timestamp"]) + "', " +
-                      params["read_count"] + ", "    // 숫자
-                      + params["write_count"] + ", " // 숫자
-                      + params["error_count"] +
-                      ", " // 숫자
-                      "'" +
-                      now_str +
-                      "'"
-                      ")";
-      queries.push_back(std::move(q));
-    }
-
-    if (queries.empty())
-      return 0;
+    // DatabaseManager와 같은 규칙: POSTGRESQL/MYSQL/MSSQL 외에는 SQLite
+    std::string db_type =
+        DbLib::DatabaseManager::getInstance().getConfig().type;
+    std::transform(db_type.begin(), db_type.end(), db_type.begin(), ::toupper);
+    const bool is_sqlite = db_type != "POSTGRESQL" && db_type != "MYSQL" &&
+                           db_type != "MSSQL";
 
-    bool ok = db_layer.executeBatch(queries);
-    size_t saved = ok ? queries.size() : 0;
+    long bulk_saved = -1;
+    if (is_sqlite && ::ConfigManager::getInstance().getBool(
+                         "SQLITE_BULK_WRITER_ENABLED", true)) {
+      bulk_saved = saveBatchSQLite(entities);
+    }
+    const size_t saved = bulk_saved >= 0 ? static_cast<size_t>(bulk_saved)
+                                         : saveBatchGeneric(entities);
 
     // 캐시 무효화
-    if (ok && isCacheEnabled()) {
+    if (saved > 0 && isCacheEnabled()) {
       for (const auto &entity : entities) {
         clearCacheForId(entity.getPointId());
       }
@@ -513,6 +543,161 @@ size_t CurrentValueRepository::saveBatch(
   }
 }
 
+long CurrentValueRepository::saveBatchSQLite(
+    const std::vector<CurrentValueEntity> &entities) {
+  BulkWriter &writer = *bulk_writer_;
+  std::lock_guard<std::mutex> lock(writer.mutex);
+  if (!writer.open())
+    return -1;
+
+  sqlite3 *conn = writer.conn_;
+  sqlite3_stmt *stmt = writer.upsert_;
+
+  // IMMEDIATE: 쓰기 락을 처음에 잡아 트랜잭션 도중 락 승격 실패(BUSY) 방지
+  if (sqlite3_exec(conn, "BEGIN IMMEDIATE", nullptr, nullptr, nullptr) !=
+      SQLITE_OK) {
+    LogManager::getInstance().Error("saveBatch BEGIN failed: " +
+                                    std::string(sqlite3_errmsg(conn)));
+    return 0;
+  }
+
+  const std::string now_str =
+      Utils::TimestampToDBString(Utils::GetCurrentTimestamp());
+  std::string value_type;
+  std::string value_timestamp;
+  long saved = 0;
+
+  for (const auto &entity : entities) {
+    // 유효성 간단 체크
+    if (entity.getPointId() <= 0 || entity.getCurrentValue().empty())
+      continue;
+
+    // entityToParams와 같은 정규화 (value_type 소문자, 기본 "string")
+    value_type = entity.getValueType();
+    if (value_type.empty())
+      value_type = "string";
+    std::transform(value_type.begin(), value_type.end(), value_type.begin(),
+                   ::tolower);
+    value_timestamp = Utils::TimestampToString(entity.getValueTimestamp());
+
+    // 바인딩 문자열은 step() 전까지 살아 있으므로 SQLITE_STATIC
+    const auto &current_value = entity.getCurrentValue();
+    const auto &raw_value = entity.getRawValue();
+    const auto &quality = entity.getQuality();
+
+    sqlite3_reset(stmt);
+    sqlite3_bind_int(stmt, 1, entity.getPointId());
+    sqlite3_bind_text(stmt, 2, current_value.data(),
+                      static_cast<int>(current_value.size()), SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 3, raw_value.data(),
+                      static_cast<int>(raw_value.size()), SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 4, value_type.data(),
+                      static_cast<int>(value_type.size()), SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 5, static_cast<int>(entity.getQualityCode()));
+    sqlite3_bind_text(stmt, 6, quality.data(), static_cast<int>(quality.size()),
+                      SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 7, value_timestamp.data(),
+                      static_cast<int>(value_timestamp.size()), SQLITE_STATIC);
+    sqlite3_bind_int64(stmt, 8,
+                       static_cast<sqlite3_int64>(entity.getReadCount()));
+    sqlite3_bind_int64(stmt, 9,
+                       static_cast<sqlite3_int64>(entity.getWriteCount()));
+    sqlite3_bind_int64(stmt, 10,
+                       static_cast<sqlite3_int64>(entity.getErrorCount()));
+    sqlite3_bind_text(stmt, 11, now_str.data(),
+                      static_cast<int>(now_str.size()), SQLITE_STATIC);
+
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+      LogManager::getInstance().Error(
+          "saveBatch failed at point " + std::to_string(entity.getPointId()) +
+          ": " + std::string(sqlite3_errmsg(conn)));
+      sqlite3_reset(stmt);
+      sqlite3_exec(conn, "ROLLBACK", nullptr, nullptr, nullptr);
+      return 0;
+    }
+    ++saved;
+  }
+  sqlite3_reset(stmt);
+  sqlite3_clear_bindings(stmt);
+
+  if (sqlite3_exec(conn, "COMMIT", nullptr, nullptr, nullptr) != SQLITE_OK) {
+    LogManager::getInstance().Error("saveBatch COMMIT failed: " +
+                                    std::string(sqlite3_errmsg(conn)));
+    sqlite3_exec(conn, "ROLLBACK", nullptr, nullptr, nullptr);
+    return 0;
+  }
+  return saved;
+}
+
+size_t CurrentValueRepository::saveBatchGeneric(
+    const std::vector<CurrentValueEntity> &entities) {
+  // SQL 이스케이프 헬퍼: ' → '' (SQLite 표준)
+  // MQTT 등 문자열 포인트 값에 홑따옴표가 포함돼도 SQL이 깨지지 않도록 방어
+  auto esc = [](const std::string &s) -> std::string {
+    std::string out;
+    out.reserve(s.size());
+    for (char c : s) {
+      if (c == '\'')
+        out += '\''; // ' → '' (두 번 삽입)
+      out += c;
+    }
+    return out;
+  };
+
+  DbLib::DatabaseAbstractionLayer db_layer;
+  std::vector<std::string> queries;
+  queries.reserve(entities.size());
+
+  auto now_str = Utils::TimestampToDBString(Utils::GetCurrentTimestamp());
+
+  for (const auto &entity : entities) {
+    // 유효성 간단 체크
+    if (entity.getPointId() <= 0 || entity.getCurrentValue().empty())
+      continue;
+
+    auto params = entityToParams(entity);
+
+    // INSERT OR REPLACE 쿼리 직접 생성 (executeBatch는 트랜잭션 없이 실행)
+    // 문자열 값에는 esc() 적용, 숫자 값(point_id 등)은 그대로 사용
+    std::string q = "INSERT OR REPLACE INTO current_values ("
+                    "point_id, current_value, raw_value, value_type, "
+                    "quality_code, quality, value_timestamp, "
+                    "read_count, write_count, error_count, updated_at"
+                    ") VALUES (" +
+                    params["point_id"] +
+                    ", " // 숫자: 따옴표 없이
+                    "'" +
+                    esc(params["current_value"]) +
+                    "', "
+                    "'" +
+                    esc(params["raw_value"]) +
+                    "', "
+                    "'" +
+                    esc(params["value_type"]) + "', " +
+                    params["quality_code"] +
+                    ", " // 숫자
+                    "'" +
+                    esc(params["quality"]) +
+                    "', "
+                    "'" +
+                    esc(params["value_timestamp"]) + "', " +
+                    params["read_count"] + ", "    // 숫자
+                    + params["write_count"] + ", " // 숫자
+                    + params["error_count"] +
+                    ", " // 숫자
+                    "'" +
+                    now_str +
+                    "'"
+                    ")";
+    queries.push_back(std::move(q));
+  }
+
+  if (queries.empty())
+    return 0;
+
+  return db_layer.executeBatch(queries) ? queries.size() : 0;
+}
+
 // =============================================================================
 // 캐시 관리 (IRepository 상속)
 // =============================================================================